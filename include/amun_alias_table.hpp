@@ -2,7 +2,9 @@
 
 #include "amun_primitives.hpp"
 
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace amun {
 
@@ -10,16 +12,21 @@ class AliasTable {
   public:
     AliasTable();
 
-    auto define_alias(std::string alias, Shared<amun::Type> type) -> void;
+    auto define_alias(std::string alias, amun::Type* type) -> void;
 
-    auto resolve_alias(std::string alias) -> Shared<amun::Type>;
+    auto resolve_alias(std::string alias) -> amun::Type*;
 
     auto contains(std::string alias) -> bool;
 
+    // Aliases names in the order of definition, so the aliases defined while parsing a source
+    // file are the names after the count before parsing it
+    auto defined_aliases() -> const std::vector<std::string>& { return aliases_names; }
+
   private:
     auto config_type_alias_table() -> void;
 
-    std::unordered_map<std::string, Shared<amun::Type>> type_alias_table;
+    std::unordered_map<std::string, amun::Type*> type_alias_table;
+    std::vector<std::string> aliases_names;
 };
 
 } // namespace amun
\ No newline at end of file
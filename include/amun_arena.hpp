@@ -0,0 +1,44 @@
+#pragma once
+
+#include <llvm/Support/Allocator.h>
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace amun {
+
+// Objects are allocated using bump pointer allocator and referenced with raw pointers,
+// then all of them are destroyed in one shot with the arena
+class Arena {
+  public:
+    Arena() = default;
+
+    Arena(const Arena&) = delete;
+    auto operator=(const Arena&) -> Arena& = delete;
+
+    ~Arena()
+    {
+        // Destroy objects in reverse order of creation, memory is released by the allocator
+        for (auto it = destructors.rbegin(); it != destructors.rend(); ++it) {
+            it->second(it->first);
+        }
+    }
+
+    template <typename T, typename... Args>
+    auto create(Args&&... args) -> T*
+    {
+        auto* memory = allocator.Allocate(sizeof(T), alignof(T));
+        auto* object = new (memory) T(std::forward<Args>(args)...);
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            destructors.emplace_back(object, [](void* pointer) { static_cast<T*>(pointer)->~T(); });
+        }
+        return object;
+    }
+
+  private:
+    llvm::BumpPtrAllocator allocator;
+    std::vector<std::pair<void*, void (*)(void*)>> destructors;
+};
+
+} // namespace amun
@@ -4,11 +4,15 @@
 #include "amun_primitives.hpp"
 #include "amun_token.hpp"
 
-#include <any>
+#include <map>
 #include <memory>
 #include <utility>
 #include <vector>
 
+namespace llvm {
+class Value;
+}
+
 enum class AstNodeType {
     AST_NODE,
 
@@ -70,105 +74,142 @@ struct AstNode {
     virtual auto get_ast_node_type() -> AstNodeType = 0;
 };
 
+// Visitors return the result directly, the type checker visit to amun types
+// and the llvm backend visit to llvm values, visitors that only walk the tree return void
 class Statement : public AstNode {
   public:
-    virtual auto accept(StatementVisitor* visitor) -> std::any = 0;
+    virtual auto accept(StatementVisitor<amun::Type*>* visitor) -> amun::Type* = 0;
+    virtual auto accept(StatementVisitor<llvm::Value*>* visitor) -> llvm::Value* = 0;
+    virtual auto accept(StatementVisitor<void>* visitor) -> void = 0;
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_NODE; }
 };
 
 class Expression : public AstNode {
   public:
-    virtual auto get_type_node() -> Shared<amun::Type> = 0;
-    virtual auto set_type_node(Shared<amun::Type> new_type) -> void = 0;
-    virtual auto accept(ExpressionVisitor* visitor) -> std::any = 0;
+    virtual auto get_type_node() -> amun::Type* = 0;
+    virtual auto set_type_node(amun::Type* new_type) -> void = 0;
+    virtual auto accept(ExpressionVisitor<amun::Type*>* visitor) -> amun::Type* = 0;
+    virtual auto accept(ExpressionVisitor<llvm::Value*>* visitor) -> llvm::Value* = 0;
+    virtual auto accept(ExpressionVisitor<void>* visitor) -> void = 0;
     virtual auto is_constant() -> bool = 0;
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_NODE; }
 };
 
-struct CompilationUnit {
-    explicit CompilationUnit(std::vector<Shared<Statement>> nodes) : tree_nodes(std::move(nodes)) {}
-    std::vector<Shared<Statement>> tree_nodes;
+// Implement accept once for every visitor by dispatching to the visit of the concrete node
+template <typename Node>
+class StatementNode : public Statement {
+  public:
+    auto accept(StatementVisitor<amun::Type*>* visitor) -> amun::Type* override
+    {
+        return visitor->visit(static_cast<Node*>(this));
+    }
+
+    auto accept(StatementVisitor<llvm::Value*>* visitor) -> llvm::Value* override
+    {
+        return visitor->visit(static_cast<Node*>(this));
+    }
+
+    auto accept(StatementVisitor<void>* visitor) -> void override
+    {
+        visitor->visit(static_cast<Node*>(this));
+    }
 };
 
-class BlockStatement : public Statement {
+template <typename Node>
+class ExpressionNode : public Expression {
   public:
-    explicit BlockStatement(std::vector<Shared<Statement>> nodes) : statements(std::move(nodes)) {}
+    auto accept(ExpressionVisitor<amun::Type*>* visitor) -> amun::Type* override
+    {
+        return visitor->visit(static_cast<Node*>(this));
+    }
+
+    auto accept(ExpressionVisitor<llvm::Value*>* visitor) -> llvm::Value* override
+    {
+        return visitor->visit(static_cast<Node*>(this));
+    }
+
+    auto accept(ExpressionVisitor<void>* visitor) -> void override
+    {
+        visitor->visit(static_cast<Node*>(this));
+    }
+};
+
+struct CompilationUnit {
+    explicit CompilationUnit(std::vector<Statement*> nodes) : tree_nodes(std::move(nodes)) {}
+    std::vector<Statement*> tree_nodes;
+};
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
+class BlockStatement : public StatementNode<BlockStatement> {
+  public:
+    explicit BlockStatement(std::vector<Statement*> nodes) : statements(std::move(nodes)) {}
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_BLOCK; }
 
-    std::vector<Shared<Statement>> statements;
+    std::vector<Statement*> statements;
 };
 
 struct Parameter {
-    Parameter(Token name, Shared<amun::Type> type) : name(std::move(name)), type(std::move(type)) {}
+    Parameter(Token name, amun::Type* type) : name(std::move(name)), type(type) {}
     Token name;
-    Shared<amun::Type> type;
+    amun::Type* type;
 };
 
-class FieldDeclaration : public Statement {
+class FieldDeclaration : public StatementNode<FieldDeclaration> {
   public:
-    FieldDeclaration(Token name, Shared<amun::Type> type, Shared<Expression> value, bool global)
-        : name(std::move(name)), type(std::move(type)), value(std::move(value)), is_global(global)
+    FieldDeclaration(Token name, amun::Type* type, Expression* value, bool global)
+        : name(std::move(name)), type(type), value(std::move(value)), is_global(global)
     {
         has_explicit_type = this->type->type_kind != amun::TypeKind::NONE;
     }
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
-
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_FIELD_DECLARAION; }
 
     Token name;
-    Shared<amun::Type> type;
-    Shared<Expression> value;
+    amun::Type* type;
+    Expression* value;
     bool is_global;
     bool has_explicit_type;
 };
 
-class DestructuringDeclaraion : public Statement {
+class DestructuringDeclaraion : public StatementNode<DestructuringDeclaraion> {
   public:
-    DestructuringDeclaraion(std::vector<Token> names, std::vector<Shared<amun::Type>> types,
-                            Shared<Expression> value, Token equal_token, bool is_global)
+    DestructuringDeclaraion(std::vector<Token> names, std::vector<amun::Type*> types,
+                            Expression* value, Token equal_token, bool is_global)
         : names(std::move(names)), types(std::move(types)), value(std::move(value)),
           equal_token(std::move(equal_token)), is_global(is_global)
     {
     }
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
-
     auto get_ast_node_type() -> AstNodeType override
     {
         return AstNodeType::AST_DESTRUCTURING_DECLARAION;
     }
 
     std::vector<Token> names;
-    std::vector<Shared<amun::Type>> types;
-    Shared<Expression> value;
+    std::vector<amun::Type*> types;
+    Expression* value;
     Token equal_token;
     bool is_global;
 };
 
-class ConstDeclaration : public Statement {
+class ConstDeclaration : public StatementNode<ConstDeclaration> {
   public:
-    ConstDeclaration(Token name, Shared<Expression> value)
+    ConstDeclaration(Token name, Expression* value)
         : name(std::move(name)), value(std::move(value))
     {
     }
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
-
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_FIELD_DECLARAION; }
 
     Token name;
-    Shared<Expression> value;
+    Expression* value;
 };
 
-class FunctionPrototype : public Statement {
+class FunctionPrototype : public StatementNode<FunctionPrototype> {
   public:
-    FunctionPrototype(Token name, std::vector<Shared<Parameter>> parameters,
-                      Shared<amun::Type> return_type, bool external = false, bool varargs = false,
-                      Shared<amun::Type> varargs_type = {}, bool is_generic = false,
+    FunctionPrototype(Token name, std::vector<Parameter*> parameters,
+                      amun::Type* return_type, bool external = false, bool varargs = false,
+                      amun::Type* varargs_type = {}, bool is_generic = false,
                       std::vector<std::string> generic_parameters = {})
         : name(std::move(name)), parameters(std::move(parameters)),
           return_type(std::move(return_type)), is_external(external), has_varargs(varargs),
@@ -177,271 +218,260 @@ class FunctionPrototype : public Statement {
     {
     }
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
-
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_PROTOTYPE; }
 
     Token name;
-    std::vector<Shared<Parameter>> parameters;
-    Shared<amun::Type> return_type;
+    std::vector<Parameter*> parameters;
+    amun::Type* return_type;
     bool is_external;
 
     bool has_varargs;
-    Shared<amun::Type> varargs_type;
+    amun::Type* varargs_type;
 
     bool is_generic;
     std::vector<std::string> generic_parameters;
 };
 
-class IntrinsicPrototype : public Statement {
+class IntrinsicPrototype : public StatementNode<IntrinsicPrototype> {
   public:
     IntrinsicPrototype(Token name, std::string native_name,
-                       std::vector<Shared<Parameter>> parameters, Shared<amun::Type> return_type,
-                       bool varargs, Shared<amun::Type> varargs_type)
+                       std::vector<Parameter*> parameters, amun::Type* return_type,
+                       bool varargs, amun::Type* varargs_type)
         : name(std::move(name)), native_name(std::move(native_name)),
           parameters(std::move(parameters)), return_type(std::move(return_type)), varargs(varargs),
           varargs_type(std::move(varargs_type))
     {
     }
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
-
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_INTRINSIC; }
 
     Token name;
     std::string native_name;
-    std::vector<Shared<Parameter>> parameters;
-    Shared<amun::Type> return_type;
+    std::vector<Parameter*> parameters;
+    amun::Type* return_type;
     bool varargs;
-    Shared<amun::Type> varargs_type;
+    amun::Type* varargs_type;
 };
 
-class FunctionDeclaration : public Statement {
+class FunctionDeclaration : public StatementNode<FunctionDeclaration> {
   public:
-    FunctionDeclaration(Shared<FunctionPrototype> prototype, Shared<Statement> body)
+    FunctionDeclaration(FunctionPrototype* prototype, Statement* body)
         : prototype(std::move(prototype)), body(std::move(body))
     {
     }
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
-
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_FUNCTION; }
 
-    Shared<FunctionPrototype> prototype;
-    Shared<Statement> body;
+    FunctionPrototype* prototype;
+    Statement* body;
 };
 
-class OperatorFunctionDeclaraion : public Statement {
+class OperatorFunctionDeclaraion : public StatementNode<OperatorFunctionDeclaraion> {
   public:
-    OperatorFunctionDeclaraion(Token op, Shared<FunctionDeclaration> function)
+    OperatorFunctionDeclaraion(Token op, FunctionDeclaration* function)
         : op(std::move(op)), function(std::move(function))
     {
     }
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
-
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_OPERATOR_FUNCTION; }
 
     Token op;
-    Shared<FunctionDeclaration> function;
+    FunctionDeclaration* function;
 };
 
-class StructDeclaration : public Statement {
+class StructDeclaration : public StatementNode<StructDeclaration> {
   public:
-    explicit StructDeclaration(Shared<amun::StructType> type) : struct_type(std::move(type)) {}
-
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    explicit StructDeclaration(amun::StructType* type) : struct_type(type) {}
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_STRUCT; }
 
-    Shared<amun::StructType> struct_type;
+    amun::StructType* struct_type;
 };
 
-class EnumDeclaration : public Statement {
+class EnumDeclaration : public StatementNode<EnumDeclaration> {
   public:
-    EnumDeclaration(Token name, Shared<amun::EnumType> type)
-        : name(std::move(name)), enum_type(type)
+    EnumDeclaration(Token name, amun::EnumType* type) : name(std::move(name)), enum_type(type)
     {
     }
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
-
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_ENUM; }
 
     Token name;
-    Shared<amun::Type> enum_type;
+    amun::Type* enum_type;
 };
 
 class ConditionalBlock {
   public:
-    ConditionalBlock(Token position, Shared<Expression> condition, Shared<Statement> body)
+    ConditionalBlock(Token position, Expression* condition, Statement* body)
         : position(std::move(position)), condition(std::move(condition)), body(std::move(body))
     {
     }
 
     Token position;
-    Shared<Expression> condition;
-    Shared<Statement> body;
+    Expression* condition;
+    Statement* body;
 };
 
-class IfStatement : public Statement {
+class IfStatement : public StatementNode<IfStatement> {
   public:
-    IfStatement(std::vector<Shared<ConditionalBlock>> conditional_blocks, bool has_else)
+    IfStatement(std::vector<ConditionalBlock*> conditional_blocks, bool has_else)
         : conditional_blocks(std::move(conditional_blocks)), has_else(has_else)
     {
     }
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
-
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_IF_STATEMENT; }
 
-    std::vector<Shared<ConditionalBlock>> conditional_blocks;
+    std::vector<ConditionalBlock*> conditional_blocks;
     bool has_else;
 };
 
-class ForRangeStatement : public Statement {
+// Optimizer hints declared by the loop directives, zero count or width means no hint
+class LoopHints {
   public:
-    ForRangeStatement(Token position, std::string element_name, Shared<Expression> range_start,
-                      Shared<Expression> range_end, Shared<Expression> step, Shared<Statement> body)
+    auto has_hints() const -> bool
+    {
+        return unroll_count != 0 || unroll_full || vectorize_width != 0 ||
+               interleave_count != 0 || no_vectorize;
+    }
+
+    uint32 unroll_count = 0;
+    bool unroll_full = false;
+    uint32 vectorize_width = 0;
+    uint32 interleave_count = 0;
+    bool no_vectorize = false;
+};
+
+class ForRangeStatement : public StatementNode<ForRangeStatement> {
+  public:
+    ForRangeStatement(Token position, std::string element_name, Expression* range_start,
+                      Expression* range_end, Expression* step, Statement* body)
         : position(std::move(position)), element_name(std::move(element_name)),
           range_start(std::move(range_start)), range_end(std::move(range_end)),
           step(std::move(step)), body(std::move(body))
     {
     }
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
-
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_FOR_RANGE; }
 
     Token position;
     std::string element_name;
-    Shared<Expression> range_start;
-    Shared<Expression> range_end;
-    Shared<Expression> step;
-    Shared<Statement> body;
+    Expression* range_start;
+    Expression* range_end;
+    Expression* step;
+    Statement* body;
+    LoopHints hints;
 };
 
-class ForEachStatement : public Statement {
+class ForEachStatement : public StatementNode<ForEachStatement> {
   public:
     ForEachStatement(Token position, std::string element_name, std::string index_name,
-                     Shared<Expression> collection, Shared<Statement> body)
+                     Expression* collection, Statement* body)
         : position(std::move(position)), element_name(std::move(element_name)),
           index_name(std::move(index_name)), collection(std::move(collection)), body(body)
     {
     }
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
-
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_FOR_RANGE; }
 
     Token position;
     std::string element_name;
     std::string index_name;
-    Shared<Expression> collection;
-    Shared<Statement> body;
+    Expression* collection;
+    Statement* body;
+    LoopHints hints;
 };
 
-class ForeverStatement : public Statement {
+class ForeverStatement : public StatementNode<ForeverStatement> {
   public:
-    ForeverStatement(Token position, Shared<Statement> body)
+    ForeverStatement(Token position, Statement* body)
         : position(std::move(position)), body(std::move(body))
     {
     }
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
-
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_FOR_EVER; }
 
     Token position;
-    Shared<Statement> body;
+    Statement* body;
+    LoopHints hints;
 };
 
-class WhileStatement : public Statement {
+class WhileStatement : public StatementNode<WhileStatement> {
   public:
-    WhileStatement(Token position, Shared<Expression> condition, Shared<Statement> body)
+    WhileStatement(Token position, Expression* condition, Statement* body)
         : keyword(std::move(position)), condition(std::move(condition)), body(std::move(body))
     {
     }
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
-
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_WHILE; }
 
     Token keyword;
-    Shared<Expression> condition;
-    Shared<Statement> body;
+    Expression* condition;
+    Statement* body;
+    LoopHints hints;
 };
 
 class SwitchCase {
   public:
-    SwitchCase(Token position, std::vector<Shared<Expression>> values, Shared<Statement> body)
+    SwitchCase(Token position, std::vector<Expression*> values, Statement* body)
         : position(std::move(position)), values(std::move(values)), body(std::move(body))
     {
     }
 
     Token position;
-    std::vector<Shared<Expression>> values;
-    Shared<Statement> body;
+    std::vector<Expression*> values;
+    Statement* body;
 };
 
-class SwitchStatement : public Statement {
+class SwitchStatement : public StatementNode<SwitchStatement> {
   public:
-    SwitchStatement(Token position, Shared<Expression> argument,
-                    std::vector<Shared<SwitchCase>> cases, TokenKind op, bool has_default_case)
+    SwitchStatement(Token position, Expression* argument,
+                    std::vector<SwitchCase*> cases, TokenKind op, bool has_default_case)
         : keyword(std::move(position)), argument(std::move(argument)), cases(std::move(cases)),
           op(op), has_default_case(has_default_case)
     {
     }
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
-
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_SWITCH_STATEMENT; }
 
     Token keyword;
-    Shared<Expression> argument;
-    std::vector<Shared<SwitchCase>> cases;
+    Expression* argument;
+    std::vector<SwitchCase*> cases;
     TokenKind op = TokenKind::TOKEN_EQUAL_EQUAL;
 
     bool has_default_case = false;
     bool should_perform_complete_check = false;
 };
 
-class ReturnStatement : public Statement {
+class ReturnStatement : public StatementNode<ReturnStatement> {
   public:
-    ReturnStatement(Token position, Shared<Expression> value, bool contain_value)
+    ReturnStatement(Token position, Expression* value, bool contain_value)
         : keyword(std::move(position)), value(std::move(value)), has_value(contain_value)
     {
     }
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
-
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_RETURN; }
 
     Token keyword;
-    Shared<Expression> value;
+    Expression* value;
     bool has_value;
 };
 
-class DeferStatement : public Statement {
+class DeferStatement : public StatementNode<DeferStatement> {
   public:
-    explicit DeferStatement(Shared<CallExpression> call) : call_expression(std::move(call)) {}
-
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    explicit DeferStatement(CallExpression* call) : call_expression(std::move(call)) {}
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_DEFER; }
 
-    Shared<CallExpression> call_expression;
+    CallExpression* call_expression;
 };
 
-class BreakStatement : public Statement {
+class BreakStatement : public StatementNode<BreakStatement> {
   public:
     BreakStatement(Token token, bool has_times, int times)
         : keyword(std::move(token)), has_times(has_times), times(times)
     {
     }
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
-
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_BREAK; }
 
     Token keyword;
@@ -449,15 +479,13 @@ class BreakStatement : public Statement {
     int times;
 };
 
-class ContinueStatement : public Statement {
+class ContinueStatement : public StatementNode<ContinueStatement> {
   public:
     ContinueStatement(Token token, bool has_times, int times)
         : keyword(std::move(token)), has_times(has_times), times(times)
     {
     }
 
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
-
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_CONTINUE; }
 
     Token keyword;
@@ -465,36 +493,30 @@ class ContinueStatement : public Statement {
     int times;
 };
 
-class ExpressionStatement : public Statement {
+class ExpressionStatement : public StatementNode<ExpressionStatement> {
   public:
-    explicit ExpressionStatement(Shared<Expression> expression) : expression(std::move(expression))
-    {
-    }
-
-    auto accept(StatementVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    explicit ExpressionStatement(Expression* expression) : expression(std::move(expression)) {}
 
     auto get_ast_node_type() -> AstNodeType override
     {
         return AstNodeType::AST_EXPRESSION_STATEMENT;
     }
 
-    Shared<Expression> expression;
+    Expression* expression;
 };
 
-class IfExpression : public Expression {
+class IfExpression : public ExpressionNode<IfExpression> {
   public:
-    IfExpression(std::vector<Token> tokens, std::vector<Shared<Expression>> conditions,
-                 std::vector<Shared<Expression>> values)
+    IfExpression(std::vector<Token> tokens, std::vector<Expression*> conditions,
+                 std::vector<Expression*> values)
         : tokens(std::move(tokens)), conditions(std::move(conditions)), values(std::move(values))
     {
         type = amun::none_type;
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
-
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { type = new_type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { type = new_type; }
 
     auto is_constant() -> bool override
     {
@@ -516,17 +538,17 @@ class IfExpression : public Expression {
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_IF_EXPRESSION; }
 
     std::vector<Token> tokens;
-    std::vector<Shared<Expression>> conditions;
-    std::vector<Shared<Expression>> values;
-    Shared<amun::Type> type;
+    std::vector<Expression*> conditions;
+    std::vector<Expression*> values;
+    amun::Type* type;
 };
 
-class SwitchExpression : public Expression {
+class SwitchExpression : public ExpressionNode<SwitchExpression> {
   public:
-    SwitchExpression(Token switch_token, Shared<Expression> argument,
-                     std::vector<Shared<Expression>> switch_cases,
-                     std::vector<Shared<Expression>> switch_cases_values,
-                     Shared<Expression> default_value, TokenKind op)
+    SwitchExpression(Token switch_token, Expression* argument,
+                     std::vector<Expression*> switch_cases,
+                     std::vector<Expression*> switch_cases_values,
+                     Expression* default_value, TokenKind op)
         : keyword(std::move(switch_token)), argument(std::move(argument)),
           switch_cases(std::move(switch_cases)), switch_cases_values(switch_cases_values),
           default_value(std::move(default_value)), op(op)
@@ -534,11 +556,9 @@ class SwitchExpression : public Expression {
         type = switch_cases_values[0]->get_type_node();
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { type = new_type; }
-
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { type = new_type; }
 
     auto is_constant() -> bool override
     {
@@ -563,239 +583,219 @@ class SwitchExpression : public Expression {
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_SWITCH_EXPRESSION; }
 
     Token keyword;
-    Shared<Expression> argument;
-    std::vector<Shared<Expression>> switch_cases;
-    std::vector<Shared<Expression>> switch_cases_values;
-    Shared<Expression> default_value;
-    Shared<amun::Type> type;
+    Expression* argument;
+    std::vector<Expression*> switch_cases;
+    std::vector<Expression*> switch_cases_values;
+    Expression* default_value;
+    amun::Type* type;
     TokenKind op;
 };
 
-class TupleExpression : public Expression {
+class TupleExpression : public ExpressionNode<TupleExpression> {
   public:
-    TupleExpression(Token position, std::vector<Shared<Expression>> values)
+    TupleExpression(Token position, std::vector<Expression*> values)
         : position(std::move(position)), values(std::move(values))
     {
         type = amun::none_type;
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
-
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { type = new_type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { type = new_type; }
 
     auto is_constant() -> bool override { return true; }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_TUPLE; }
 
     Token position;
-    std::vector<Shared<Expression>> values;
-    Shared<amun::Type> type;
+    std::vector<Expression*> values;
+    amun::Type* type;
 };
 
-class AssignExpression : public Expression {
+class AssignExpression : public ExpressionNode<AssignExpression> {
   public:
-    AssignExpression(Shared<Expression> left, Token token, Shared<Expression> right)
+    AssignExpression(Expression* left, Token token, Expression* right)
         : left(std::move(left)), operator_token(std::move(token)), right(right)
     {
         type = right->get_type_node();
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    void set_type_node(Shared<amun::Type> new_type) override { type = new_type; }
-
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    void set_type_node(amun::Type* new_type) override { type = new_type; }
 
     auto is_constant() -> bool override { return false; }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_ASSIGN; }
 
-    Shared<Expression> left;
+    Expression* left;
     Token operator_token;
-    Shared<Expression> right;
-    Shared<amun::Type> type;
+    Expression* right;
+    amun::Type* type;
 };
 
-class BinaryExpression : public Expression {
+class BinaryExpression : public ExpressionNode<BinaryExpression> {
   public:
-    BinaryExpression(Shared<Expression> left, Token token, Shared<Expression> right)
+    BinaryExpression(Expression* left, Token token, Expression* right)
         : left(std::move(left)), operator_token(std::move(token)), right(right)
     {
         type = right->get_type_node();
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
-
-    void set_type_node(Shared<amun::Type> new_type) override { type = new_type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    void set_type_node(amun::Type* new_type) override { type = new_type; }
 
     auto is_constant() -> bool override { return left->is_constant() and right->is_constant(); }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_BINARY; }
 
-    Shared<Expression> left;
+    Expression* left;
     Token operator_token;
-    Shared<Expression> right;
-    Shared<amun::Type> type;
+    Expression* right;
+    amun::Type* type;
 };
 
-class BitwiseExpression : public Expression {
+class BitwiseExpression : public ExpressionNode<BitwiseExpression> {
   public:
-    BitwiseExpression(Shared<Expression> left, Token token, Shared<Expression> right)
+    BitwiseExpression(Expression* left, Token token, Expression* right)
         : left(std::move(left)), operator_token(std::move(token)), right(right)
     {
         type = right->get_type_node();
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
-
-    void set_type_node(Shared<amun::Type> new_type) override { type = new_type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    void set_type_node(amun::Type* new_type) override { type = new_type; }
 
     auto is_constant() -> bool override { return left->is_constant() and right->is_constant(); }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_BITWISE; }
 
-    Shared<Expression> left;
+    Expression* left;
     Token operator_token;
-    Shared<Expression> right;
-    Shared<amun::Type> type;
+    Expression* right;
+    amun::Type* type;
 };
 
-class ComparisonExpression : public Expression {
+class ComparisonExpression : public ExpressionNode<ComparisonExpression> {
   public:
-    ComparisonExpression(Shared<Expression> left, Token token, Shared<Expression> right)
+    ComparisonExpression(Expression* left, Token token, Expression* right)
         : left(std::move(left)), operator_token(std::move(token)), right(std::move(right))
     {
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    void set_type_node(Shared<amun::Type> new_type) override { type = new_type; }
-
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    void set_type_node(amun::Type* new_type) override { type = new_type; }
 
     auto is_constant() -> bool override { return left->is_constant() and right->is_constant(); }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_COMPARISON; }
 
-    Shared<Expression> left;
+    Expression* left;
     Token operator_token;
-    Shared<Expression> right;
-    Shared<amun::Type> type = amun::i1_type;
+    Expression* right;
+    amun::Type* type = amun::i1_type;
 };
 
-class LogicalExpression : public Expression {
+class LogicalExpression : public ExpressionNode<LogicalExpression> {
   public:
-    LogicalExpression(Shared<Expression> left, Token token, Shared<Expression> right)
+    LogicalExpression(Expression* left, Token token, Expression* right)
         : left(std::move(left)), operator_token(token), right(right)
     {
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
-
-    void set_type_node(Shared<amun::Type> new_type) override { type = new_type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    void set_type_node(amun::Type* new_type) override { type = new_type; }
 
     auto is_constant() -> bool override { return left->is_constant() and right->is_constant(); }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_LOGICAL; }
 
-    Shared<Expression> left;
+    Expression* left;
     Token operator_token;
-    Shared<Expression> right;
-    Shared<amun::Type> type = amun::i1_type;
+    Expression* right;
+    amun::Type* type = amun::i1_type;
 };
 
-class PrefixUnaryExpression : public Expression {
+class PrefixUnaryExpression : public ExpressionNode<PrefixUnaryExpression> {
   public:
-    PrefixUnaryExpression(Token token, Shared<Expression> right)
+    PrefixUnaryExpression(Token token, Expression* right)
         : operator_token(std::move(token)), right(right), type(right->get_type_node())
     {
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
-
-    void set_type_node(Shared<amun::Type> new_type) override { type = new_type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    void set_type_node(amun::Type* new_type) override { type = new_type; }
 
     auto is_constant() -> bool override { return right->is_constant(); }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_PREFIX_UNARY; }
 
     Token operator_token;
-    Shared<Expression> right;
-    Shared<amun::Type> type;
+    Expression* right;
+    amun::Type* type;
 };
 
-class PostfixUnaryExpression : public Expression {
+class PostfixUnaryExpression : public ExpressionNode<PostfixUnaryExpression> {
   public:
-    PostfixUnaryExpression(Token token, Shared<Expression> right)
+    PostfixUnaryExpression(Token token, Expression* right)
         : operator_token(std::move(token)), right(right), type(right->get_type_node())
     {
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    void set_type_node(Shared<amun::Type> new_type) override { type = new_type; }
-
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    void set_type_node(amun::Type* new_type) override { type = new_type; }
 
     auto is_constant() -> bool override { return right->is_constant(); }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_POSTFIX_UNARY; }
 
     Token operator_token;
-    Shared<Expression> right;
-    Shared<amun::Type> type;
+    Expression* right;
+    amun::Type* type;
 };
 
-class CallExpression : public Expression {
+class CallExpression : public ExpressionNode<CallExpression> {
   public:
-    CallExpression(Token position, Shared<Expression> callee,
-                   std::vector<Shared<Expression>> arguments,
-                   std::vector<Shared<amun::Type>> generic_arguments = {})
+    CallExpression(Token position, Expression* callee,
+                   std::vector<Expression*> arguments,
+                   std::vector<amun::Type*> generic_arguments = {})
         : position(std::move(position)), callee(callee), arguments(std::move(arguments)),
           type(callee->get_type_node()), generic_arguments(std::move(generic_arguments))
     {
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
-
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { type = new_type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { type = new_type; }
 
     auto is_constant() -> bool override { return false; }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_CALL; }
 
     Token position;
-    Shared<Expression> callee;
-    std::vector<Shared<Expression>> arguments;
-    Shared<amun::Type> type;
-    std::vector<Shared<amun::Type>> generic_arguments;
+    Expression* callee;
+    std::vector<Expression*> arguments;
+    amun::Type* type;
+    std::vector<amun::Type*> generic_arguments;
 };
 
-class InitializeExpression : public Expression {
+class InitializeExpression : public ExpressionNode<InitializeExpression> {
   public:
-    InitializeExpression(Token position, Shared<amun::Type> type,
-                         std::vector<Shared<Expression>> arguments)
-        : position(std::move(position)), type(std::move(type)), arguments(std::move(arguments))
+    InitializeExpression(Token position, amun::Type* type,
+                         std::vector<Expression*> arguments)
+        : position(std::move(position)), type(type), arguments(std::move(arguments))
     {
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
-
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { type = new_type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { type = new_type; }
 
     auto is_constant() -> bool override
     {
@@ -810,56 +810,47 @@ class InitializeExpression : public Expression {
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_INIT; }
 
     Token position;
-    Shared<amun::Type> type;
-    std::vector<Shared<Expression>> arguments;
+    amun::Type* type;
+    std::vector<Expression*> arguments;
 };
 
-class LambdaExpression : public Expression {
+class LambdaExpression : public ExpressionNode<LambdaExpression> {
   public:
-    LambdaExpression(Token position, std::vector<Shared<Parameter>> parameters,
-                     Shared<amun::Type> return_type, Shared<BlockStatement> body)
+    LambdaExpression(Token position, std::vector<Parameter*> parameters,
+                     amun::Type* return_type, BlockStatement* body, amun::Type* lambda_type)
         : position(std::move(position)), explicit_parameters(std::move(parameters)),
-          return_type(return_type), body(std::move(body))
+          return_type(return_type), body(std::move(body)), lambda_type(lambda_type)
     {
-        std::vector<Shared<amun::Type>> parameters_types;
-        auto function_type =
-            std::make_shared<amun::FunctionType>(position, parameters_types, return_type);
-
-        lambda_type = std::make_shared<amun::PointerType>(function_type);
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return lambda_type; }
-
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { lambda_type = new_type; }
+    auto get_type_node() -> amun::Type* override { return lambda_type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { lambda_type = new_type; }
 
     auto is_constant() -> bool override { return true; }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_LAMBDA; }
 
     Token position;
-    std::vector<Shared<Parameter>> explicit_parameters;
+    std::vector<Parameter*> explicit_parameters;
     std::vector<std::string> implict_parameters_names;
-    std::vector<Shared<amun::Type>> implict_parameters_types;
-    Shared<amun::Type> return_type;
-    Shared<BlockStatement> body;
-    Shared<amun::Type> lambda_type;
+    std::vector<amun::Type*> implict_parameters_types;
+    amun::Type* return_type;
+    BlockStatement* body;
+    amun::Type* lambda_type;
 };
 
-class DotExpression : public Expression {
+class DotExpression : public ExpressionNode<DotExpression> {
   public:
-    DotExpression(Token dot_token, Shared<Expression> callee, Token field_name)
+    DotExpression(Token dot_token, Expression* callee, Token field_name)
         : dot_token(std::move(dot_token)), callee(std::move(callee)),
           field_name(std::move(field_name))
     {
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { type = new_type; }
-
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { type = new_type; }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_DOT; }
 
@@ -869,122 +860,110 @@ class DotExpression : public Expression {
     bool is_constants_ = false;
 
     Token dot_token;
-    Shared<Expression> callee;
+    Expression* callee;
     Token field_name;
-    Shared<amun::Type> type;
+    amun::Type* type = nullptr;
 };
 
-class CastExpression : public Expression {
+class CastExpression : public ExpressionNode<CastExpression> {
   public:
-    CastExpression(Token position, Shared<amun::Type> type, Shared<Expression> value)
-        : position(std::move(position)), type(std::move(type)), value(std::move(value))
+    CastExpression(Token position, amun::Type* type, Expression* value)
+        : position(std::move(position)), type(type), value(std::move(value))
     {
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
-
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { type = new_type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { type = new_type; }
 
     auto is_constant() -> bool override { return value->is_constant(); }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_CAST; }
 
     Token position;
-    Shared<amun::Type> type;
-    Shared<Expression> value;
+    amun::Type* type;
+    Expression* value;
 };
 
-class TypeSizeExpression : public Expression {
+class TypeSizeExpression : public ExpressionNode<TypeSizeExpression> {
   public:
-    explicit TypeSizeExpression(Shared<amun::Type> type) : type(std::move(type)) {}
-
-    auto get_type_node() -> Shared<amun::Type> override { return amun::i64_type; }
+    explicit TypeSizeExpression(amun::Type* type) : type(type) {}
 
-    auto set_type_node(Shared<amun::Type> new_type) -> void override {}
+    auto get_type_node() -> amun::Type* override { return amun::i64_type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override {}
 
     auto is_constant() -> bool override { return true; }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_TYPE_SIZE; }
 
-    Shared<amun::Type> type;
+    amun::Type* type;
 };
 
-class TypeAlignExpression : public Expression {
+class TypeAlignExpression : public ExpressionNode<TypeAlignExpression> {
   public:
-    explicit TypeAlignExpression(Shared<amun::Type> type) : type(std::move(type)) {}
+    explicit TypeAlignExpression(amun::Type* type) : type(type) {}
 
-    auto get_type_node() -> Shared<amun::Type> override { return amun::i64_type; }
+    auto get_type_node() -> amun::Type* override { return amun::i64_type; }
 
-    auto set_type_node(Shared<amun::Type> new_type) -> void override {}
-
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override {}
 
     auto is_constant() -> bool override { return true; }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_TYPE_SIZE; }
 
-    Shared<amun::Type> type;
+    amun::Type* type;
 };
 
-class ValueSizeExpression : public Expression {
+class ValueSizeExpression : public ExpressionNode<ValueSizeExpression> {
   public:
-    explicit ValueSizeExpression(Shared<Expression> value) : value(std::move(value)) {}
-
-    auto get_type_node() -> Shared<amun::Type> override { return amun::i64_type; }
+    explicit ValueSizeExpression(Expression* value) : value(std::move(value)) {}
 
-    void set_type_node(Shared<amun::Type> new_type) override {}
+    auto get_type_node() -> amun::Type* override { return amun::i64_type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    void set_type_node(amun::Type* new_type) override {}
 
     auto is_constant() -> bool override { return true; }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_VALUE_SIZE; }
 
-    Shared<Expression> value;
+    Expression* value;
 };
 
-class IndexExpression : public Expression {
+class IndexExpression : public ExpressionNode<IndexExpression> {
   public:
-    IndexExpression(Token position, Shared<Expression> value, Shared<Expression> index)
+    IndexExpression(Token position, Expression* value, Expression* index)
         : position(std::move(position)), value(std::move(value)), index(std::move(index))
     {
-        type = std::make_shared<amun::NoneType>();
+        type = amun::none_type;
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { type = new_type; }
-
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { type = new_type; }
 
     auto is_constant() -> bool override { return index->is_constant(); }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_INDEX; }
 
     Token position;
-    Shared<Expression> value;
-    Shared<Expression> index;
-    Shared<amun::Type> type;
+    Expression* value;
+    Expression* index;
+    amun::Type* type;
 };
 
-class EnumAccessExpression : public Expression {
+class EnumAccessExpression : public ExpressionNode<EnumAccessExpression> {
   public:
     EnumAccessExpression(Token enum_name, Token element_name, int index,
-                         Shared<amun::Type> element_type)
+                         amun::Type* element_type)
         : enum_name(std::move(enum_name)), element_name(std::move(element_name)),
           enum_element_index(index), element_type(std::move(element_type))
     {
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return element_type; }
-
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { element_type = new_type; }
+    auto get_type_node() -> amun::Type* override { return element_type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { element_type = new_type; }
 
     auto is_constant() -> bool override { return true; }
 
@@ -993,18 +972,14 @@ class EnumAccessExpression : public Expression {
     Token enum_name;
     Token element_name;
     int enum_element_index;
-    Shared<amun::Type> element_type;
+    amun::Type* element_type;
 };
 
-class ArrayExpression : public Expression {
+class ArrayExpression : public ExpressionNode<ArrayExpression> {
   public:
-    ArrayExpression(Token position, std::vector<Shared<Expression>> values)
-        : position(std::move(position)), values(values)
+    ArrayExpression(Token position, std::vector<Expression*> values, amun::Type* type)
+        : position(std::move(position)), values(values), type(type)
     {
-        auto size = values.size();
-        auto element_type = size == 0 ? amun::none_type : values[0]->get_type_node();
-        type = std::make_shared<amun::StaticArrayType>(element_type, size);
-
         // Check if all values of array are constant or not
         for (auto& value : values) {
             if (!value->is_constant()) {
@@ -1014,71 +989,63 @@ class ArrayExpression : public Expression {
         }
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { type = new_type; }
-
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { type = new_type; }
 
     auto is_constant() -> bool override { return is_constants_array; }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_ARRAY; }
 
     Token position;
-    std::vector<Shared<Expression>> values;
-    Shared<amun::Type> type;
+    std::vector<Expression*> values;
+    amun::Type* type;
     bool is_constants_array = true;
+
+    // Instances of generic function share the same node, so the array type of each instance is
+    // saved by its generic arguments
+    std::map<std::vector<amun::Type*>, amun::Type*> generic_instances_types;
 };
 
-class VectorExpression : public Expression {
+class VectorExpression : public ExpressionNode<VectorExpression> {
   public:
-    explicit VectorExpression(Shared<ArrayExpression> array) : array(std::move(array)) {}
+    VectorExpression(ArrayExpression* array, amun::Type* type) : array(array), type(type) {}
 
-    auto get_type_node() -> Shared<amun::Type> override
-    {
-        auto type = array->get_type_node();
-        auto array_type = std::static_pointer_cast<amun::StaticArrayType>(type);
-        return std::make_shared<amun::StaticVectorType>(array_type);
-    }
-
-    auto set_type_node(Shared<amun::Type> type) -> void override { array->set_type_node(type); }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { type = new_type; }
 
     auto is_constant() -> bool override { return array->is_constant(); }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_VECTOR; }
 
-    Shared<ArrayExpression> array;
+    ArrayExpression* array;
+    amun::Type* type;
 };
 
-class StringExpression : public Expression {
+class StringExpression : public ExpressionNode<StringExpression> {
   public:
     explicit StringExpression(Token value) : value(std::move(value)) {}
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { type = new_type; }
-
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { type = new_type; }
 
     auto is_constant() -> bool override { return true; }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_STRING; }
 
     Token value;
-    Shared<amun::Type> type = amun::i8_ptr_type;
+    amun::Type* type = amun::i8_ptr_type;
 };
 
-class LiteralExpression : public Expression {
+class LiteralExpression : public ExpressionNode<LiteralExpression> {
   public:
     explicit LiteralExpression(Token name) : name(std::move(name)) {}
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
-
-    void set_type_node(Shared<amun::Type> new_type) override { type = new_type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    void set_type_node(amun::Type* new_type) override { type = new_type; }
 
     void set_constant(bool is_constants) { constants = is_constants; }
 
@@ -1087,117 +1054,104 @@ class LiteralExpression : public Expression {
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_LITERAL; }
 
     Token name;
-    Shared<amun::Type> type = amun::none_type;
+    amun::Type* type = amun::none_type;
     bool constants = false;
 };
 
-class NumberExpression : public Expression {
+class NumberExpression : public ExpressionNode<NumberExpression> {
   public:
-    NumberExpression(Token value, Shared<amun::Type> type)
-        : value(std::move(value)), type(std::move(type))
+    NumberExpression(Token value, amun::Type* type) : value(std::move(value)), type(type)
     {
     }
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
-
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { type = new_type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { type = new_type; }
 
     auto is_constant() -> bool override { return true; }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_NUMBER; }
 
     Token value;
-    Shared<amun::Type> type;
+    amun::Type* type;
 };
 
-class CharacterExpression : public Expression {
+class CharacterExpression : public ExpressionNode<CharacterExpression> {
   public:
     explicit CharacterExpression(Token value) : value(std::move(value)) {}
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { type = new_type; }
-
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { type = new_type; }
 
     auto is_constant() -> bool override { return true; }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_CHARACTER; }
 
     Token value;
-    Shared<amun::Type> type = amun::i8_type;
+    amun::Type* type = amun::i8_type;
 };
 
-class BooleanExpression : public Expression {
+class BooleanExpression : public ExpressionNode<BooleanExpression> {
   public:
     explicit BooleanExpression(Token value) : value(std::move(value)) {}
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
-
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { type = new_type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { type = new_type; }
 
     auto is_constant() -> bool override { return true; }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_BOOL; }
 
     Token value;
-    Shared<amun::Type> type = amun::i1_type;
+    amun::Type* type = amun::i1_type;
 };
 
-class NullExpression : public Expression {
+class NullExpression : public ExpressionNode<NullExpression> {
   public:
     explicit NullExpression(Token value) : value(std::move(value)) {}
 
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
-
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { type = new_type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { type = new_type; }
 
     auto is_constant() -> bool override { return true; }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_NULL; }
 
     Token value;
-    Shared<amun::Type> type = amun::null_type;
-    Shared<amun::Type> null_base_type = amun::i32_ptr_type;
+    amun::Type* type = amun::null_type;
+    amun::Type* null_base_type = amun::i32_ptr_type;
 };
 
-class UndefinedExpression : public Expression {
+class UndefinedExpression : public ExpressionNode<UndefinedExpression> {
   public:
     explicit UndefinedExpression(Token keyword) : keyword(std::move(keyword)) {}
 
-    auto get_type_node() -> Shared<amun::Type> override { return base_type; }
+    auto get_type_node() -> amun::Type* override { return base_type; }
 
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { base_type = new_type; }
-
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { base_type = new_type; }
 
     auto is_constant() -> bool override { return true; }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_UNDEFINED; }
 
     Token keyword;
-    Shared<amun::Type> base_type = amun::none_type;
+    amun::Type* base_type = amun::none_type;
 };
 
-class InfinityExpression : public Expression {
+class InfinityExpression : public ExpressionNode<InfinityExpression> {
   public:
-    explicit InfinityExpression(Shared<amun::Type> type) : type(std::move(type)) {}
-
-    auto get_type_node() -> Shared<amun::Type> override { return type; }
+    explicit InfinityExpression(amun::Type* type) : type(type) {}
 
-    auto set_type_node(Shared<amun::Type> new_type) -> void override { type = new_type; }
+    auto get_type_node() -> amun::Type* override { return type; }
 
-    auto accept(ExpressionVisitor* visitor) -> std::any override { return visitor->visit(this); }
+    auto set_type_node(amun::Type* new_type) -> void override { type = new_type; }
 
     auto is_constant() -> bool override { return true; }
 
     auto get_ast_node_type() -> AstNodeType override { return AstNodeType::AST_INFINITY; }
 
-    Shared<amun::Type> type;
+    amun::Type* type;
 };
\ No newline at end of file
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "amun_arena.hpp"
+
+namespace amun {
+
+// Arena that owns all the AST nodes
+class AstContext : public Arena {};
+
+} // namespace amun
@@ -1,8 +1,5 @@
 #pragma once
 
-#include <any>
-#include <memory>
-
 class BlockStatement;
 class FieldDeclaration;
 class DestructuringDeclaraion;
@@ -25,49 +22,50 @@ class BreakStatement;
 class ContinueStatement;
 class ExpressionStatement;
 
+template <typename R>
 class StatementVisitor {
   public:
-    virtual auto visit(BlockStatement* node) -> std::any = 0;
+    virtual auto visit(BlockStatement* node) -> R = 0;
 
-    virtual auto visit(FieldDeclaration* node) -> std::any = 0;
+    virtual auto visit(FieldDeclaration* node) -> R = 0;
 
-    virtual auto visit(DestructuringDeclaraion* node) -> std::any = 0;
+    virtual auto visit(DestructuringDeclaraion* node) -> R = 0;
 
-    virtual auto visit(ConstDeclaration* node) -> std::any = 0;
+    virtual auto visit(ConstDeclaration* node) -> R = 0;
 
-    virtual auto visit(FunctionPrototype* node) -> std::any = 0;
+    virtual auto visit(FunctionPrototype* node) -> R = 0;
 
-    virtual auto visit(OperatorFunctionDeclaraion* node) -> std::any = 0;
+    virtual auto visit(OperatorFunctionDeclaraion* node) -> R = 0;
 
-    virtual auto visit(IntrinsicPrototype* node) -> std::any = 0;
+    virtual auto visit(IntrinsicPrototype* node) -> R = 0;
 
-    virtual auto visit(FunctionDeclaration* node) -> std::any = 0;
+    virtual auto visit(FunctionDeclaration* node) -> R = 0;
 
-    virtual auto visit(StructDeclaration* node) -> std::any = 0;
+    virtual auto visit(StructDeclaration* node) -> R = 0;
 
-    virtual auto visit(EnumDeclaration* node) -> std::any = 0;
+    virtual auto visit(EnumDeclaration* node) -> R = 0;
 
-    virtual auto visit(IfStatement* node) -> std::any = 0;
+    virtual auto visit(IfStatement* node) -> R = 0;
 
-    virtual auto visit(ForRangeStatement* node) -> std::any = 0;
+    virtual auto visit(ForRangeStatement* node) -> R = 0;
 
-    virtual auto visit(ForEachStatement* node) -> std::any = 0;
+    virtual auto visit(ForEachStatement* node) -> R = 0;
 
-    virtual auto visit(ForeverStatement* node) -> std::any = 0;
+    virtual auto visit(ForeverStatement* node) -> R = 0;
 
-    virtual auto visit(WhileStatement* node) -> std::any = 0;
+    virtual auto visit(WhileStatement* node) -> R = 0;
 
-    virtual auto visit(SwitchStatement* node) -> std::any = 0;
+    virtual auto visit(SwitchStatement* node) -> R = 0;
 
-    virtual auto visit(ReturnStatement* node) -> std::any = 0;
+    virtual auto visit(ReturnStatement* node) -> R = 0;
 
-    virtual auto visit(DeferStatement* node) -> std::any = 0;
+    virtual auto visit(DeferStatement* node) -> R = 0;
 
-    virtual auto visit(BreakStatement* node) -> std::any = 0;
+    virtual auto visit(BreakStatement* node) -> R = 0;
 
-    virtual auto visit(ContinueStatement* node) -> std::any = 0;
+    virtual auto visit(ContinueStatement* node) -> R = 0;
 
-    virtual auto visit(ExpressionStatement* node) -> std::any = 0;
+    virtual auto visit(ExpressionStatement* node) -> R = 0;
 };
 
 class IfExpression;
@@ -101,67 +99,69 @@ class NullExpression;
 class UndefinedExpression;
 class InfinityExpression;
 
+template <typename R>
 class ExpressionVisitor {
   public:
-    virtual auto visit(IfExpression* node) -> std::any = 0;
+    virtual auto visit(IfExpression* node) -> R = 0;
 
-    virtual auto visit(SwitchExpression* node) -> std::any = 0;
+    virtual auto visit(SwitchExpression* node) -> R = 0;
 
-    virtual auto visit(TupleExpression* node) -> std::any = 0;
+    virtual auto visit(TupleExpression* node) -> R = 0;
 
-    virtual auto visit(AssignExpression* node) -> std::any = 0;
+    virtual auto visit(AssignExpression* node) -> R = 0;
 
-    virtual auto visit(BinaryExpression* node) -> std::any = 0;
+    virtual auto visit(BinaryExpression* node) -> R = 0;
 
-    virtual auto visit(BitwiseExpression* node) -> std::any = 0;
+    virtual auto visit(BitwiseExpression* node) -> R = 0;
 
-    virtual auto visit(ComparisonExpression* node) -> std::any = 0;
+    virtual auto visit(ComparisonExpression* node) -> R = 0;
 
-    virtual auto visit(LogicalExpression* node) -> std::any = 0;
+    virtual auto visit(LogicalExpression* node) -> R = 0;
 
-    virtual auto visit(PrefixUnaryExpression* node) -> std::any = 0;
+    virtual auto visit(PrefixUnaryExpression* node) -> R = 0;
 
-    virtual auto visit(PostfixUnaryExpression* node) -> std::any = 0;
+    virtual auto visit(PostfixUnaryExpression* node) -> R = 0;
 
-    virtual auto visit(CallExpression* node) -> std::any = 0;
+    virtual auto visit(CallExpression* node) -> R = 0;
 
-    virtual auto visit(InitializeExpression* node) -> std::any = 0;
+    virtual auto visit(InitializeExpression* node) -> R = 0;
 
-    virtual auto visit(LambdaExpression* node) -> std::any = 0;
+    virtual auto visit(LambdaExpression* node) -> R = 0;
 
-    virtual auto visit(DotExpression* node) -> std::any = 0;
+    virtual auto visit(DotExpression* node) -> R = 0;
 
-    virtual auto visit(CastExpression* node) -> std::any = 0;
+    virtual auto visit(CastExpression* node) -> R = 0;
 
-    virtual auto visit(TypeSizeExpression* node) -> std::any = 0;
+    virtual auto visit(TypeSizeExpression* node) -> R = 0;
 
-    virtual auto visit(TypeAlignExpression* node) -> std::any = 0;
+    virtual auto visit(TypeAlignExpression* node) -> R = 0;
 
-    virtual auto visit(ValueSizeExpression* node) -> std::any = 0;
+    virtual auto visit(ValueSizeExpression* node) -> R = 0;
 
-    virtual auto visit(IndexExpression* node) -> std::any = 0;
+    virtual auto visit(IndexExpression* node) -> R = 0;
 
-    virtual auto visit(EnumAccessExpression* node) -> std::any = 0;
+    virtual auto visit(EnumAccessExpression* node) -> R = 0;
 
-    virtual auto visit(LiteralExpression* node) -> std::any = 0;
+    virtual auto visit(LiteralExpression* node) -> R = 0;
 
-    virtual auto visit(NumberExpression* node) -> std::any = 0;
+    virtual auto visit(NumberExpression* node) -> R = 0;
 
-    virtual auto visit(StringExpression* node) -> std::any = 0;
+    virtual auto visit(StringExpression* node) -> R = 0;
 
-    virtual auto visit(ArrayExpression* node) -> std::any = 0;
+    virtual auto visit(ArrayExpression* node) -> R = 0;
 
-    virtual auto visit(VectorExpression* node) -> std::any = 0;
+    virtual auto visit(VectorExpression* node) -> R = 0;
 
-    virtual auto visit(CharacterExpression* node) -> std::any = 0;
+    virtual auto visit(CharacterExpression* node) -> R = 0;
 
-    virtual auto visit(BooleanExpression* node) -> std::any = 0;
+    virtual auto visit(BooleanExpression* node) -> R = 0;
 
-    virtual auto visit(NullExpression* node) -> std::any = 0;
+    virtual auto visit(NullExpression* node) -> R = 0;
 
-    virtual auto visit(UndefinedExpression* node) -> std::any = 0;
+    virtual auto visit(UndefinedExpression* node) -> R = 0;
 
-    virtual auto visit(InfinityExpression* node) -> std::any = 0;
+    virtual auto visit(InfinityExpression* node) -> R = 0;
 };
 
-class TreeVisitor : public StatementVisitor, public ExpressionVisitor {};
\ No newline at end of file
+template <typename R>
+class TreeVisitor : public StatementVisitor<R>, public ExpressionVisitor<R> {};
\ No newline at end of file
@@ -8,6 +8,7 @@
 // Language Information
 #define AMUN_LANGUAGE_EXTENSION ".amun"
 #define AMUN_LANGUAGE_VERSION "0.0.1"
+#define AMUN_MODULE_EXTENSION ".amunm"
 #define AMUN_LIBRARIES_PREFIX "../lib/"
 
 // Singed integers types
@@ -33,36 +34,6 @@ using Shared = std::shared_ptr<T>;
 template <class T>
 using Unique = std::unique_ptr<T>;
 
-// Compare two char* with length of 2
-#define str2Equals(first, other) first[0] == other[0] && first[1] == other[1]
-
-// Compare two char* with length of 3
-#define str3Equals(first, other) str2Equals(first, other) && first[2] == other[2]
-
-// Compare two char* with length of 4
-#define str4Equals(first, other) str3Equals(first, other) && first[3] == other[3]
-
-// Compare two char* with length of 5
-#define str5Equals(first, other) str4Equals(first, other) && first[4] == other[4]
-
-// Compare two char* with length of 6
-#define str6Equals(first, other) str5Equals(first, other) && first[5] == other[5]
-
-// Compare two char* with length of 7
-#define str7Equals(first, other) str6Equals(first, other) && first[6] == other[6]
-
-// Compare two char* with length of 8
-#define str8Equals(first, other) str7Equals(first, other) && first[7] == other[7]
-
-// Compare two char* with length of 9
-#define str9Equals(first, other) str8Equals(first, other) && first[8] == other[8]
-
-// Compare two char* with length of 10
-#define str10Equals(first, other) str9Equals(first, other) && first[9] == other[9]
-
-// Compare two char* with length of 11
-#define str11Equals(first, other) str10Equals(first, other) && first[10] == other[10]
-
 // Convert string to integer
 auto str_to_int(const char* p) -> int64;
 
@@ -90,10 +61,7 @@ auto index_of(const std::vector<T>& vec, const T& element) -> int
 template <typename T>
 auto append_vectors(std::vector<T>& vec, std::vector<T>& extra) -> void
 {
-    vec.reserve(vec.size() + extra.size());
-    for (auto element : extra) {
-        vec.push_back(element);
-    }
+    vec.insert(vec.end(), extra.begin(), extra.end());
 }
 
 template <typename... Args>
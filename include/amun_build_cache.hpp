@@ -0,0 +1,47 @@
+#pragma once
+
+#include "amun_basic.hpp"
+#include "amun_context.hpp"
+
+#include <llvm/Target/TargetMachine.h>
+
+#include <string>
+#include <vector>
+
+namespace amun {
+
+// Object files cached by the hash of everything that can change them, the sources contents,
+// the compiler options, the target and the compiler itself, so unchanged programs are not
+// compiled again, the least recently used entries are removed when the cache is full
+class BuildCache {
+  public:
+    BuildCache(std::string directory, uint64 max_size_in_bytes);
+
+    auto is_enabled() const -> bool { return !directory.empty(); }
+
+    // Hash of all source files registered while parsing and the options used to compile them
+    auto compute_key(amun::Context& context, llvm::TargetMachine* target_machine,
+                     const char* output_kind) -> std::string;
+
+    // Copy the cached objects to the objects paths, return false if any of them is not cached
+    auto restore_objects(const std::string& key, const std::vector<std::string>& objects_paths)
+        -> bool;
+
+    auto store_objects(const std::string& key, const std::vector<std::string>& objects_paths)
+        -> void;
+
+    // Print the number of entries, the cache size and the hits and misses count
+    auto report_statistics() -> void;
+
+  private:
+    auto entry_path(const std::string& key, size_t index) -> std::string;
+
+    auto record_lookup(bool is_hit) -> void;
+
+    auto evict_least_recently_used() -> void;
+
+    std::string directory;
+    uint64 max_size_in_bytes;
+};
+
+} // namespace amun
@@ -1,16 +1,25 @@
 #pragma once
 
 #include "../include/amun_ast.hpp"
+#include "../include/amun_build_cache.hpp"
 #include "../include/amun_context.hpp"
 
+#include <llvm/IR/Module.h>
+#include <llvm/Target/TargetMachine.h>
+
 #include <memory>
+#include <string>
 #include <unordered_set>
+#include <vector>
 
 namespace amun {
 
 class Compiler {
   public:
-    explicit Compiler(Shared<amun::Context> context) : context(std::move(context)) {}
+    explicit Compiler(Shared<amun::Context> context);
+
+    // Report the compilation time and write the time trace file if they are enabled
+    ~Compiler();
 
     auto compile_source_code(const char* source_file) -> int;
 
@@ -18,11 +27,48 @@ class Compiler {
 
     auto emit_llvm_ir_from_source_code(const char* source_file) -> int;
 
+    // Compile the source code in memory and execute the main function with the arguments
+    auto run_source_code(const char* source_file, const std::vector<std::string>& program_arguments)
+        -> int;
+
     auto check_source_code(const char* source_file) -> int;
 
-    auto parse_source_code(const char* source_file) -> Shared<CompilationUnit>;
+    auto parse_source_code(const char* source_file) -> CompilationUnit*;
 
   private:
+    // Create target machine for the host triple with the cpu, features and optimization options
+    auto create_target_machine() -> Unique<llvm::TargetMachine>;
+
+    auto create_build_cache() -> amun::BuildCache;
+
+    // Generate, optimize and emit the program objects, bitcode objects from the linker flags are
+    // linked into the program with link time optimization and removed from the flags
+    auto emit_program_object_files(const char* source_file, CompilationUnit* compilation_unit,
+                                   llvm::TargetMachine* target_machine,
+                                   std::vector<std::string>& linker_flags,
+                                   const std::vector<std::string>& object_files_paths) -> int;
+
+    // Generate, optimize and emit the source object or bitcode object with link time optimization
+    auto emit_source_object_file(const char* source_file, CompilationUnit* compilation_unit,
+                                 llvm::TargetMachine* target_machine,
+                                 const std::string& object_file_path) -> int;
+
+    auto set_module_target_attributes(llvm::Module& module, llvm::TargetMachine* target_machine)
+        -> void;
+
+    auto emit_object_file(llvm::Module& module, llvm::TargetMachine* target_machine,
+                          const std::string& object_file_path) -> int;
+
+    // Split the module into partitions and emit each one to object file on a separate thread
+    auto emit_object_files_in_parallel(llvm::Module& module, llvm::TargetMachine* target_machine,
+                                       const std::vector<std::string>& object_files_paths) -> int;
+
+    auto emit_bitcode_file(llvm::Module& module, const std::string& bitcode_file_path) -> int;
+
+    // Link bitcode object files from linker flags into the module and keep only the native flags
+    auto link_bitcode_object_files(llvm::Module& module, std::vector<std::string>& linker_flags)
+        -> int;
+
     Shared<amun::Context> context;
 };
 
@@ -8,11 +8,49 @@
 #define WARNS_TO_ERRORS_FLAG "-werr"
 #define LINKER_EXTREA_FLAG "-l"
 
+#define OPTIMIZATION_LEVEL_0_FLAG "-O0"
+#define OPTIMIZATION_LEVEL_1_FLAG "-O1"
+#define OPTIMIZATION_LEVEL_2_FLAG "-O2"
+#define OPTIMIZATION_LEVEL_3_FLAG "-O3"
+#define OPTIMIZATION_LEVEL_S_FLAG "-Os"
+
+#define TARGET_CPU_FLAG "-mcpu="
+#define TARGET_ARCH_FLAG "-march="
+#define TARGET_TUNE_CPU_FLAG "-mtune="
+#define TARGET_FEATURES_FLAG "-mattr="
+
+#define LINK_TIME_OPTIMIZATION_FLAG "-flto"
+
+#define CODEGEN_THREADS_FLAG "-j"
+
+#define TIME_REPORT_FLAG "-ftime-report"
+#define TIME_TRACE_FLAG "-ftime-trace="
+
+#define NO_MODULES_CACHE_FLAG "-fno-modules-cache"
+
+#define BUILD_CACHE_FLAG "-fbuild-cache="
+#define BUILD_CACHE_SIZE_FLAG "-fbuild-cache-size="
+
+// Maximum size of the build cache in megabytes if it's not set
+#define DEFAULT_BUILD_CACHE_SIZE 1024
+
+// CPU name used to detect the host cpu name and features
+#define TARGET_NATIVE_CPU_NAME "native"
+
 // Number of options that can modifed from Compiler CLI
-#define NUMBER_OF_COMPILER_OPTIONS 4
+#define NUMBER_OF_COMPILER_OPTIONS 15
 
 namespace amun {
 
+// Optimization level used to build the LLVM passes pipeline and the code generator
+enum class OptimizationLevel {
+    O0,
+    O1,
+    O2,
+    O3,
+    Os,
+};
+
 // Set of configurations for the Compiler
 struct CompilerOptions {
     std::string output_file_name = "output";
@@ -20,7 +58,28 @@ struct CompilerOptions {
     bool should_report_warns = false;
     bool convert_warns_to_errors = false;
 
-    bool use_cpu_features = true;
+    std::string target_cpu = TARGET_NATIVE_CPU_NAME;
+    std::string target_tune_cpu;
+    std::string target_features;
+
+    amun::OptimizationLevel optimization_level = amun::OptimizationLevel::O0;
+
+    // Emit bitcode object files and optimize them again with the program after linking
+    bool use_link_time_optimization = false;
+
+    // Number of threads used to emit the machine code, each thread emit one object file
+    unsigned codegen_threads = 1;
+
+    // Report the time of each compilation phase, and write Chrome trace file if path is not empty
+    bool should_report_time = false;
+    std::string time_trace_file_path;
+
+    // Load imported and loaded files from their precompiled modules and write them after parsing
+    bool use_precompiled_modules = true;
+
+    // Reuse object files compiled before from unchanged sources, disabled if directory is empty
+    std::string build_cache_directory;
+    unsigned build_cache_size = DEFAULT_BUILD_CACHE_SIZE;
 
     std::vector<std::string> linker_extra_flags;
 };
@@ -32,4 +91,10 @@ auto parse_compiler_options(CompilerOptions* options, int argc, char** argv) ->
 // Report error and exit if any compiler option is passed twice
 auto check_passed_twice_option(const bool received_options[], int index, char* arg) -> void;
 
+// Return the value of flag with form `-flag=value`, or nullptr if argument is not this flag
+auto parse_flag_value(const char* argument, const char* flag) -> const char*;
+
+// Return the optimization level for flag like `-O2`, or false if it is not an optimization flag
+auto parse_optimization_level_flag(const char* flag, OptimizationLevel* level) -> bool;
+
 } // namespace amun
\ No newline at end of file
@@ -2,14 +2,20 @@
 
 #include "amun_alias_table.hpp"
 #include "amun_ast.hpp"
+#include "amun_ast_context.hpp"
 #include "amun_compiler_options.hpp"
 #include "amun_diagnostics.hpp"
+#include "amun_modules_cache.hpp"
 #include "amun_scoped_map.hpp"
 #include "amun_source_manager.hpp"
+#include "amun_sources_scanner.hpp"
+#include "amun_time_profiler.hpp"
 #include "amun_type.hpp"
+#include "amun_type_context.hpp"
 
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace amun {
 
@@ -27,15 +33,21 @@ struct Context {
     }
 
     amun::CompilerOptions options;
+    amun::AstContext ast_context;
+    amun::TypeContext type_context;
     amun::DiagnosticEngine diagnostics;
     amun::SourceManager source_manager;
+    amun::SourcesScanner sources_scanner{source_manager};
     amun::AliasTable type_alias_table;
+    amun::TimeProfiler time_profiler;
+    amun::ModulesCache modules_cache;
 
     // Declarations Informations
     std::unordered_map<std::string, FunctionKind> functions;
-    std::unordered_map<std::string, std::shared_ptr<amun::StructType>> structures;
-    std::unordered_map<std::string, std::shared_ptr<amun::EnumType>> enumerations;
-    amun::ScopedMap<std::string, Shared<Expression>> constants_table_map;
+    std::unordered_map<std::string, amun::StructType*> structures;
+    std::unordered_map<std::string, amun::EnumType*> enumerations;
+    std::unordered_set<std::string> intrinsics;
+    amun::ScopedMap<Expression*> constants_table_map;
 };
 
 } // namespace amun
\ No newline at end of file
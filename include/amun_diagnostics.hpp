@@ -3,6 +3,7 @@
 #include "amun_source_manager.hpp"
 #include "amun_token.hpp"
 
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -41,7 +42,7 @@ class DiagnosticEngine {
     auto level_count(DiagnosticLevel level) -> int64;
 
   private:
-    auto report_diagnostic(Diagnostic& diagnostic) -> void;
+    auto render_diagnostic(const Diagnostic& diagnostic, std::string& output) -> void;
 
     amun::SourceManager& source_manager;
 
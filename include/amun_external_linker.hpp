@@ -8,12 +8,18 @@
 namespace amun {
 
 struct ExternalLinker {
-    auto link(std::string object_file_path) -> int;
+    auto link(const std::vector<std::string>& object_files_paths) -> int;
+
+    // Search for the first available linker, the result is reused by the next calls
     auto check_aviable_linker() -> bool;
 
     std::vector<std::string> potentials_linkes_names = {"clang", "gcc"};
     std::vector<std::string> linker_flags = {"-no-pie", "-flto"};
+
+    // Libraries are passed after the object files so the linker can resolve their symbols
+    std::vector<std::string> linker_libraries;
     std::string current_linker_name = potentials_linkes_names[0];
+    std::string current_linker_path;
 };
 
-} // namespace amun
\ No newline at end of file
+} // namespace amun
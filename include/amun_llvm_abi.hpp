@@ -0,0 +1,15 @@
+#pragma once
+
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/Module.h>
+
+namespace amun {
+
+// Lower the functions and calls that pass or return structs, tuples and arrays by value to the
+// platform C calling convention, small aggregates are coerced into registers and large ones are
+// passed and returned in memory using byval and sret pointers, so calls between amun functions
+// are legalized efficiently and calls to C functions are compatible with C compilers, only the
+// System V x86-64 ABI is implemented and the module is not changed for the other targets
+auto lower_platform_abi(llvm::Module& module, const llvm::Triple& target_triple) -> void;
+
+} // namespace amun
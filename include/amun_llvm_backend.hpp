@@ -3,14 +3,18 @@
 #include "amun_ast.hpp"
 #include "amun_ast_visitor.hpp"
 #include "amun_basic.hpp"
-#include "amun_llvm_builder.hpp"
 #include "amun_llvm_defer.hpp"
-#include "amun_llvm_type.hpp"
+#include "amun_llvm_stack_slots.hpp"
 #include "amun_scoped_list.hpp"
 #include "amun_scoped_map.hpp"
 #include "amun_type.hpp"
 
-#include <any>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Type.h>
+#include <llvm/Target/TargetMachine.h>
+
 #include <memory>
 #include <stack>
 #include <unordered_map>
@@ -18,128 +22,127 @@
 
 namespace amun {
 
-class LLVMBackend : public TreeVisitor {
+class LLVMBackend : public TreeVisitor<llvm::Value*> {
   public:
-    LLVMBackend() { alloca_inst_table.push_new_scope(); }
+    // Functions are internal by default, exported functions can be linked from other modules
+    explicit LLVMBackend(llvm::LLVMContext& llvm_context, bool should_export_functions = false);
 
-    auto compile(std::string module_name, Shared<CompilationUnit> compilation_unit)
-        -> Unique<llvm::Module>;
+    auto compile(std::string module_name, CompilationUnit* compilation_unit,
+                 llvm::TargetMachine* target_machine) -> Unique<llvm::Module>;
 
-    auto visit(BlockStatement* node) -> std::any override;
+    auto visit(BlockStatement* node) -> llvm::Value* override;
 
-    auto visit(FieldDeclaration* node) -> std::any override;
+    auto visit(FieldDeclaration* node) -> llvm::Value* override;
 
-    auto visit(DestructuringDeclaraion* node) -> std::any override;
+    auto visit(DestructuringDeclaraion* node) -> llvm::Value* override;
 
-    auto visit(ConstDeclaration* node) -> std::any override;
+    auto visit(ConstDeclaration* node) -> llvm::Value* override;
 
-    auto visit(FunctionPrototype* node) -> std::any override;
+    auto visit(FunctionPrototype* node) -> llvm::Value* override;
 
-    auto visit(OperatorFunctionDeclaraion* node) -> std::any override;
+    auto visit(OperatorFunctionDeclaraion* node) -> llvm::Value* override;
 
-    auto visit(IntrinsicPrototype* node) -> std::any override;
+    auto visit(IntrinsicPrototype* node) -> llvm::Value* override;
 
-    auto visit(FunctionDeclaration* node) -> std::any override;
+    auto visit(FunctionDeclaration* node) -> llvm::Value* override;
 
-    auto visit(StructDeclaration* node) -> std::any override;
+    auto visit(StructDeclaration* node) -> llvm::Value* override;
 
-    auto visit(EnumDeclaration* node) -> std::any override;
+    auto visit(EnumDeclaration* node) -> llvm::Value* override;
 
-    auto visit(IfStatement* node) -> std::any override;
+    auto visit(IfStatement* node) -> llvm::Value* override;
 
-    auto visit(SwitchExpression* node) -> std::any override;
+    auto visit(SwitchExpression* node) -> llvm::Value* override;
 
-    auto visit(ForRangeStatement* node) -> std::any override;
+    auto visit(ForRangeStatement* node) -> llvm::Value* override;
 
-    auto visit(ForEachStatement* node) -> std::any override;
+    auto visit(ForEachStatement* node) -> llvm::Value* override;
 
-    auto visit(ForeverStatement* node) -> std::any override;
+    auto visit(ForeverStatement* node) -> llvm::Value* override;
 
-    auto visit(WhileStatement* node) -> std::any override;
+    auto visit(WhileStatement* node) -> llvm::Value* override;
 
-    auto visit(SwitchStatement* node) -> std::any override;
+    auto visit(SwitchStatement* node) -> llvm::Value* override;
 
-    auto visit(ReturnStatement* node) -> std::any override;
+    auto visit(ReturnStatement* node) -> llvm::Value* override;
 
-    auto visit(DeferStatement* node) -> std::any override;
+    auto visit(DeferStatement* node) -> llvm::Value* override;
 
-    auto visit(BreakStatement* node) -> std::any override;
+    auto visit(BreakStatement* node) -> llvm::Value* override;
 
-    auto visit(ContinueStatement* node) -> std::any override;
+    auto visit(ContinueStatement* node) -> llvm::Value* override;
 
-    auto visit(ExpressionStatement* node) -> std::any override;
+    auto visit(ExpressionStatement* node) -> llvm::Value* override;
 
-    auto visit(IfExpression* node) -> std::any override;
+    auto visit(IfExpression* node) -> llvm::Value* override;
 
-    auto visit(TupleExpression* node) -> std::any override;
+    auto visit(TupleExpression* node) -> llvm::Value* override;
 
-    auto visit(AssignExpression* node) -> std::any override;
+    auto visit(AssignExpression* node) -> llvm::Value* override;
 
-    auto visit(BinaryExpression* node) -> std::any override;
+    auto visit(BinaryExpression* node) -> llvm::Value* override;
 
-    auto visit(BitwiseExpression* node) -> std::any override;
+    auto visit(BitwiseExpression* node) -> llvm::Value* override;
 
-    auto visit(ComparisonExpression* node) -> std::any override;
+    auto visit(ComparisonExpression* node) -> llvm::Value* override;
 
-    auto visit(LogicalExpression* node) -> std::any override;
+    auto visit(LogicalExpression* node) -> llvm::Value* override;
 
-    auto visit(PrefixUnaryExpression* node) -> std::any override;
+    auto visit(PrefixUnaryExpression* node) -> llvm::Value* override;
 
-    auto visit(PostfixUnaryExpression* node) -> std::any override;
+    auto visit(PostfixUnaryExpression* node) -> llvm::Value* override;
 
-    auto visit(CallExpression* node) -> std::any override;
+    auto visit(CallExpression* node) -> llvm::Value* override;
 
-    auto visit(InitializeExpression* node) -> std::any override;
+    auto visit(InitializeExpression* node) -> llvm::Value* override;
 
-    auto visit(LambdaExpression* node) -> std::any override;
+    auto visit(LambdaExpression* node) -> llvm::Value* override;
 
-    auto visit(DotExpression* node) -> std::any override;
+    auto visit(DotExpression* node) -> llvm::Value* override;
 
-    auto visit(CastExpression* node) -> std::any override;
+    auto visit(CastExpression* node) -> llvm::Value* override;
 
-    auto visit(TypeSizeExpression* node) -> std::any override;
+    auto visit(TypeSizeExpression* node) -> llvm::Value* override;
 
-    auto visit(TypeAlignExpression* node) -> std::any override;
+    auto visit(TypeAlignExpression* node) -> llvm::Value* override;
 
-    auto visit(ValueSizeExpression* node) -> std::any override;
+    auto visit(ValueSizeExpression* node) -> llvm::Value* override;
 
-    auto visit(IndexExpression* node) -> std::any override;
+    auto visit(IndexExpression* node) -> llvm::Value* override;
 
-    auto visit(EnumAccessExpression* node) -> std::any override;
+    auto visit(EnumAccessExpression* node) -> llvm::Value* override;
 
-    auto visit(LiteralExpression* node) -> std::any override;
+    auto visit(LiteralExpression* node) -> llvm::Value* override;
 
-    auto visit(NumberExpression* node) -> std::any override;
+    auto visit(NumberExpression* node) -> llvm::Value* override;
 
-    auto visit(ArrayExpression* node) -> std::any override;
+    auto visit(ArrayExpression* node) -> llvm::Value* override;
 
-    auto visit(VectorExpression* node) -> std::any override;
+    auto visit(VectorExpression* node) -> llvm::Value* override;
 
-    auto visit(StringExpression* node) -> std::any override;
+    auto visit(StringExpression* node) -> llvm::Value* override;
 
-    auto visit(CharacterExpression* node) -> std::any override;
+    auto visit(CharacterExpression* node) -> llvm::Value* override;
 
-    auto visit(BooleanExpression* node) -> std::any override;
+    auto visit(BooleanExpression* node) -> llvm::Value* override;
 
-    auto visit(NullExpression* node) -> std::any override;
+    auto visit(NullExpression* node) -> llvm::Value* override;
 
-    auto visit(UndefinedExpression* node) -> std::any override;
+    auto visit(UndefinedExpression* node) -> llvm::Value* override;
 
-    auto visit(InfinityExpression* node) -> std::any override;
+    auto visit(InfinityExpression* node) -> llvm::Value* override;
 
   private:
-    auto llvm_node_value(std::any any_value) -> llvm::Value*;
-
-    auto llvm_resolve_value(std::any any_value) -> llvm::Value*;
+    auto llvm_resolve_value(llvm::Value* value) -> llvm::Value*;
 
     auto llvm_resolve_variable(const std::string& name) -> llvm::Value*;
 
     auto llvm_number_value(const std::string& value_litearl, amun::NumberKind size) -> llvm::Value*;
 
-    auto llvm_type_from_amun_type(Shared<amun::Type> type) -> llvm::Type*;
+    auto llvm_type_from_amun_type(amun::Type* type) -> llvm::Type*;
 
-    auto create_global_field_declaration(std::string name, Shared<Expression> value,
-                                         Shared<amun::Type> type) -> void;
+    auto create_global_field_declaration(std::string name, Expression* value,
+                                         amun::Type* type) -> void;
 
     auto create_llvm_numbers_bianry(TokenKind op, llvm::Value* left, llvm::Value* right)
         -> llvm::Value*;
@@ -171,13 +174,21 @@ class LLVMBackend : public TreeVisitor {
     auto create_llvm_strings_comparison(TokenKind op, llvm::Value* left, llvm::Value* right)
         -> llvm::Value*;
 
-    auto create_llvm_value_increment(Shared<Expression> right, bool is_prefix) -> llvm::Value*;
+    auto create_llvm_value_increment(Expression* right, bool is_prefix) -> llvm::Value*;
 
-    auto create_llvm_value_decrement(Shared<Expression> right, bool is_prefix) -> llvm::Value*;
+    auto create_llvm_value_decrement(Expression* right, bool is_prefix) -> llvm::Value*;
 
     auto create_llvm_string_length(llvm::Value* string) -> llvm::Value*;
 
-    auto create_llvm_struct_type(std::string name, std::vector<Shared<amun::Type>> members,
+    auto create_llvm_switch_statement(SwitchStatement* node,
+                                      std::vector<std::vector<llvm::ConstantInt*>>& cases_values)
+        -> void;
+
+    auto create_llvm_switch_expression(SwitchExpression* node,
+                                       std::vector<llvm::ConstantInt*>& cases_values)
+        -> llvm::Value*;
+
+    auto create_llvm_struct_type(std::string name, std::vector<amun::Type*> members,
                                  bool is_packed, bool is_extern) -> llvm::StructType*;
 
     auto create_overloading_function_call(std::string& name, std::vector<llvm::Value*> args)
@@ -190,28 +201,39 @@ class LLVMBackend : public TreeVisitor {
 
     auto access_struct_member_pointer(DotExpression* expression) -> llvm::Value*;
 
-    auto access_array_element(std::shared_ptr<Expression> node_value, llvm::Value* index)
-        -> llvm::Value*;
+    auto access_array_element(Expression* node_value, llvm::Value* index) -> llvm::Value*;
 
     auto resolve_generic_function(FunctionDeclaration* node,
-                                  std::vector<Shared<amun::Type>> generic_parameters)
-        -> llvm::Function*;
+                                  std::vector<amun::Type*> generic_parameters) -> llvm::Function*;
 
-    auto resolve_constant_expression(Shared<Expression> value) -> llvm::Constant*;
+    auto resolve_constant_expression(Expression* value) -> llvm::Constant*;
 
-    auto resolve_constant_index_expression(Shared<IndexExpression> expression) -> llvm::Constant*;
+    auto resolve_constant_index_expression(IndexExpression* expression) -> llvm::Constant*;
 
-    auto resolve_constant_if_expression(Shared<IfExpression> expression) -> llvm::Constant*;
+    auto resolve_constant_if_expression(IfExpression* expression) -> llvm::Constant*;
 
-    auto resolve_constant_switch_expression(Shared<SwitchExpression> expression) -> llvm::Constant*;
+    auto resolve_constant_switch_expression(SwitchExpression* expression) -> llvm::Constant*;
+
+    auto resolve_switch_integer_cases(Expression* argument, std::vector<Expression*>& cases,
+                                      std::vector<llvm::ConstantInt*>& cases_values) -> bool;
 
     auto resolve_constant_string_expression(const std::string& literal) -> llvm::Constant*;
 
-    auto resolve_generic_struct(Shared<amun::GenericStructType> generic) -> llvm::StructType*;
+    auto resolve_generic_struct(amun::GenericStructType* generic) -> llvm::StructType*;
 
     auto create_entry_block_alloca(llvm::Function* function, std::string var_name, llvm::Type* type)
         -> llvm::AllocaInst*;
 
+    // Struct or tuple value that is not stored in memory
+    auto is_aggregate_value(llvm::Value* value) -> bool;
+
+    // Alloca for temporary value that is alive until the end of the current statement
+    auto create_temporary_alloca(llvm::Type* type) -> llvm::AllocaInst*;
+
+    // Attach the loop hints as llvm.loop metadata to every branch back to the loop header
+    auto set_loop_hints_metadata(const LoopHints& hints, llvm::BasicBlock* header,
+                                 llvm::BasicBlock* preheader) -> void;
+
     auto lookup_function(std::string& name) -> llvm::Function*;
 
     auto is_lambda_function_name(const std::string& name) -> bool;
@@ -230,20 +252,72 @@ class LLVMBackend : public TreeVisitor {
 
     auto internal_compiler_error(const char* message) -> void;
 
+    auto create_llvm_int1(bool value) -> llvm::ConstantInt*;
+
+    auto create_llvm_int8(int32 value, bool singed) -> llvm::ConstantInt*;
+
+    auto create_llvm_int16(int32 value, bool singed) -> llvm::ConstantInt*;
+
+    auto create_llvm_int32(int32 value, bool singed) -> llvm::ConstantInt*;
+
+    auto create_llvm_int64(int64 value, bool singed) -> llvm::ConstantInt*;
+
+    auto create_llvm_float32(float32 value) -> llvm::Constant*;
+
+    auto create_llvm_float64(float64 value, bool singed) -> llvm::Constant*;
+
+    auto create_llvm_null(llvm::Type* type) -> llvm::Constant*;
+
+    auto create_llvm_array_type(llvm::Type* element, uint64 size) -> llvm::ArrayType*;
+
+    auto derefernecs_llvm_pointer(llvm::Value* pointer) -> llvm::Value*;
+
+    // LLVM Context and Builder owned by the caller, so many backends can run on different threads
+    llvm::LLVMContext& llvm_context;
+    llvm::IRBuilder<> Builder;
+
+    // LLVM Integer types
+    llvm::IntegerType* llvm_int1_type;
+    llvm::IntegerType* llvm_int8_type;
+    llvm::IntegerType* llvm_int16_type;
+    llvm::IntegerType* llvm_int32_type;
+    llvm::IntegerType* llvm_int64_type;
+
+    llvm::PointerType* llvm_int64_ptr_type;
+    llvm::PointerType* llvm_int8_ptr_type;
+
+    // LLVM Floating pointer types
+    llvm::Type* llvm_float32_type;
+    llvm::Type* llvm_float64_type;
+
+    // LLVM Void type
+    llvm::Type* llvm_void_type;
+
+    // LLVM void pointer type as *i8 not *void
+    llvm::PointerType* llvm_void_ptr_type;
+
+    // LLVM 1 bit integer with zero value (false)
+    llvm::ConstantInt* false_value;
+
+    // LLVM 32 bit integer with zero value
+    llvm::ConstantInt* zero_int32_value;
+
     Unique<llvm::Module> llvm_module;
 
-    std::unordered_map<std::string, Shared<FunctionPrototype>> functions_table;
+    std::unordered_map<std::string, FunctionPrototype*> functions_table;
     std::unordered_map<std::string, llvm::Function*> llvm_functions;
     std::unordered_map<std::string, llvm::Constant*> constants_string_pool;
     std::unordered_map<std::string, llvm::Type*> structures_types_map;
 
     // Generic function declaraions and parameters
     std::unordered_map<std::string, FunctionDeclaration*> functions_declaraions;
-    std::unordered_map<std::string, Shared<amun::Type>> generic_types;
+    std::unordered_map<std::string, amun::Type*> generic_types;
+    std::vector<amun::Type*> generic_arguments;
 
     std::stack<amun::ScopedList<Shared<amun::DeferCall>>> defer_calls_stack;
+    std::stack<amun::StackSlots> stack_slots_stack;
 
-    amun::ScopedMap<std::string, std::any> alloca_inst_table;
+    amun::ScopedMap<llvm::Value*> alloca_inst_table;
     std::stack<llvm::BasicBlock*> break_blocks_stack;
     std::stack<llvm::BasicBlock*> continue_blocks_stack;
 
@@ -255,6 +329,8 @@ class LLVMBackend : public TreeVisitor {
 
     bool is_on_global_scope = true;
 
+    bool should_export_functions = false;
+
     // counter to generate unquie lambda names
     size_t lambda_unique_id = 0;
     // map lambda generated name to implicit parameters
@@ -2,10 +2,16 @@
 
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <llvm/IR/Intrinsics.h>
 
 // A list of supported LLVM infrastructure intrinsic function
 static std::unordered_map<std::string, llvm::Intrinsic::ID> llvm_intrinsics_map = {
     {"llvm.cos", llvm::Intrinsic::cos},
+};
+
+// Intrinsics that the code generator can lower to calls to the C math library
+static std::unordered_set<std::string> llvm_math_intrinsics = {
+    "llvm.cos",
 };
\ No newline at end of file
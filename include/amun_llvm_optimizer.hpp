@@ -0,0 +1,29 @@
+#pragma once
+
+#include "amun_compiler_options.hpp"
+
+#include <llvm/IR/Module.h>
+#include <llvm/Support/CodeGen.h>
+#include <llvm/Target/TargetMachine.h>
+
+namespace amun {
+
+// The kind of LLVM pipeline to run, the pre link pipeline is used for bitcode object files
+// that will be optimized again by the link time pipeline after linking them together
+enum class OptimizationPipeline {
+    PER_MODULE,
+    PRE_LINK,
+    LINK_TIME,
+};
+
+// Run the LLVM new pass manager default pipeline for the optimization level on the module,
+// target machine is optional and used to provide target information for vectorizers and cost model
+auto optimize_llvm_module(llvm::Module& module, llvm::TargetMachine* target_machine,
+                          OptimizationLevel level,
+                          OptimizationPipeline pipeline = OptimizationPipeline::PER_MODULE)
+    -> void;
+
+// Map the amun optimization level to the code generator optimization level
+auto llvm_codegen_optimization_level(OptimizationLevel level) -> llvm::CodeGenOpt::Level;
+
+} // namespace amun
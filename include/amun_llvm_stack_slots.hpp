@@ -0,0 +1,39 @@
+#pragma once
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Instructions.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace amun {
+
+// Stack slots of the temporary values of one function, all slots are allocated in the entry
+// block so loops don't grow the stack and mem2reg can promote them, each temporary is alive
+// from its lifetime start until the end of the statement that created it, then its slot can be
+// reused by the next temporaries with the same type
+class StackSlots {
+  public:
+    explicit StackSlots(llvm::Function* function) : function(function) {}
+
+    // Slot that is alive until the end of the current statement, or the end of the function if
+    // it's created outside statements
+    auto allocate_temporary(llvm::IRBuilder<>& builder, llvm::Type* type) -> llvm::AllocaInst*;
+
+    // Keep temporary slot alive until the end of the function, for example if it's the value of
+    // a variable or its address is used by deferred call
+    auto retain(llvm::Value* value) -> void;
+
+    auto begin_statement() -> void;
+
+    // End the lifetime of the statement temporaries and make their slots available for reuse
+    auto end_statement(llvm::IRBuilder<>& builder) -> void;
+
+  private:
+    llvm::Function* function;
+    std::vector<std::vector<llvm::AllocaInst*>> statements_temporaries;
+    std::unordered_map<llvm::Type*, std::vector<llvm::AllocaInst*>> free_slots;
+};
+
+} // namespace amun
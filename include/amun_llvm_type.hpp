@@ -1,35 +0,0 @@
-#pragma once
-
-#include <llvm/IR/IRBuilder.h>
-#include <llvm/IR/LLVMContext.h>
-#include <llvm/IR/Type.h>
-
-// LLVM Context, Builder and Current Module
-static llvm::LLVMContext llvm_context;
-static llvm::IRBuilder<> Builder(llvm_context);
-
-// LLVM Integer types
-static auto llvm_int1_type = llvm::Type::getInt1Ty(llvm_context);
-static auto llvm_int8_type = llvm::Type::getInt8Ty(llvm_context);
-static auto llvm_int16_type = llvm::Type::getInt16Ty(llvm_context);
-static auto llvm_int32_type = llvm::Type::getInt32Ty(llvm_context);
-static auto llvm_int64_type = llvm::Type::getInt64Ty(llvm_context);
-
-static auto llvm_int64_ptr_type = llvm::Type::getInt64PtrTy(llvm_context);
-static auto llvm_int8_ptr_type = llvm::Type::getInt8PtrTy(llvm_context);
-
-// LLVM Floating pointer types
-static auto llvm_float32_type = llvm::Type::getFloatTy(llvm_context);
-static auto llvm_float64_type = llvm::Type::getDoubleTy(llvm_context);
-
-// LLVM Void type
-static auto llvm_void_type = llvm::Type::getVoidTy(llvm_context);
-
-// LLVM void pointer type as *i8 not *void
-static auto llvm_void_ptr_type = llvm::PointerType::get(llvm_int8_type, 0);
-
-// LLVM 1 bit integer with zero value (false)
-static auto false_value = Builder.getInt1(false);
-
-// LLVM 32 bit integer with zero value
-static auto zero_int32_value = Builder.getInt32(0);
@@ -0,0 +1,229 @@
+#pragma once
+
+#include "amun_ast.hpp"
+#include "amun_basic.hpp"
+#include "amun_context.hpp"
+#include "amun_modules_cache.hpp"
+#include "amun_type.hpp"
+
+#include <llvm/Support/LEB128.h>
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace amun {
+
+// Precompiled module starts with the magic number and the format version followed by the hash
+// of the payload, the version must be increased after any change in the nodes or types encoding
+constexpr uint64 MODULE_FORMAT_MAGIC = 0x4D4E554D41; // AMUNM
+constexpr uint64 MODULE_FORMAT_VERSION = 2;
+
+// Types are written once in the module types table and referenced by index, structures and
+// enumerations declared in the module are written fully and the others are referenced by name
+enum class ModuleTypeTag : uint8 {
+    NUMBER,
+    POINTER,
+    FUNCTION,
+    STATIC_ARRAY,
+    STATIC_VECTOR,
+    STRUCT_DECLARATION,
+    STRUCT_FIELDS,
+    STRUCT_REFERENCE,
+    TUPLE,
+    ENUM_DECLARATION,
+    ENUM_REFERENCE,
+    ENUM_ELEMENT,
+    GENERIC_PARAMETER,
+    GENERIC_STRUCT,
+    NONE,
+    VOID,
+    NILL,
+};
+
+// Nodes are written in pre order, expressions shared between many nodes are written once
+// and referenced by the index of their creation in post order
+enum class ModuleNodeTag : uint8 {
+    NONE,
+    EXPRESSION_REFERENCE,
+    CONSTANT_REFERENCE,
+
+    // Statements
+    BLOCK,
+    FIELD_DECLARATION,
+    DESTRUCTURING_DECLARATION,
+    CONST_DECLARATION,
+    FUNCTION_PROTOTYPE,
+    INTRINSIC_PROTOTYPE,
+    FUNCTION_DECLARATION,
+    OPERATOR_FUNCTION_DECLARATION,
+    STRUCT_DECLARATION,
+    ENUM_DECLARATION,
+    IF_STATEMENT,
+    FOR_RANGE,
+    FOR_EACH,
+    FOR_EVER,
+    WHILE,
+    SWITCH_STATEMENT,
+    RETURN,
+    DEFER,
+    BREAK,
+    CONTINUE,
+    EXPRESSION_STATEMENT,
+
+    // Expressions
+    IF_EXPRESSION,
+    SWITCH_EXPRESSION,
+    TUPLE,
+    ASSIGN,
+    BINARY,
+    BITWISE,
+    COMPARISON,
+    LOGICAL,
+    PREFIX_UNARY,
+    POSTFIX_UNARY,
+    CALL,
+    INITIALIZE,
+    LAMBDA,
+    DOT,
+    CAST,
+    TYPE_SIZE,
+    TYPE_ALIGN,
+    VALUE_SIZE,
+    INDEX,
+    ENUM_ACCESS,
+    LITERAL,
+    NUMBER,
+    STRING,
+    ARRAY,
+    VECTOR,
+    CHARACTER,
+    BOOLEAN,
+    NULL_VALUE,
+    UNDEFINED,
+    INFINITY_VALUE,
+};
+
+// Declarations of a source file and the files loaded from it, with the informations to validate
+// that parsing them again will produce the same declarations
+struct PrecompiledModule {
+    uint64 environment_fingerprint = 0;
+    std::vector<ModuleSourceFile> files;
+    std::vector<std::string> skipped_paths;
+    std::vector<std::pair<std::string, amun::FunctionKind>> functions;
+    std::vector<std::pair<std::string, amun::Type*>> aliases;
+    std::vector<Statement*> nodes;
+};
+
+// Integers are encoded as LEB128 and strings are prefixed with their size
+class ModuleEncoder {
+  public:
+    auto write_unsigned(uint64 value) -> void
+    {
+        uint8 encoded[16];
+        auto size = llvm::encodeULEB128(value, encoded);
+        buffer.append(reinterpret_cast<const char*>(encoded), size);
+    }
+
+    auto write_signed(int64 value) -> void
+    {
+        uint8 encoded[16];
+        auto size = llvm::encodeSLEB128(value, encoded);
+        buffer.append(reinterpret_cast<const char*>(encoded), size);
+    }
+
+    auto write_bool(bool value) -> void { buffer.push_back(value ? 1 : 0); }
+
+    auto write_string(std::string_view value) -> void
+    {
+        write_unsigned(value.size());
+        buffer.append(value);
+    }
+
+    auto write_bytes(std::string_view bytes) -> void { buffer.append(bytes); }
+
+    auto bytes() const -> std::string_view { return buffer; }
+
+    auto clear() -> void { buffer.clear(); }
+
+  private:
+    std::string buffer;
+};
+
+// Decoding failure is sticky, after the first failure every read returns empty value
+class ModuleDecoder {
+  public:
+    explicit ModuleDecoder(std::string_view bytes)
+        : cursor(reinterpret_cast<const uint8*>(bytes.data())), end(cursor + bytes.size())
+    {
+    }
+
+    auto read_unsigned() -> uint64
+    {
+        if (failed) {
+            return 0;
+        }
+
+        const char* error = nullptr;
+        unsigned size = 0;
+        auto value = llvm::decodeULEB128(cursor, &size, end, &error);
+        if (error != nullptr) {
+            failed = true;
+            return 0;
+        }
+        cursor += size;
+        return value;
+    }
+
+    auto read_signed() -> int64
+    {
+        if (failed) {
+            return 0;
+        }
+
+        const char* error = nullptr;
+        unsigned size = 0;
+        auto value = llvm::decodeSLEB128(cursor, &size, end, &error);
+        if (error != nullptr) {
+            failed = true;
+            return 0;
+        }
+        cursor += size;
+        return value;
+    }
+
+    auto read_bool() -> bool { return read_bytes(1) == std::string_view("\1", 1); }
+
+    auto read_string() -> std::string_view { return read_bytes(read_unsigned()); }
+
+    auto read_bytes(uint64 size) -> std::string_view
+    {
+        if (failed || size > static_cast<uint64>(end - cursor)) {
+            failed = true;
+            return {};
+        }
+        auto bytes = std::string_view(reinterpret_cast<const char*>(cursor), size);
+        cursor += size;
+        return bytes;
+    }
+
+    auto remaining_bytes() const -> std::string_view
+    {
+        return {reinterpret_cast<const char*>(cursor), static_cast<size_t>(end - cursor)};
+    }
+
+    auto fail() -> void { failed = true; }
+
+    auto has_failed() const -> bool { return failed; }
+
+  private:
+    const uint8* cursor;
+    const uint8* end;
+    bool failed = false;
+};
+
+// Precompiled module path is the source file path with the module extension
+auto module_file_path(const std::string& source_path) -> std::string;
+
+} // namespace amun
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "amun_ast.hpp"
+#include "amun_context.hpp"
+#include "amun_module_format.hpp"
+#include "amun_type.hpp"
+
+#include <string_view>
+#include <vector>
+
+namespace amun {
+
+// Decode precompiled module, the files informations are read first to validate the module then
+// the declarations are created in the context arenas, any decoding error makes the module invalid
+class ModuleReader {
+  public:
+    ModuleReader(amun::Context& context, std::string_view bytes)
+        : context(context), decoder(bytes)
+    {
+    }
+
+    // Read the header and the files informations, return false if the module is invalid
+    auto read_module_files(PrecompiledModule& module) -> bool;
+
+    // Read the types and the declarations with the source files ids of the module files
+    auto read_module_declarations(PrecompiledModule& module, std::vector<int> files_ids) -> bool;
+
+  private:
+    auto read_type_entry() -> void;
+
+    auto read_statement() -> Statement*;
+
+    auto read_statements() -> std::vector<Statement*>;
+
+    auto read_expression() -> Expression*;
+
+    auto read_expressions() -> std::vector<Expression*>;
+
+    auto read_parameters() -> std::vector<Parameter*>;
+
+    auto read_token() -> Token;
+
+    auto read_tokens() -> std::vector<Token>;
+
+    auto read_loop_hints(LoopHints& hints) -> void;
+
+    auto read_strings() -> std::vector<std::string>;
+
+    auto read_type() -> Type*;
+
+    auto read_types() -> std::vector<Type*>;
+
+    auto read_type_index() -> Type*;
+
+    auto read_types_indexes() -> std::vector<Type*>;
+
+    template <typename T>
+    auto read_node_of() -> T*
+    {
+        if constexpr (std::is_base_of_v<Expression, T>) {
+            return dynamic_cast<T*>(read_expression());
+        }
+        else {
+            return dynamic_cast<T*>(read_statement());
+        }
+    }
+
+    template <typename T, typename... Args>
+    auto create_node(Args&&... args) -> T*
+    {
+        return context.ast_context.create<T>(std::forward<Args>(args)...);
+    }
+
+    amun::Context& context;
+    ModuleDecoder decoder;
+    std::vector<int> files_ids;
+    std::vector<Type*> types;
+    std::vector<Expression*> expressions;
+};
+
+} // namespace amun
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "amun_ast.hpp"
+#include "amun_ast_visitor.hpp"
+#include "amun_module_format.hpp"
+#include "amun_type.hpp"
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/DenseSet.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace amun {
+
+// Encode the declarations of a source file to precompiled module
+class ModuleWriter : public TreeVisitor<void> {
+  public:
+    explicit ModuleWriter(const std::unordered_map<Expression*, std::string>& constants)
+        : constants(constants)
+    {
+    }
+
+    auto write_module(const PrecompiledModule& module) -> std::string;
+
+    auto visit(BlockStatement* node) -> void override;
+
+    auto visit(FieldDeclaration* node) -> void override;
+
+    auto visit(DestructuringDeclaraion* node) -> void override;
+
+    auto visit(ConstDeclaration* node) -> void override;
+
+    auto visit(FunctionPrototype* node) -> void override;
+
+    auto visit(OperatorFunctionDeclaraion* node) -> void override;
+
+    auto visit(IntrinsicPrototype* node) -> void override;
+
+    auto visit(FunctionDeclaration* node) -> void override;
+
+    auto visit(StructDeclaration* node) -> void override;
+
+    auto visit(EnumDeclaration* node) -> void override;
+
+    auto visit(IfStatement* node) -> void override;
+
+    auto visit(ForRangeStatement* node) -> void override;
+
+    auto visit(ForEachStatement* node) -> void override;
+
+    auto visit(ForeverStatement* node) -> void override;
+
+    auto visit(WhileStatement* node) -> void override;
+
+    auto visit(SwitchStatement* node) -> void override;
+
+    auto visit(ReturnStatement* node) -> void override;
+
+    auto visit(DeferStatement* node) -> void override;
+
+    auto visit(BreakStatement* node) -> void override;
+
+    auto visit(ContinueStatement* node) -> void override;
+
+    auto visit(ExpressionStatement* node) -> void override;
+
+    auto visit(IfExpression* node) -> void override;
+
+    auto visit(SwitchExpression* node) -> void override;
+
+    auto visit(TupleExpression* node) -> void override;
+
+    auto visit(AssignExpression* node) -> void override;
+
+    auto visit(BinaryExpression* node) -> void override;
+
+    auto visit(BitwiseExpression* node) -> void override;
+
+    auto visit(ComparisonExpression* node) -> void override;
+
+    auto visit(LogicalExpression* node) -> void override;
+
+    auto visit(PrefixUnaryExpression* node) -> void override;
+
+    auto visit(PostfixUnaryExpression* node) -> void override;
+
+    auto visit(CallExpression* node) -> void override;
+
+    auto visit(InitializeExpression* node) -> void override;
+
+    auto visit(LambdaExpression* node) -> void override;
+
+    auto visit(DotExpression* node) -> void override;
+
+    auto visit(CastExpression* node) -> void override;
+
+    auto visit(TypeSizeExpression* node) -> void override;
+
+    auto visit(TypeAlignExpression* node) -> void override;
+
+    auto visit(ValueSizeExpression* node) -> void override;
+
+    auto visit(IndexExpression* node) -> void override;
+
+    auto visit(EnumAccessExpression* node) -> void override;
+
+    auto visit(LiteralExpression* node) -> void override;
+
+    auto visit(NumberExpression* node) -> void override;
+
+    auto visit(StringExpression* node) -> void override;
+
+    auto visit(ArrayExpression* node) -> void override;
+
+    auto visit(VectorExpression* node) -> void override;
+
+    auto visit(CharacterExpression* node) -> void override;
+
+    auto visit(BooleanExpression* node) -> void override;
+
+    auto visit(NullExpression* node) -> void override;
+
+    auto visit(UndefinedExpression* node) -> void override;
+
+    auto visit(InfinityExpression* node) -> void override;
+
+  private:
+    auto write_tag(ModuleNodeTag tag) -> void;
+
+    auto write_statement(Statement* statement) -> void;
+
+    auto write_statements(const std::vector<Statement*>& statements) -> void;
+
+    auto write_expression(Expression* expression) -> void;
+
+    auto write_expressions(const std::vector<Expression*>& expressions) -> void;
+
+    auto write_parameters(const std::vector<Parameter*>& parameters) -> void;
+
+    auto write_token(const Token& token) -> void;
+
+    auto write_loop_hints(const LoopHints& hints) -> void;
+
+    auto encode_token(ModuleEncoder& encoder, const Token& token) -> void;
+
+    auto write_strings(const std::vector<std::string>& strings) -> void;
+
+    // Write the index of the type in the types table, types are added to the table on first use
+    auto write_type(Type* type) -> void;
+
+    auto write_types(const std::vector<Type*>& types) -> void;
+
+    auto resolve_type_index(Type* type) -> uint64;
+
+    auto resolve_types_indexes(const std::vector<Type*>& types) -> std::vector<uint64>;
+
+    const std::unordered_map<Expression*, std::string>& constants;
+
+    // Source files ids and the index of the file in the module files
+    llvm::DenseMap<int, uint64> files_indexes;
+
+    llvm::DenseSet<Type*> declared_types;
+    llvm::DenseMap<Type*, uint64> types_indexes;
+    uint64 types_entries_count = 0;
+    ModuleEncoder types_encoder;
+
+    llvm::DenseMap<Expression*, uint64> expressions_indexes;
+    uint64 expressions_count = 0;
+    ModuleEncoder nodes_encoder;
+};
+
+} // namespace amun
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "amun_basic.hpp"
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Expression;
+class Statement;
+
+namespace amun {
+
+struct Context;
+
+// Source file parsed as part of a module, the module is valid only if its content is not changed
+struct ModuleSourceFile {
+    std::string path;
+    uint64 content_hash;
+    int source_file_id;
+};
+
+// State of the context before parsing a source file, the same source is parsed differently if
+// the functions, types or constants declared before it are changed
+struct ModuleEnvironment {
+    uint64 fingerprint = 0;
+    size_t parsed_files_count = 0;
+    size_t skipped_paths_count = 0;
+    size_t aliases_count = 0;
+    int64 warnings_count = 0;
+
+    // Constants declared before the source file, the nodes that use them are shared with it
+    std::unordered_map<Expression*, std::string> constants;
+};
+
+// Precompiled modules are the declarations of an imported or loaded source file and the files
+// loaded from it, they are written next to the source file and loaded instead of parsing it
+// again while the sources contents and the environment before parsing are not changed
+class ModulesCache {
+  public:
+    // Capture the environment before parsing the source file and record it as parsed file
+    auto begin_module(amun::Context& context, const std::string& path, int source_file_id)
+        -> ModuleEnvironment;
+
+    // Load the declarations from the precompiled module of the source file if it still valid
+    auto load_module(amun::Context& context, const std::string& path,
+                     const ModuleEnvironment& environment)
+        -> std::optional<std::vector<Statement*>>;
+
+    // Write the declarations parsed from the source file to its precompiled module
+    auto save_module(amun::Context& context, const std::string& path,
+                     const ModuleEnvironment& environment, const std::vector<Statement*>& nodes)
+        -> void;
+
+    // Record import or load of a source file that is ignored because it's already parsed
+    auto record_skipped_path(const std::string& path) -> void;
+
+  private:
+    auto fingerprint_environment(amun::Context& context, ModuleEnvironment& environment)
+        -> uint64;
+
+    std::vector<ModuleSourceFile> parsed_files;
+    std::vector<std::string> skipped_paths;
+};
+
+} // namespace amun
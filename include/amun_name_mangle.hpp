@@ -5,11 +5,10 @@
 #include <string>
 #include <vector>
 
-auto mangle_type(Shared<amun::Type> type) -> std::string;
+auto mangle_type(amun::Type* type) -> std::string;
 
-auto mangle_tuple_type(Shared<amun::TupleType> type) -> std::string;
+auto mangle_tuple_type(amun::TupleType* type) -> std::string;
 
-auto mangle_operator_function(TokenKind kind, std::vector<Shared<amun::Type>> parameters)
-    -> std::string;
+auto mangle_operator_function(TokenKind kind, std::vector<amun::Type*> parameters) -> std::string;
 
-auto mangle_types(std::vector<Shared<amun::Type>> types) -> std::string;
\ No newline at end of file
+auto mangle_types(std::vector<amun::Type*> types) -> std::string;
\ No newline at end of file
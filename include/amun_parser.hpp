@@ -6,10 +6,9 @@
 #include "amun_parser.hpp"
 #include "amun_primitives.hpp"
 #include "amun_token.hpp"
-#include "amun_tokenizer.hpp"
+#include "amun_token_buffer.hpp"
 
 #include <memory>
-#include <optional>
 #include <stack>
 #include <string_view>
 #include <unordered_map>
@@ -23,7 +22,22 @@ enum class AstNodeScope {
     CONDITION_SCOPE,
 };
 
-static std::unordered_map<std::string, Shared<amun::Type>> primitive_types = {
+// Binary operators precedence from the lowest to the highest
+enum class OperatorPrecedence {
+    NONE,
+    LOGICAL_OR,
+    LOGICAL_AND,
+    BITWISE_AND,
+    BITWISE_XOR,
+    BITWISE_OR,
+    EQUALITY,
+    COMPARISON,
+    SHIFT,
+    TERM,
+    FACTOR,
+};
+
+static std::unordered_map<std::string, amun::Type*> primitive_types = {
     {"int1", amun::i1_type},     {"bool", amun::i1_type},
     {"char", amun::i8_type},     {"uchar", amun::u8_type},
 
@@ -40,176 +54,161 @@ static std::unordered_map<std::string, Shared<amun::Type>> primitive_types = {
 
 class Parser {
   public:
-    Parser(Shared<amun::Context> context, amun::Tokenizer& tokenizer)
-        : context(context), tokenizer(tokenizer)
+    Parser(Shared<amun::Context> context, amun::TokenBuffer tokens)
+        : context(context), tokens(std::move(tokens))
     {
-        auto current_source_file_id = tokenizer.get_source_file_id();
+        auto current_source_file_id = this->tokens.get_source_file_id();
         auto file_path = context->source_manager.resolve_source_path(current_source_file_id);
-        file_parent_path = amun::find_parent_path(file_path);
-
-        if (!file_parent_path.empty() && !file_parent_path.ends_with(amun::file_spreator())) {
-            file_parent_path += amun::file_spreator();
-        }
+        file_parent_path = amun::find_parent_directory(file_path);
     }
 
-    auto parse_compilation_unit() -> Shared<CompilationUnit>;
+    auto parse_compilation_unit() -> CompilationUnit*;
 
   private:
-    auto parse_import_declaration() -> std::vector<Shared<Statement>>;
+    // Create AST node owned by the AST context arena
+    template <typename T, typename... Args>
+    auto create_node(Args&&... args) -> T*
+    {
+        return context->ast_context.create<T>(std::forward<Args>(args)...);
+    }
+
+    auto parse_import_declaration() -> std::vector<Statement*>;
 
-    auto parse_load_declaration() -> std::vector<Shared<Statement>>;
+    auto parse_load_declaration() -> std::vector<Statement*>;
 
-    auto parse_compiletime_constants_declaraion() -> Shared<ConstDeclaration>;
+    auto parse_compiletime_constants_declaraion() -> ConstDeclaration*;
 
     auto parse_type_alias_declaration() -> void;
 
-    auto parse_single_source_file(std::string& path) -> std::vector<Shared<Statement>>;
+    auto parse_single_source_file(std::string& path) -> std::vector<Statement*>;
 
-    auto parse_declaration_statement() -> Shared<Statement>;
+    auto parse_declaration_statement() -> Statement*;
 
-    auto parse_declaraions_directive() -> Shared<Statement>;
+    auto parse_declaraions_directive() -> Statement*;
 
-    auto parse_statement() -> Shared<Statement>;
+    auto parse_statement() -> Statement*;
 
-    auto parse_field_declaration(bool is_global) -> Shared<FieldDeclaration>;
+    auto parse_field_declaration(bool is_global) -> FieldDeclaration*;
 
-    auto parse_destructuring_field_declaration(bool is_global) -> Shared<DestructuringDeclaraion>;
+    auto parse_destructuring_field_declaration(bool is_global) -> DestructuringDeclaraion*;
 
-    auto parse_intrinsic_prototype() -> Shared<IntrinsicPrototype>;
+    auto parse_intrinsic_prototype() -> IntrinsicPrototype*;
 
-    auto parse_function_prototype(amun::FunctionKind kind, bool is_external)
-        -> Shared<FunctionPrototype>;
+    auto parse_function_prototype(amun::FunctionKind kind, bool is_external) -> FunctionPrototype*;
 
-    auto parse_function_declaration(amun::FunctionKind kind) -> Shared<FunctionDeclaration>;
+    auto parse_function_declaration(amun::FunctionKind kind) -> FunctionDeclaration*;
 
-    auto parse_operator_function_declaraion(amun::FunctionKind kind)
-        -> Shared<OperatorFunctionDeclaraion>;
+    auto parse_operator_function_declaraion(amun::FunctionKind kind) -> OperatorFunctionDeclaraion*;
 
     auto parse_operator_function_operator(amun::FunctionKind kind) -> Token;
 
-    auto parse_structure_declaration(bool is_packed, bool is_extern) -> Shared<StructDeclaration>;
-
-    auto parse_enum_declaration() -> Shared<EnumDeclaration>;
-
-    auto parse_parameter() -> Shared<Parameter>;
+    auto parse_structure_declaration(bool is_packed, bool is_extern) -> StructDeclaration*;
 
-    auto parse_return_statement() -> Shared<ReturnStatement>;
+    auto parse_enum_declaration() -> EnumDeclaration*;
 
-    auto parse_defer_statement() -> Shared<DeferStatement>;
+    auto parse_parameter() -> Parameter*;
 
-    auto parse_break_statement() -> Shared<BreakStatement>;
+    auto parse_return_statement() -> ReturnStatement*;
 
-    auto parse_continue_statement() -> Shared<ContinueStatement>;
+    auto parse_defer_statement() -> DeferStatement*;
 
-    auto parse_if_statement() -> Shared<IfStatement>;
+    auto parse_break_statement() -> BreakStatement*;
 
-    auto parse_for_statement() -> Shared<Statement>;
+    auto parse_continue_statement() -> ContinueStatement*;
 
-    auto parse_while_statement() -> Shared<WhileStatement>;
+    auto parse_if_statement() -> IfStatement*;
 
-    auto parse_switch_statement() -> Shared<SwitchStatement>;
+    auto parse_for_statement() -> Statement*;
 
-    auto parse_block_statement() -> Shared<BlockStatement>;
+    auto parse_while_statement() -> WhileStatement*;
 
-    auto parse_expression_statement() -> Shared<ExpressionStatement>;
+    auto parse_switch_statement() -> SwitchStatement*;
 
-    auto parse_statements_directive() -> Shared<Statement>;
+    auto parse_block_statement() -> BlockStatement*;
 
-    auto parse_expression() -> Shared<Expression>;
+    auto parse_expression_statement() -> ExpressionStatement*;
 
-    auto parse_assignment_expression() -> Shared<Expression>;
+    auto parse_statements_directive() -> Statement*;
 
-    auto parse_logical_or_expression() -> Shared<Expression>;
+    auto parse_loop_hint_directive(Token directive) -> Statement*;
 
-    auto parse_logical_and_expression() -> Shared<Expression>;
+    auto parse_loop_hint_value(Token directive) -> uint32;
 
-    auto parse_bitwise_and_expression() -> Shared<Expression>;
+    auto parse_expression() -> Expression*;
 
-    auto parse_bitwise_xor_expression() -> Shared<Expression>;
+    auto parse_assignment_expression() -> Expression*;
 
-    auto parse_bitwise_or_expression() -> Shared<Expression>;
+    auto parse_binary_expression(OperatorPrecedence min_precedence) -> Expression*;
 
-    auto parse_equality_expression() -> Shared<Expression>;
+    auto parse_enum_access_expression() -> Expression*;
 
-    auto parse_comparison_expression() -> Shared<Expression>;
+    auto parse_infix_call_expression() -> Expression*;
 
-    auto parse_bitwise_shift_expression() -> Shared<Expression>;
+    auto parse_prefix_expression() -> Expression*;
 
-    auto parse_term_expression() -> Shared<Expression>;
+    auto parse_postfix_increment_or_decrement() -> Expression*;
 
-    auto parse_factor_expression() -> Shared<Expression>;
+    auto parse_enumeration_attribute_expression() -> Expression*;
 
-    auto parse_enum_access_expression() -> Shared<Expression>;
+    auto parse_call_or_access_expression() -> Expression*;
 
-    auto parse_infix_call_expression() -> Shared<Expression>;
+    auto parse_postfix_call_expression() -> Expression*;
 
-    auto parse_prefix_expression() -> Shared<Expression>;
+    auto parse_initializer_expression() -> Expression*;
 
-    auto parse_prefix_call_expression() -> Shared<Expression>;
+    auto parse_function_call_with_lambda_argument() -> Expression*;
 
-    auto parse_postfix_increment_or_decrement() -> Shared<Expression>;
+    auto parse_primary_expression() -> Expression*;
 
-    auto parse_enumeration_attribute_expression() -> Shared<Expression>;
+    auto parse_lambda_expression() -> LambdaExpression*;
 
-    auto parse_call_or_access_expression() -> Shared<Expression>;
+    auto parse_number_expression() -> NumberExpression*;
 
-    auto parse_postfix_call_expression() -> Shared<Expression>;
+    auto parse_literal_expression() -> LiteralExpression*;
 
-    auto parse_initializer_expression() -> Shared<Expression>;
+    auto parse_if_expression() -> IfExpression*;
 
-    auto parse_function_call_with_lambda_argument() -> Shared<Expression>;
+    auto parse_switch_expression() -> SwitchExpression*;
 
-    auto parse_primary_expression() -> Shared<Expression>;
+    auto parse_group_or_tuple_expression() -> Expression*;
 
-    auto parse_lambda_expression() -> Shared<LambdaExpression>;
+    auto parse_array_expression() -> ArrayExpression*;
 
-    auto parse_number_expression() -> Shared<NumberExpression>;
+    auto parse_cast_expression() -> CastExpression*;
 
-    auto parse_literal_expression() -> Shared<LiteralExpression>;
+    auto parse_type_size_expression() -> TypeSizeExpression*;
 
-    auto parse_if_expression() -> Shared<IfExpression>;
+    auto parse_type_allign_expression() -> TypeAlignExpression*;
 
-    auto parse_switch_expression() -> Shared<SwitchExpression>;
+    auto parse_value_size_expression() -> ValueSizeExpression*;
 
-    auto parse_group_or_tuple_expression() -> Shared<Expression>;
+    auto parse_expressions_directive() -> Expression*;
 
-    auto parse_array_expression() -> Shared<ArrayExpression>;
+    auto parse_generic_arguments_if_exists() -> std::vector<amun::Type*>;
 
-    auto parse_cast_expression() -> Shared<CastExpression>;
+    auto parse_type() -> amun::Type*;
 
-    auto parse_type_size_expression() -> Shared<TypeSizeExpression>;
+    auto pares_types_directive() -> amun::Type*;
 
-    auto parse_type_allign_expression() -> Shared<TypeAlignExpression>;
+    auto parse_type_with_prefix() -> amun::Type*;
 
-    auto parse_value_size_expression() -> Shared<ValueSizeExpression>;
+    auto parse_pointer_to_type() -> amun::Type*;
 
-    auto parse_expressions_directive() -> Shared<Expression>;
+    auto parse_function_ptr_type() -> amun::Type*;
 
-    auto parse_generic_arguments_if_exists() -> std::vector<Shared<amun::Type>>;
+    auto parse_tuple_type() -> amun::Type*;
 
-    auto parse_type() -> Shared<amun::Type>;
+    auto parse_list_of_types() -> std::vector<amun::Type*>;
 
-    auto pares_types_directive() -> Shared<amun::Type>;
+    auto parse_fixed_size_array_type() -> amun::Type*;
 
-    auto parse_type_with_prefix() -> Shared<amun::Type>;
+    auto parse_type_with_postfix() -> amun::Type*;
 
-    auto parse_pointer_to_type() -> Shared<amun::Type>;
+    auto parse_generic_struct_type() -> amun::Type*;
 
-    auto parse_function_ptr_type() -> Shared<amun::Type>;
+    auto parse_primary_type() -> amun::Type*;
 
-    auto parse_tuple_type() -> Shared<amun::Type>;
-
-    auto parse_list_of_types() -> std::vector<Shared<amun::Type>>;
-
-    auto parse_fixed_size_array_type() -> Shared<amun::Type>;
-
-    auto parse_type_with_postfix() -> Shared<amun::Type>;
-
-    auto parse_generic_struct_type() -> Shared<amun::Type>;
-
-    auto parse_primary_type() -> Shared<amun::Type>;
-
-    auto parse_identifier_type() -> Shared<amun::Type>;
+    auto parse_identifier_type() -> amun::Type*;
 
     auto parse_switch_operator() -> TokenKind;
 
@@ -217,8 +216,7 @@ class Parser {
 
     auto check_generic_parameter_name(Token name) -> void;
 
-    auto check_compiletime_constants_expression(Shared<Expression> expression, TokenSpan position)
-        -> void;
+    auto check_compiletime_constants_expression(Expression* expression, TokenSpan position) -> void;
 
     auto unexpected_token_error() -> void;
 
@@ -226,13 +224,12 @@ class Parser {
 
     auto get_number_kind(TokenKind token) -> amun::NumberKind;
 
-    auto is_function_declaration_kind(std::string& fun_name, amun::FunctionKind kind) -> bool;
+    auto is_function_declaration_kind(std::string_view fun_name, amun::FunctionKind kind) -> bool;
 
     auto is_valid_intrinsic_name(std::string& name) -> bool;
 
-    auto resolve_field_self_reference(Shared<amun::Type> field_type,
-                                      Shared<amun::PointerType> current_struct_ptr_type)
-        -> Shared<amun::Type>;
+    auto resolve_field_self_reference(amun::Type* field_type,
+                                      amun::PointerType* current_struct_ptr_type) -> amun::Type*;
 
     auto advanced_token() -> void;
 
@@ -254,6 +251,9 @@ class Parser {
 
     auto assert_kind(TokenKind, const char*) -> void;
 
+    // Precedence of the current token if it's a binary operator or NONE
+    auto current_operator_precedence() -> OperatorPrecedence;
+
     // We can't use TOKEN_RIGHT_SHIFT >> directly in the parser
     // It can produce error when parsing generic struct type for example Foo<Foo<T[>>]
     // This helper function check that the two tokens are TOKEN_GREATER and they are on the same
@@ -265,10 +265,10 @@ class Parser {
     std::string file_parent_path;
     Shared<amun::Context> context;
 
-    amun::Tokenizer& tokenizer;
-    std::optional<Token> previous_token;
-    std::optional<Token> current_token;
-    std::optional<Token> next_token;
+    amun::TokenBuffer tokens;
+    int64 previous_token_index = -1;
+    int64 current_token_index = -1;
+    int64 next_token_index = -1;
 
     std::unordered_set<std::string> generic_parameters_names;
 
@@ -4,27 +4,28 @@
 
 namespace amun {
 
-static auto i1_type = std::make_shared<amun::NumberType>(amun::NumberKind::INTEGER_1);
-static auto i8_type = std::make_shared<amun::NumberType>(amun::NumberKind::INTEGER_8);
-static auto i6_type = std::make_shared<amun::NumberType>(amun::NumberKind::INTEGER_16);
-static auto i32_type = std::make_shared<amun::NumberType>(amun::NumberKind::INTEGER_32);
-static auto i64_type = std::make_shared<amun::NumberType>(amun::NumberKind::INTEGER_64);
+// Primitive types are created once for the whole process and shared by every type context
+inline auto* const i1_type = new amun::NumberType(amun::NumberKind::INTEGER_1);
+inline auto* const i8_type = new amun::NumberType(amun::NumberKind::INTEGER_8);
+inline auto* const i6_type = new amun::NumberType(amun::NumberKind::INTEGER_16);
+inline auto* const i32_type = new amun::NumberType(amun::NumberKind::INTEGER_32);
+inline auto* const i64_type = new amun::NumberType(amun::NumberKind::INTEGER_64);
 
-static auto u8_type = std::make_shared<amun::NumberType>(amun::NumberKind::U_INTEGER_8);
-static auto u16_type = std::make_shared<amun::NumberType>(amun::NumberKind::U_INTEGER_16);
-static auto u32_type = std::make_shared<amun::NumberType>(amun::NumberKind::U_INTEGER_32);
-static auto u64_type = std::make_shared<amun::NumberType>(amun::NumberKind::U_INTEGER_64);
+inline auto* const u8_type = new amun::NumberType(amun::NumberKind::U_INTEGER_8);
+inline auto* const u16_type = new amun::NumberType(amun::NumberKind::U_INTEGER_16);
+inline auto* const u32_type = new amun::NumberType(amun::NumberKind::U_INTEGER_32);
+inline auto* const u64_type = new amun::NumberType(amun::NumberKind::U_INTEGER_64);
 
-static auto i8_ptr_type = std::make_shared<amun::PointerType>(amun::i8_type);
-static auto i32_ptr_type = std::make_shared<amun::PointerType>(amun::i32_type);
+inline auto* const i8_ptr_type = new amun::PointerType(amun::i8_type);
+inline auto* const i32_ptr_type = new amun::PointerType(amun::i32_type);
 
-static auto f32_type = std::make_shared<amun::NumberType>(amun::NumberKind::FLOAT_32);
-static auto f64_type = std::make_shared<amun::NumberType>(amun::NumberKind::FLOAT_64);
+inline auto* const f32_type = new amun::NumberType(amun::NumberKind::FLOAT_32);
+inline auto* const f64_type = new amun::NumberType(amun::NumberKind::FLOAT_64);
 
-static auto void_type = std::make_shared<amun::VoidType>();
-static auto null_type = std::make_shared<amun::NullType>();
-static auto none_type = std::make_shared<amun::NoneType>();
+inline auto* const void_type = new amun::VoidType();
+inline auto* const null_type = new amun::NullType();
+inline auto* const none_type = new amun::NoneType();
 
-static auto none_ptr_type = std::make_shared<amun::PointerType>(amun::none_type);
+inline auto* const none_ptr_type = new amun::PointerType(amun::none_type);
 
 } // namespace amun
\ No newline at end of file
@@ -1,80 +1,112 @@
 #pragma once
 
-#include <unordered_map>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/ADT/StringRef.h>
+
 #include <utility>
 #include <vector>
 
 namespace amun {
 
-template <typename K, typename V>
+// Symbols of all scopes are stored in one hash table with the index of the innermost binding,
+// each binding remember the binding it shadows so popping a scope restores the names it defined
+// without touching the other scopes
+template <typename V>
 class ScopedMap {
   public:
-    auto define(K key, V value) -> bool
+    auto define(llvm::StringRef key, V value) -> bool
     {
-        if (linked_scoped.back().contains(key)) {
+        auto& entry = *symbols.try_emplace(key, -1).first;
+        if (entry.second >= scopes_start.back()) {
             return false;
         }
-        linked_scoped.back()[key] = value;
+
+        auto level = static_cast<int>(scopes_start.size()) - 1;
+        bindings.push_back({&entry, value, level, entry.second});
+        entry.second = static_cast<int>(bindings.size()) - 1;
         return true;
     }
 
-    auto is_defined(K key) -> bool
+    auto is_defined(llvm::StringRef key) -> bool { return find_binding(key) != nullptr; }
+
+    void update(llvm::StringRef key, V value)
     {
-        for (int i = linked_scoped.size() - 1; i >= 0; i--) {
-            if (linked_scoped[i].contains(key)) {
-                return true;
-            }
+        if (auto* binding = find_binding(key)) {
+            binding->value = value;
         }
-        return false;
     }
 
-    void update(K key, V value)
+    auto lookup(llvm::StringRef key) -> V
     {
-        for (int i = linked_scoped.size() - 1; i >= 0; i--) {
-            if (linked_scoped[i].contains(key)) {
-                linked_scoped[i][key] = value;
-            }
-        }
+        auto* binding = find_binding(key);
+        return binding ? binding->value : nullptr;
     }
 
-    auto lookup(K key) -> V
+    auto lookup_on_current(llvm::StringRef key) -> V
     {
-        for (int i = linked_scoped.size() - 1; i >= 0; i--) {
-            if (linked_scoped[i].contains(key)) {
-                return linked_scoped[i][key];
-            }
-        }
-        return nullptr;
+        auto* binding = find_binding(key);
+        return binding && binding->level == static_cast<int>(scopes_start.size()) - 1
+                   ? binding->value
+                   : nullptr;
     }
 
-    auto lookup_on_current(K key) -> V
+    auto lookup_with_level(llvm::StringRef key) -> std::pair<V, int>
     {
-        size_t i = linked_scoped.size() - 1;
-        if (linked_scoped[i].contains(key)) {
-            return linked_scoped[i][key];
+        auto* binding = find_binding(key);
+        if (binding == nullptr) {
+            return {nullptr, -1};
         }
-
-        return nullptr;
+        return {binding->value, binding->level};
     }
 
-    auto lookup_with_level(K key) -> std::pair<V, int>
+    auto push_new_scope() -> void { scopes_start.push_back(static_cast<int>(bindings.size())); }
+
+    auto pop_current_scope() -> void
     {
-        for (int i = linked_scoped.size() - 1; i >= 0; i--) {
-            if (linked_scoped[i].contains(key)) {
-                return {linked_scoped[i][key], i};
-            }
+        auto scope_start = scopes_start.back();
+        while (static_cast<int>(bindings.size()) > scope_start) {
+            auto& binding = bindings.back();
+            binding.entry->second = binding.shadowed_index;
+            bindings.pop_back();
         }
-        return {nullptr, -1};
+        scopes_start.pop_back();
     }
 
-    auto push_new_scope() -> void { linked_scoped.push_back({}); }
-
-    auto pop_current_scope() -> void { linked_scoped.pop_back(); }
+    auto size() -> size_t { return scopes_start.size(); }
 
-    auto size() -> size_t { return linked_scoped.size(); }
+    // Names and values defined in the scope in the order of defining them
+    auto scope(size_t level) -> std::vector<std::pair<llvm::StringRef, V>>
+    {
+        auto scope_end = level + 1 < scopes_start.size() ? scopes_start[level + 1]
+                                                         : static_cast<int>(bindings.size());
+        std::vector<std::pair<llvm::StringRef, V>> scope_bindings;
+        for (int i = scopes_start[level]; i < scope_end; i++) {
+            scope_bindings.emplace_back(bindings[i].entry->first(), bindings[i].value);
+        }
+        return scope_bindings;
+    }
 
   private:
-    std::vector<std::unordered_map<K, V>> linked_scoped;
+    struct Binding {
+        llvm::StringMapEntry<int>* entry;
+        V value;
+        int level;
+        int shadowed_index;
+    };
+
+    auto find_binding(llvm::StringRef key) -> Binding*
+    {
+        auto entry = symbols.find(key);
+        if (entry == symbols.end() || entry->second < 0) {
+            return nullptr;
+        }
+        return &bindings[entry->second];
+    }
+
+    // Entries are never removed so each name is hashed and stored once
+    llvm::StringMap<int> symbols;
+    std::vector<Binding> bindings;
+    std::vector<int> scopes_start;
 };
 
-} // namespace amun
\ No newline at end of file
+} // namespace amun
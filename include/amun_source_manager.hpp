@@ -1,22 +1,94 @@
 #pragma once
 
+#include <llvm/Support/Allocator.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/StringSaver.h>
+
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace amun {
 
+// Content of a source file mapped into memory once, tokens literals are views into it
+// so the buffer must be alive until the end of the compilation
+class SourceBuffer {
+  public:
+    explicit SourceBuffer(std::unique_ptr<llvm::MemoryBuffer> buffer) : buffer(std::move(buffer))
+    {
+    }
+
+    // Content is always followed by a null terminator
+    auto content() const -> std::string_view
+    {
+        return {buffer->getBufferStart(), buffer->getBufferSize()};
+    }
+
+    // Line number starts from one, the lines offsets are computed on the first call
+    auto line(int line_number) -> std::string_view;
+
+    // Resolve the line and column of the character at this offset, both starts from one
+    auto location(size_t offset) -> std::pair<int, int>
+    {
+        // Locations are mostly resolved in order so most of them are in the last resolved line
+        if (offset < last_line_start || offset >= last_line_end) {
+            resolve_line_containing(offset);
+        }
+        return {static_cast<int>(last_line_index) + 1,
+                static_cast<int>(offset - last_line_start) + 1};
+    }
+
+  private:
+    auto build_lines_offsets() -> void;
+
+    auto resolve_line_containing(size_t offset) -> void;
+
+    std::unique_ptr<llvm::MemoryBuffer> buffer;
+    std::vector<size_t> lines_offsets;
+    size_t last_line_index = 0;
+    size_t last_line_start = 0;
+    size_t last_line_end = 0;
+};
+
+// Source files are scanned on many threads so the source manager can be used concurrently,
+// but each source buffer lines table is used only by the thread that parse this file
 class SourceManager {
   public:
+    // Register the source file for parsing, if it has reserved id the same id is returned
     auto register_source_path(std::string path) -> int;
 
+    // Reserve id for source file that will be scanned before it's registered for parsing
+    auto reserve_source_id(const std::string& path) -> int;
+
     auto resolve_source_path(int source_id) -> std::string;
 
     auto is_path_registered(std::string path) -> bool;
 
+    // Ids of the source files registered for parsing sorted in ascending order
+    auto registered_sources_ids() -> std::vector<int>;
+
+    auto load_source_buffer(int source_id) -> SourceBuffer&;
+
+    auto resolve_source_line(int source_id, int line_number) -> std::string_view;
+
+    // Own a copy of literals that are not part of source buffers such as escaped strings
+    auto save_literal(std::string_view literal) -> std::string_view;
+
   private:
+    auto resolve_source_id(const std::string& path) -> int;
+
+    std::mutex mutex;
     std::unordered_map<int, std::string> files_map;
+    std::unordered_map<std::string, int> files_ids;
     std::unordered_set<std::string> files_set;
+    std::unordered_map<int, SourceBuffer> buffers_map;
+    llvm::BumpPtrAllocator literals_allocator;
+    llvm::UniqueStringSaver literals_saver{literals_allocator};
     int last_source_file_id = -1;
 };
 
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "amun_source_manager.hpp"
+#include "amun_token_buffer.hpp"
+
+#include <llvm/Support/ThreadPool.h>
+
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace amun {
+
+// Tokenize the files that are loaded or imported by a source file on a thread pool ahead of
+// the parser, parsing itself is sequential because declarations in the loaded files change
+// how the next files are parsed for example infix functions and type alias
+class SourcesScanner {
+  public:
+    explicit SourcesScanner(amun::SourceManager& source_manager) : source_manager(source_manager)
+    {
+    }
+
+    SourcesScanner(const SourcesScanner&) = delete;
+    auto operator=(const SourcesScanner&) -> SourcesScanner& = delete;
+
+    // Return the tokens of the source file, wait for them if they are still scanned on the pool
+    // or scan them on the current thread if the file is not discovered before
+    auto take_tokens(int source_file_id) -> TokenBuffer;
+
+  private:
+    struct ScannedFile {
+        std::shared_future<void> scanned;
+        std::optional<TokenBuffer> tokens;
+    };
+
+    auto scan_source_file(int source_file_id) -> TokenBuffer;
+
+    auto prefetch_dependencies(const TokenBuffer& tokens, int source_file_id) -> void;
+
+    auto prefetch_source_file(const std::string& path) -> void;
+
+    amun::SourceManager& source_manager;
+    std::mutex mutex;
+    std::unordered_map<int, std::unique_ptr<ScannedFile>> scanned_files;
+    std::unordered_set<std::string> prefetched_paths;
+
+    // Destroyed first so it waits for the running tasks before destroying their results
+    llvm::ThreadPool thread_pool;
+};
+
+} // namespace amun
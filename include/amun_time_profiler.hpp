@@ -0,0 +1,41 @@
+#pragma once
+
+#include <llvm/Support/TimeProfiler.h>
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace amun {
+
+// Collect the time spent in each compilation phase to report it with `-ftime-report`
+class TimeProfiler {
+  public:
+    auto record_phase_time(const std::string& phase_name, double seconds) -> void;
+
+    auto report_phases_time() -> void;
+
+  private:
+    std::vector<std::pair<std::string, double>> phases_time;
+};
+
+// Measure the time of the current scope as a compilation phase,
+// and add it as an event to the Chrome trace if `-ftime-trace` is enabled
+class PhaseTimeScope {
+  public:
+    PhaseTimeScope(TimeProfiler& profiler, const char* phase_name, const std::string& detail = "");
+
+    ~PhaseTimeScope();
+
+    PhaseTimeScope(const PhaseTimeScope&) = delete;
+    auto operator=(const PhaseTimeScope&) -> PhaseTimeScope& = delete;
+
+  private:
+    TimeProfiler& profiler;
+    const char* phase_name;
+    std::chrono::steady_clock::time_point start_time;
+    llvm::TimeTraceScope trace_scope;
+};
+
+} // namespace amun
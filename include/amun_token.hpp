@@ -4,10 +4,11 @@
 
 #include <cstring>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 
-enum TokenKind {
+enum TokenKind : uint8_t {
     TOKEN_LOAD,
     TOKEN_IMPORT,
 
@@ -130,10 +131,11 @@ struct TokenSpan {
     int column_end;
 };
 
+// Literal is a view into the source buffer or into literals saved by the source manager
 struct Token {
     TokenKind kind;
     TokenSpan position;
-    std::string literal;
+    std::string_view literal;
 };
 
 struct TwoTokensOperator {
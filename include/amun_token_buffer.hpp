@@ -0,0 +1,109 @@
+#pragma once
+
+#include "amun_source_manager.hpp"
+#include "amun_token.hpp"
+
+#include <llvm/ADT/DenseMap.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace amun {
+
+// Tokens of one source file stored as structure of arrays, the parser checks tokens kinds
+// by index and the line and column of a token are resolved only when a full token is needed
+class TokenBuffer {
+  public:
+    TokenBuffer(amun::SourceBuffer& source_buffer, int source_file_id)
+        : source_buffer(source_buffer), source_code(source_buffer.content()),
+          source_file_id(source_file_id)
+    {
+    }
+
+    auto push_token(TokenKind kind, uint32_t offset, uint32_t length, std::string_view literal)
+        -> void
+    {
+        kinds.push_back(kind);
+        offsets.push_back(offset);
+        lengths.push_back(length);
+        literals_kinds.push_back(resolve_literal_kind(offset, length, literal));
+        if (literals_kinds.back() == LiteralKind::SAVED) {
+            saved_literals[kinds.size() - 1] = literal;
+        }
+    }
+
+    auto reserve(size_t size) -> void
+    {
+        kinds.reserve(size);
+        offsets.reserve(size);
+        lengths.reserve(size);
+        literals_kinds.reserve(size);
+    }
+
+    auto size() const -> size_t { return kinds.size(); }
+
+    auto get_source_file_id() const -> int { return source_file_id; }
+
+    auto kind(size_t index) const -> TokenKind { return kinds[index]; }
+
+    auto literal(size_t index) const -> std::string_view
+    {
+        switch (literals_kinds[index]) {
+        case LiteralKind::EMPTY: return {};
+        case LiteralKind::SOURCE: return source_code.substr(offsets[index], lengths[index]);
+        case LiteralKind::QUOTED: return source_code.substr(offsets[index] + 1, lengths[index] - 2);
+        case LiteralKind::SAVED: return saved_literals.lookup(index);
+        }
+        return {};
+    }
+
+    auto token(size_t index) -> Token
+    {
+        auto [line_number, column_start] = source_buffer.location(offsets[index]);
+
+        // Column end is the column of the last character, end of file token has no characters
+        auto length = static_cast<int>(std::max<uint32_t>(lengths[index], 1));
+        auto column_end = column_start + length - 1;
+
+        TokenSpan position = {source_file_id, line_number, column_start, column_end};
+        return {kinds[index], position, literal(index)};
+    }
+
+  private:
+    // Most of the literals are the token source or the string without quotes, so only literals
+    // that are not in the source such as strings with escape characters are stored
+    enum class LiteralKind : uint8_t { EMPTY, SOURCE, QUOTED, SAVED };
+
+    auto resolve_literal_kind(uint32_t offset, uint32_t length, std::string_view literal) const
+        -> LiteralKind
+    {
+        if (literal.empty()) {
+            return LiteralKind::EMPTY;
+        }
+
+        const auto* token_source = source_code.data() + offset;
+        if (literal.data() == token_source && literal.size() == length) {
+            return LiteralKind::SOURCE;
+        }
+
+        if (literal.data() == token_source + 1 && literal.size() + 2 == length) {
+            return LiteralKind::QUOTED;
+        }
+
+        return LiteralKind::SAVED;
+    }
+
+    amun::SourceBuffer& source_buffer;
+    std::string_view source_code;
+    int source_file_id;
+
+    std::vector<TokenKind> kinds;
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> lengths;
+    std::vector<LiteralKind> literals_kinds;
+    llvm::DenseMap<size_t, std::string_view> saved_literals;
+};
+
+} // namespace amun
@@ -1,48 +1,51 @@
 #pragma once
 
+#include "amun_source_manager.hpp"
 #include "amun_token.hpp"
+#include "amun_token_buffer.hpp"
 
+#include <string_view>
 #include <vector>
 
 namespace amun {
 
 class Tokenizer {
   public:
-    Tokenizer(int source_file_id, std::string source)
-        : source_code(std::move(source)), source_file_id(source_file_id),
+    Tokenizer(amun::SourceManager& source_manager, int source_file_id)
+        : source_manager(source_manager),
+          source_buffer(source_manager.load_source_buffer(source_file_id)),
+          source_code(source_buffer.content()), source_file_id(source_file_id),
           source_code_length(source_code.size()), start_position(0), current_position(0),
-          line_number(1), column_start(0), column_current(0)
+          tokens(source_buffer, source_file_id)
     {
     }
 
-    auto scan_all_tokens() -> std::vector<Token>;
-
-    auto scan_next_token() -> Token;
+    auto scan_all_tokens() -> TokenBuffer;
 
     auto get_source_file_id() -> int;
 
   private:
-    auto consume_symbol() -> Token;
+    auto scan_next_token() -> void;
 
-    auto consume_number() -> Token;
+    auto consume_symbol() -> void;
 
-    auto consume_hex_number() -> Token;
+    auto consume_number() -> void;
 
-    auto consume_binary_number() -> Token;
+    auto consume_hex_number() -> void;
 
-    auto consume_octal_number() -> Token;
+    auto consume_binary_number() -> void;
 
-    auto consume_string() -> Token;
+    auto consume_octal_number() -> void;
 
-    auto consume_character() -> Token;
+    auto consume_string() -> void;
 
-    auto consume_one_character() -> char;
+    auto consume_character() -> void;
 
-    auto build_token(TokenKind) -> Token;
+    auto consume_one_character() -> char;
 
-    auto build_token(TokenKind, std::string) -> Token;
+    auto build_token(TokenKind) -> void;
 
-    auto build_token_span() -> TokenSpan;
+    auto build_token(TokenKind, std::string_view) -> void;
 
     void skip_whitespaces();
 
@@ -74,26 +77,28 @@ class Tokenizer {
 
     static auto is_underscore(char) -> bool;
 
-    static auto hex_to_int(char c) -> int8_t;
+    static auto skip_identifier_characters(const char* current, const char* end) -> const char*;
+
+    static auto skip_whitespace_characters(const char* current, const char* end) -> const char*;
 
-    static auto hex_to_decimal(const std::string&) -> int64;
+    static auto find_string_delimiter(const char* current, const char* end) -> const char*;
 
-    static auto binary_to_decimal(const std::string&) -> int64;
+    static auto hex_to_int(char c) -> int8_t;
 
-    static auto octal_to_decimal(const std::string&) -> int64;
+    static auto digits_to_decimal(std::string_view digits, int base) -> int64;
 
-    auto resolve_keyword_token_kind(const char* keyword) -> TokenKind;
+    static auto resolve_keyword_token_kind(std::string_view keyword) -> TokenKind;
 
     auto is_source_available() -> bool;
 
-    std::string source_code;
+    amun::SourceManager& source_manager;
+    amun::SourceBuffer& source_buffer;
+    std::string_view source_code;
     int source_file_id;
     size_t source_code_length;
     size_t start_position;
     size_t current_position;
-    int line_number;
-    int column_start;
-    int column_current;
+    TokenBuffer tokens;
 };
 
 } // namespace amun
\ No newline at end of file
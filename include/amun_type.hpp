@@ -106,53 +106,50 @@ struct NumberType : public Type {
 };
 
 struct PointerType : public Type {
-    explicit PointerType(Shared<Type> base_type) : base_type(std::move(base_type))
+    explicit PointerType(Type* base_type) : base_type(base_type)
     {
         type_kind = TypeKind::POINTER;
     }
 
-    Shared<Type> base_type;
+    Type* base_type;
 };
 
 struct StaticArrayType : public Type {
-    StaticArrayType(Shared<Type> element_type, size_t size)
-        : element_type(std::move(element_type)), size(size)
+    StaticArrayType(Type* element_type, size_t size) : element_type(element_type), size(size)
     {
         type_kind = TypeKind::STATIC_ARRAY;
     }
 
-    Shared<Type> element_type;
+    Type* element_type;
     size_t size;
 };
 
 struct StaticVectorType : public Type {
-    explicit StaticVectorType(Shared<StaticArrayType> array) : array(std::move(array))
+    explicit StaticVectorType(StaticArrayType* array) : array(array)
     {
         type_kind = TypeKind::STATIC_VECTOR;
     }
-    Shared<StaticArrayType> array;
+    StaticArrayType* array;
 };
 
 struct FunctionType : public Type {
-    FunctionType(Token name, std::vector<Shared<Type>> parameters, Shared<Type> return_type,
-                 bool varargs = false, Shared<Type> varargs_type = nullptr,
-                 bool is_intrinsic = false, bool is_generic = false,
-                 std::vector<std::string> generic_names = {})
-        : name(std::move(name)), parameters(std::move(parameters)),
-          return_type(std::move(return_type)), has_varargs(varargs),
-          varargs_type(std::move(varargs_type)), is_intrinsic(is_intrinsic), is_generic(is_generic),
+    FunctionType(std::vector<Type*> parameters, Type* return_type, bool varargs = false,
+                 Type* varargs_type = nullptr, bool is_intrinsic = false, bool is_generic = false,
+                 std::vector<std::string> generic_names = {}, int implicit_parameters_count = 0)
+        : parameters(std::move(parameters)), return_type(return_type),
+          implicit_parameters_count(implicit_parameters_count), has_varargs(varargs),
+          varargs_type(varargs_type), is_intrinsic(is_intrinsic), is_generic(is_generic),
           generic_names(std::move(generic_names))
     {
         type_kind = TypeKind::FUNCTION;
     }
 
-    Token name;
-    std::vector<Shared<Type>> parameters;
-    Shared<Type> return_type;
-    int implicit_parameters_count = 0;
+    std::vector<Type*> parameters;
+    Type* return_type;
+    int implicit_parameters_count;
 
     bool has_varargs;
-    Shared<Type> varargs_type;
+    Type* varargs_type;
 
     bool is_intrinsic;
 
@@ -162,7 +159,7 @@ struct FunctionType : public Type {
 
 struct StructType : public Type {
     StructType(std::string name, std::vector<std::string> fields_names,
-               std::vector<Shared<Type>> types, std::vector<std::string> generic_parameters = {},
+               std::vector<Type*> types, std::vector<std::string> generic_parameters = {},
                bool is_packed = false, bool is_generic = false, bool is_extern = false)
         : name(std::move(name)), fields_names(std::move(fields_names)),
           fields_types(std::move(types)), generic_parameters(std::move(generic_parameters)),
@@ -173,45 +170,45 @@ struct StructType : public Type {
 
     std::string name;
     std::vector<std::string> fields_names;
-    std::vector<Shared<Type>> fields_types;
+    std::vector<Type*> fields_types;
     std::vector<std::string> generic_parameters;
-    std::vector<Shared<Type>> generic_parameters_types = {};
+    std::vector<Type*> generic_parameters_types = {};
     bool is_packed;
     bool is_generic;
     bool is_extern;
 };
 
 struct TupleType : public Type {
-    TupleType(std::string name, std::vector<Shared<Type>> fields_types)
+    TupleType(std::string name, std::vector<Type*> fields_types)
         : name(std::move(name)), fields_types(std::move(fields_types))
     {
         type_kind = TypeKind::TUPLE;
     }
     std::string name;
-    std::vector<Shared<Type>> fields_types;
+    std::vector<Type*> fields_types;
 };
 
 struct EnumType : public Type {
-    EnumType(Token name, std::unordered_map<std::string, int> values, Shared<Type> element_type)
-        : name(std::move(name)), values(std::move(values)), element_type(std::move(element_type))
+    EnumType(Token name, std::unordered_map<std::string, int> values, Type* element_type)
+        : name(std::move(name)), values(std::move(values)), element_type(element_type)
     {
         type_kind = TypeKind::ENUM;
     }
 
     Token name;
     std::unordered_map<std::string, int> values;
-    Shared<Type> element_type;
+    Type* element_type;
 };
 
 struct EnumElementType : public Type {
-    EnumElementType(std::string enum_name, Shared<Type> element_type)
-        : enum_name(std::move(enum_name)), element_type(std::move(element_type))
+    EnumElementType(std::string enum_name, Type* element_type)
+        : enum_name(std::move(enum_name)), element_type(element_type)
     {
         type_kind = TypeKind::ENUM_ELEMENT;
     }
 
     std::string enum_name;
-    Shared<Type> element_type;
+    Type* element_type;
 };
 
 struct GenericParameterType : public Type {
@@ -223,13 +220,13 @@ struct GenericParameterType : public Type {
 };
 
 struct GenericStructType : public Type {
-    GenericStructType(Shared<StructType> struct_type, std::vector<Shared<Type>> parameters)
-        : struct_type(std::move(struct_type)), parameters(std::move(parameters))
+    GenericStructType(StructType* struct_type, std::vector<Type*> parameters)
+        : struct_type(struct_type), parameters(std::move(parameters))
     {
         type_kind = TypeKind::GENERIC_STRUCT;
     }
-    Shared<StructType> struct_type;
-    std::vector<Shared<Type>> parameters;
+    StructType* struct_type;
+    std::vector<Type*> parameters;
 };
 
 struct NoneType : public Type {
@@ -244,61 +241,58 @@ struct NullType : public Type {
     NullType() { type_kind = TypeKind::NILL; }
 };
 
-auto is_types_equals(const Shared<Type>& type, const Shared<Type>& other) -> bool;
-
-auto is_functions_types_equals(const std::shared_ptr<FunctionType>& type,
-                               const std::shared_ptr<FunctionType>& other) -> bool;
+auto is_types_equals(Type* type, Type* other) -> bool;
 
-auto can_types_casted(const Shared<Type>& from, const Shared<Type>& to) -> bool;
+auto can_types_casted(Type* from, Type* to) -> bool;
 
-auto get_type_literal(const Shared<Type>& type) -> std::string;
+auto get_type_literal(Type* type) -> std::string;
 
 auto get_number_kind_literal(NumberKind kind) -> const char*;
 
-auto is_number_type(Shared<Type> type) -> bool;
+auto is_number_type(Type* type) -> bool;
 
-auto is_signed_integer_type(Shared<Type> type) -> bool;
+auto is_signed_integer_type(Type* type) -> bool;
 
-auto is_unsigned_integer_type(Shared<Type> type) -> bool;
+auto is_unsigned_integer_type(Type* type) -> bool;
 
-auto is_integer_type(Shared<Type> type) -> bool;
+auto is_integer_type(Type* type) -> bool;
 
-auto is_integer1_type(Shared<Type> type) -> bool;
+auto is_integer1_type(Type* type) -> bool;
 
-auto is_integer32_type(Shared<Type> type) -> bool;
+auto is_integer32_type(Type* type) -> bool;
 
-auto is_integer64_type(Shared<Type> type) -> bool;
+auto is_integer64_type(Type* type) -> bool;
 
-auto is_enum_type(Shared<Type> type) -> bool;
+auto is_enum_type(Type* type) -> bool;
 
-auto is_enum_element_type(Shared<Type> type) -> bool;
+auto is_enum_element_type(Type* type) -> bool;
 
-auto is_struct_type(Shared<Type> type) -> bool;
+auto is_struct_type(Type* type) -> bool;
 
-auto is_generic_struct_type(Shared<Type> type) -> bool;
+auto is_generic_struct_type(Type* type) -> bool;
 
-auto is_tuple_type(Shared<amun::Type> type) -> bool;
+auto is_tuple_type(amun::Type* type) -> bool;
 
-auto is_boolean_type(Shared<Type> type) -> bool;
+auto is_boolean_type(Type* type) -> bool;
 
-auto is_function_type(Shared<Type> type) -> bool;
+auto is_function_type(Type* type) -> bool;
 
-auto is_function_pointer_type(Shared<Type> type) -> bool;
+auto is_function_pointer_type(Type* type) -> bool;
 
-auto is_array_type(Shared<amun::Type> type) -> bool;
+auto is_array_type(amun::Type* type) -> bool;
 
-auto is_vector_type(Shared<amun::Type> type) -> bool;
+auto is_vector_type(amun::Type* type) -> bool;
 
-auto is_pointer_type(Shared<Type> type) -> bool;
+auto is_pointer_type(Type* type) -> bool;
 
-auto is_void_type(Shared<Type> type) -> bool;
+auto is_void_type(Type* type) -> bool;
 
-auto is_null_type(Shared<Type> type) -> bool;
+auto is_null_type(Type* type) -> bool;
 
-auto is_none_type(Shared<Type> type) -> bool;
+auto is_none_type(Type* type) -> bool;
 
-auto is_pointer_of_type(Shared<Type> type, Shared<Type> base) -> bool;
+auto is_pointer_of_type(Type* type, Type* base) -> bool;
 
-auto is_array_of_type(Shared<Type> type, Shared<Type> base) -> bool;
+auto is_array_of_type(Type* type, Type* base) -> bool;
 
 } // namespace amun
\ No newline at end of file
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "amun_arena.hpp"
+#include "amun_type.hpp"
+
+#include <llvm/ADT/DenseMap.h>
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace amun {
+
+// Owns all the types created while compiling, structural types are uniqued so two types
+// are equals only if they are the same object and type comparison is a pointer compare,
+// nominal types such as structures and enumerations are never uniqued and created directly
+class TypeContext : public Arena {
+  public:
+    TypeContext();
+
+    auto number_type(NumberKind kind) -> NumberType*;
+
+    auto pointer_type(Type* base_type) -> PointerType*;
+
+    auto static_array_type(Type* element_type, size_t size) -> StaticArrayType*;
+
+    auto static_vector_type(StaticArrayType* array) -> StaticVectorType*;
+
+    auto tuple_type(const std::vector<Type*>& fields_types) -> TupleType*;
+
+    auto function_type(const std::vector<Type*>& parameters, Type* return_type,
+                       bool varargs = false, Type* varargs_type = nullptr,
+                       bool is_intrinsic = false, bool is_generic = false,
+                       const std::vector<std::string>& generic_names = {},
+                       int implicit_parameters_count = 0) -> FunctionType*;
+
+    auto generic_struct_type(StructType* struct_type, const std::vector<Type*>& parameters)
+        -> GenericStructType*;
+
+    // Structure created from generic structure after resolving its parameters types
+    auto generic_struct_instance(GenericStructType* generic_struct) -> StructType*;
+
+    auto define_generic_struct_instance(GenericStructType* generic_struct, StructType* instance)
+        -> void;
+
+    auto enum_element_type(const std::string& enum_name, Type* element_type) -> EnumElementType*;
+
+    auto generic_parameter_type(const std::string& name) -> GenericParameterType*;
+
+  private:
+    struct TypesListHash {
+        auto operator()(const std::vector<Type*>& types) const -> size_t;
+    };
+
+    struct FunctionTypeKey {
+        std::vector<Type*> parameters;
+        Type* return_type;
+        bool has_varargs;
+        Type* varargs_type;
+        bool is_intrinsic;
+        bool is_generic;
+        std::vector<std::string> generic_names;
+        int implicit_parameters_count;
+
+        auto operator==(const FunctionTypeKey& other) const -> bool = default;
+    };
+
+    struct FunctionTypeKeyHash {
+        auto operator()(const FunctionTypeKey& key) const -> size_t;
+    };
+
+    llvm::DenseMap<Type*, PointerType*> pointer_types;
+    llvm::DenseMap<std::pair<Type*, size_t>, StaticArrayType*> static_array_types;
+    llvm::DenseMap<StaticArrayType*, StaticVectorType*> static_vector_types;
+    std::unordered_map<std::vector<Type*>, TupleType*, TypesListHash> tuple_types;
+    std::unordered_map<FunctionTypeKey, FunctionType*, FunctionTypeKeyHash> function_types;
+    std::unordered_map<std::vector<Type*>, GenericStructType*, TypesListHash> generic_struct_types;
+    std::unordered_map<GenericStructType*, StructType*> generic_struct_instances;
+    std::unordered_map<std::string, EnumElementType*> enum_element_types;
+    std::unordered_map<std::string, GenericParameterType*> generic_parameter_types;
+};
+
+} // namespace amun
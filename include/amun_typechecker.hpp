@@ -14,144 +14,142 @@
 
 namespace amun {
 
-class TypeChecker : public TreeVisitor {
+class TypeChecker : public TreeVisitor<amun::Type*> {
   public:
     explicit TypeChecker(Shared<amun::Context> context) : context(std::move(context))
     {
         types_table.push_new_scope();
     }
 
-    auto check_compilation_unit(Shared<CompilationUnit> compilation_unit) -> void;
+    auto check_compilation_unit(CompilationUnit* compilation_unit) -> void;
 
-    auto visit(BlockStatement* node) -> std::any override;
+    auto visit(BlockStatement* node) -> amun::Type* override;
 
-    auto visit(FieldDeclaration* node) -> std::any override;
+    auto visit(FieldDeclaration* node) -> amun::Type* override;
 
-    auto visit(DestructuringDeclaraion* node) -> std::any override;
+    auto visit(DestructuringDeclaraion* node) -> amun::Type* override;
 
-    auto visit(ConstDeclaration* node) -> std::any override;
+    auto visit(ConstDeclaration* node) -> amun::Type* override;
 
-    auto visit(FunctionPrototype* node) -> std::any override;
+    auto visit(FunctionPrototype* node) -> amun::Type* override;
 
-    auto visit(OperatorFunctionDeclaraion* node) -> std::any override;
+    auto visit(OperatorFunctionDeclaraion* node) -> amun::Type* override;
 
-    auto visit(IntrinsicPrototype* node) -> std::any override;
+    auto visit(IntrinsicPrototype* node) -> amun::Type* override;
 
-    auto visit(FunctionDeclaration* node) -> std::any override;
+    auto visit(FunctionDeclaration* node) -> amun::Type* override;
 
-    auto visit(StructDeclaration* node) -> std::any override;
+    auto visit(StructDeclaration* node) -> amun::Type* override;
 
-    auto visit(EnumDeclaration* node) -> std::any override;
+    auto visit(EnumDeclaration* node) -> amun::Type* override;
 
-    auto visit(IfStatement* node) -> std::any override;
+    auto visit(IfStatement* node) -> amun::Type* override;
 
-    auto visit(ForRangeStatement* node) -> std::any override;
+    auto visit(ForRangeStatement* node) -> amun::Type* override;
 
-    auto visit(ForEachStatement* node) -> std::any override;
+    auto visit(ForEachStatement* node) -> amun::Type* override;
 
-    auto visit(ForeverStatement* node) -> std::any override;
+    auto visit(ForeverStatement* node) -> amun::Type* override;
 
-    auto visit(WhileStatement* node) -> std::any override;
+    auto visit(WhileStatement* node) -> amun::Type* override;
 
-    auto visit(SwitchStatement* node) -> std::any override;
+    auto visit(SwitchStatement* node) -> amun::Type* override;
 
-    auto visit(ReturnStatement* node) -> std::any override;
+    auto visit(ReturnStatement* node) -> amun::Type* override;
 
-    auto visit(DeferStatement* node) -> std::any override;
+    auto visit(DeferStatement* node) -> amun::Type* override;
 
-    auto visit(BreakStatement* node) -> std::any override;
+    auto visit(BreakStatement* node) -> amun::Type* override;
 
-    auto visit(ContinueStatement* node) -> std::any override;
+    auto visit(ContinueStatement* node) -> amun::Type* override;
 
-    auto visit(ExpressionStatement* node) -> std::any override;
+    auto visit(ExpressionStatement* node) -> amun::Type* override;
 
-    auto visit(IfExpression* node) -> std::any override;
+    auto visit(IfExpression* node) -> amun::Type* override;
 
-    auto visit(SwitchExpression* node) -> std::any override;
+    auto visit(SwitchExpression* node) -> amun::Type* override;
 
-    auto visit(TupleExpression* node) -> std::any override;
+    auto visit(TupleExpression* node) -> amun::Type* override;
 
-    auto visit(AssignExpression* node) -> std::any override;
+    auto visit(AssignExpression* node) -> amun::Type* override;
 
-    auto visit(BinaryExpression* node) -> std::any override;
+    auto visit(BinaryExpression* node) -> amun::Type* override;
 
-    auto visit(BitwiseExpression* node) -> std::any override;
+    auto visit(BitwiseExpression* node) -> amun::Type* override;
 
-    auto visit(ComparisonExpression* node) -> std::any override;
+    auto visit(ComparisonExpression* node) -> amun::Type* override;
 
-    auto visit(LogicalExpression* node) -> std::any override;
+    auto visit(LogicalExpression* node) -> amun::Type* override;
 
-    auto visit(PrefixUnaryExpression* node) -> std::any override;
+    auto visit(PrefixUnaryExpression* node) -> amun::Type* override;
 
-    auto visit(PostfixUnaryExpression* node) -> std::any override;
+    auto visit(PostfixUnaryExpression* node) -> amun::Type* override;
 
-    auto visit(CallExpression* node) -> std::any override;
+    auto visit(CallExpression* node) -> amun::Type* override;
 
-    auto visit(InitializeExpression* node) -> std::any override;
+    auto visit(InitializeExpression* node) -> amun::Type* override;
 
-    auto visit(LambdaExpression* node) -> std::any override;
+    auto visit(LambdaExpression* node) -> amun::Type* override;
 
-    auto visit(DotExpression* node) -> std::any override;
+    auto visit(DotExpression* node) -> amun::Type* override;
 
-    auto visit(CastExpression* node) -> std::any override;
+    auto visit(CastExpression* node) -> amun::Type* override;
 
-    auto visit(TypeSizeExpression* node) -> std::any override;
+    auto visit(TypeSizeExpression* node) -> amun::Type* override;
 
-    auto visit(TypeAlignExpression* node) -> std::any override;
+    auto visit(TypeAlignExpression* node) -> amun::Type* override;
 
-    auto visit(ValueSizeExpression* node) -> std::any override;
+    auto visit(ValueSizeExpression* node) -> amun::Type* override;
 
-    auto visit(IndexExpression* node) -> std::any override;
+    auto visit(IndexExpression* node) -> amun::Type* override;
 
-    auto visit(EnumAccessExpression* node) -> std::any override;
+    auto visit(EnumAccessExpression* node) -> amun::Type* override;
 
-    auto visit(LiteralExpression* node) -> std::any override;
+    auto visit(LiteralExpression* node) -> amun::Type* override;
 
-    auto visit(NumberExpression* node) -> std::any override;
+    auto visit(NumberExpression* node) -> amun::Type* override;
 
-    auto visit(ArrayExpression* node) -> std::any override;
+    auto visit(ArrayExpression* node) -> amun::Type* override;
 
-    auto visit(VectorExpression* node) -> std::any override;
+    auto visit(VectorExpression* node) -> amun::Type* override;
 
-    auto visit(StringExpression* node) -> std::any override;
+    auto visit(StringExpression* node) -> amun::Type* override;
 
-    auto visit(CharacterExpression* node) -> std::any override;
+    auto visit(CharacterExpression* node) -> amun::Type* override;
 
-    auto visit(BooleanExpression* node) -> std::any override;
+    auto visit(BooleanExpression* node) -> amun::Type* override;
 
-    auto visit(NullExpression* node) -> std::any override;
+    auto visit(NullExpression* node) -> amun::Type* override;
 
-    auto visit(UndefinedExpression* node) -> std::any override;
+    auto visit(UndefinedExpression* node) -> amun::Type* override;
 
-    auto visit(InfinityExpression* node) -> std::any override;
+    auto visit(InfinityExpression* node) -> amun::Type* override;
 
-    auto node_amun_type(std::any any_type) -> Shared<amun::Type>;
+    auto is_same_type(amun::Type* left, amun::Type* right) -> bool;
 
-    auto is_same_type(const Shared<amun::Type>& left, const Shared<amun::Type>& right) -> bool;
+    auto resolve_generic_type(amun::Type* type, std::vector<std::string> generic_names = {},
+                              std::vector<amun::Type*> generic_parameters = {}) -> amun::Type*;
 
-    auto resolve_generic_type(Shared<amun::Type> type, std::vector<std::string> generic_names = {},
-                              std::vector<Shared<amun::Type>> generic_parameters = {})
-        -> Shared<amun::Type>;
-
-    auto infier_type_by_other_type(Shared<amun::Type> type, Shared<amun::Type> other)
-        -> std::unordered_map<std::string, Shared<amun::Type>>;
+    auto infier_type_by_other_type(amun::Type* type, amun::Type* other)
+        -> std::unordered_map<std::string, amun::Type*>;
 
     auto check_number_limits(const char* literal, amun::NumberKind kind) -> bool;
 
-    auto check_missing_return_statement(Shared<Statement> node) -> bool;
+    auto check_missing_return_statement(Statement* node) -> bool;
 
-    auto check_complete_switch_cases(Shared<amun::EnumType> enum_type,
+    auto check_complete_switch_cases(amun::EnumType* enum_type,
                                      std::unordered_set<std::string> cases_values,
                                      bool has_else_branch, TokenSpan span) -> void;
 
-    auto check_parameters_types(TokenSpan location, std::vector<Shared<Expression>>& arguments,
-                                std::vector<Shared<amun::Type>>& parameters, bool has_varargs,
-                                Shared<amun::Type> varargs_type, int implicit_parameters_count)
-        -> void;
+    auto check_parameters_types(TokenSpan location, std::vector<Expression*>& arguments,
+                                std::vector<amun::Type*>& parameters, bool has_varargs,
+                                amun::Type* varargs_type, int implicit_parameters_count) -> void;
+
+    auto check_lambda_has_invalid_capturing(Expression* expression) -> void;
 
-    auto check_lambda_has_invalid_capturing(Shared<Expression> expression) -> void;
+    auto check_valid_assignment_right_side(Expression* node, TokenSpan position) -> void;
 
-    auto check_valid_assignment_right_side(Shared<Expression> node, TokenSpan position) -> void;
+    auto check_loop_variable_assignment(Expression* node, TokenSpan position) -> void;
 
     auto push_new_scope() -> void;
 
@@ -159,18 +157,23 @@ class TypeChecker : public TreeVisitor {
 
   private:
     Shared<amun::Context> context;
-    amun::ScopedMap<std::string, std::any> types_table;
+    amun::ScopedMap<amun::Type*> types_table;
 
     // Generic function declaraions and parameters
     std::unordered_map<std::string, FunctionDeclaration*> generic_functions_declaraions;
-    std::unordered_map<std::string, Shared<amun::Type>> generic_types;
+    std::unordered_map<std::string, amun::Type*> generic_types;
+    std::vector<amun::Type*> generic_arguments;
+
+    // Names and scope levels of the for range and for each variables, they are readonly
+    // copies of the loop induction variable so assigning them can't change the iteration
+    std::vector<std::pair<std::string, int>> loop_variables;
 
     // Used to track the return types of functions and inner lambda expression
-    std::stack<Shared<amun::Type>> return_types_stack;
+    std::stack<amun::Type*> return_types_stack;
 
     // Flag that tell us when we are inside lambda expression body
-    bool is_inside_lambda_body;
-    std::stack<std::vector<std::pair<std::string, Shared<amun::Type>>>> lambda_implicit_parameters;
+    bool is_inside_lambda_body = false;
+    std::stack<std::vector<std::pair<std::string, amun::Type*>>> lambda_implicit_parameters;
 };
 
 } // namespace amun
\ No newline at end of file
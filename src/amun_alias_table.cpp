@@ -3,12 +3,15 @@
 
 amun::AliasTable::AliasTable() { config_type_alias_table(); }
 
-auto amun::AliasTable::define_alias(std::string alias, Shared<amun::Type> type) -> void
+auto amun::AliasTable::define_alias(std::string alias, amun::Type* type) -> void
 {
+    if (!type_alias_table.contains(alias)) {
+        aliases_names.push_back(alias);
+    }
     type_alias_table[alias] = type;
 }
 
-auto amun::AliasTable::resolve_alias(std::string alias) -> Shared<amun::Type>
+auto amun::AliasTable::resolve_alias(std::string alias) -> amun::Type*
 {
     return type_alias_table[alias];
 }
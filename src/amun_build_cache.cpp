@@ -0,0 +1,265 @@
+#include "../include/amun_build_cache.hpp"
+
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/FileUtilities.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/SHA1.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <iostream>
+#include <utility>
+
+// Entries written by compilers that have different cache format are never used
+#define BUILD_CACHE_FORMAT_VERSION "1"
+#define BUILD_CACHE_ENTRY_EXTENSION ".o"
+#define BUILD_CACHE_STATISTICS_FILE "statistics"
+
+amun::BuildCache::BuildCache(std::string directory, uint64 max_size_in_bytes)
+    : directory(std::move(directory)), max_size_in_bytes(max_size_in_bytes)
+{
+}
+
+auto amun::BuildCache::compute_key(amun::Context& context, llvm::TargetMachine* target_machine,
+                                   const char* output_kind) -> std::string
+{
+    llvm::SHA1 hasher;
+
+    // Each value is prefixed with its size so different values can't have the same bytes
+    auto add_value = [&hasher](llvm::StringRef value) {
+        auto size = std::to_string(value.size());
+        hasher.update(size);
+        hasher.update(":");
+        hasher.update(value);
+    };
+
+    add_value(BUILD_CACHE_FORMAT_VERSION);
+    add_value(AMUN_LANGUAGE_VERSION);
+    add_value(LLVM_VERSION_STRING);
+    add_value(output_kind);
+
+    // Compiler is identified by its executable size and modification time like ccache
+    static int main_address = 0;
+    auto compiler_path = llvm::sys::fs::getMainExecutable(nullptr, &main_address);
+    llvm::sys::fs::file_status compiler_status;
+    if (!llvm::sys::fs::status(compiler_path, compiler_status)) {
+        auto modification_time = compiler_status.getLastModificationTime().time_since_epoch();
+        add_value(std::to_string(compiler_status.getSize()));
+        add_value(std::to_string(modification_time.count()));
+    }
+
+    add_value(target_machine->getTargetTriple().str());
+    add_value(target_machine->getTargetCPU());
+    add_value(target_machine->getTargetFeatureString());
+
+    const auto& options = context.options;
+    add_value(std::to_string(static_cast<int>(options.optimization_level)));
+    add_value(options.target_tune_cpu);
+    add_value(std::to_string(options.use_link_time_optimization));
+    add_value(std::to_string(options.codegen_threads));
+    add_value(std::to_string(options.linker_extra_flags.size()));
+    for (const auto& linker_flag : options.linker_extra_flags) {
+        add_value(linker_flag);
+    }
+
+    // Source files are sorted by path because the ids depend on the order of scanning them
+    auto& source_manager = context.source_manager;
+    std::vector<std::pair<std::string, int>> source_files;
+    for (auto source_id : source_manager.registered_sources_ids()) {
+        source_files.emplace_back(source_manager.resolve_source_path(source_id), source_id);
+    }
+    std::sort(source_files.begin(), source_files.end());
+
+    for (const auto& [path, source_id] : source_files) {
+        add_value(path);
+        auto content = source_manager.load_source_buffer(source_id).content();
+        add_value(llvm::StringRef(content.data(), content.size()));
+    }
+
+    return llvm::toHex(hasher.final(), true);
+}
+
+auto amun::BuildCache::restore_objects(const std::string& key,
+                                       const std::vector<std::string>& objects_paths) -> bool
+{
+    for (size_t i = 0; i < objects_paths.size(); i++) {
+        if (!llvm::sys::fs::exists(entry_path(key, i))) {
+            record_lookup(false);
+            return false;
+        }
+    }
+
+    auto now = std::chrono::system_clock::now();
+    for (size_t i = 0; i < objects_paths.size(); i++) {
+        auto cached_object_path = entry_path(key, i);
+        if (llvm::sys::fs::copy_file(cached_object_path, objects_paths[i])) {
+            record_lookup(false);
+            return false;
+        }
+
+        // Modification time of the entry is the last time it's used
+        int file_descriptor;
+        if (!llvm::sys::fs::openFileForWrite(cached_object_path, file_descriptor,
+                                             llvm::sys::fs::CD_OpenExisting,
+                                             llvm::sys::fs::OF_Append)) {
+            llvm::sys::fs::setLastAccessAndModificationTime(file_descriptor, now);
+            llvm::sys::Process::SafelyCloseFileDescriptor(file_descriptor);
+        }
+    }
+
+    record_lookup(true);
+    return true;
+}
+
+auto amun::BuildCache::store_objects(const std::string& key,
+                                     const std::vector<std::string>& objects_paths) -> void
+{
+    if (llvm::sys::fs::create_directories(directory)) {
+        return;
+    }
+
+    // Entries are written to temporary files then renamed so other compilers never read part
+    // of them, any error just leave the object uncached
+    for (size_t i = 0; i < objects_paths.size(); i++) {
+        auto object_buffer = llvm::MemoryBuffer::getFile(objects_paths[i]);
+        if (!object_buffer) {
+            return;
+        }
+
+        auto cached_object_path = entry_path(key, i);
+        auto error = llvm::writeFileAtomically(cached_object_path + "-%%%%%%.tmp",
+                                               cached_object_path, (*object_buffer)->getBuffer());
+        if (error) {
+            llvm::consumeError(std::move(error));
+            return;
+        }
+    }
+
+    evict_least_recently_used();
+}
+
+auto amun::BuildCache::report_statistics() -> void
+{
+    uint64 entries_count = 0;
+    uint64 cache_size = 0;
+    std::error_code error_code;
+    for (llvm::sys::fs::directory_iterator entry(directory, error_code), end;
+         entry != end && !error_code; entry.increment(error_code)) {
+        auto entry_status = entry->status();
+        if (entry_status && llvm::sys::path::extension(entry->path()) ==
+                                BUILD_CACHE_ENTRY_EXTENSION) {
+            entries_count++;
+            cache_size += entry_status->getSize();
+        }
+    }
+
+    uint64 hits = 0;
+    uint64 misses = 0;
+    llvm::SmallString<128> statistics_path(directory);
+    llvm::sys::path::append(statistics_path, BUILD_CACHE_STATISTICS_FILE);
+    if (auto statistics = llvm::MemoryBuffer::getFile(statistics_path)) {
+        std::sscanf((*statistics)->getBufferStart(), "%" SCNu64 " %" SCNu64, &hits, &misses);
+    }
+
+    auto lookups = hits + misses;
+    auto hit_rate = lookups == 0 ? 0.0 : 100.0 * static_cast<double>(hits) / lookups;
+    std::cout << "Build cache " << directory << '\n';
+    std::cout << "    Entries  : " << entries_count << '\n';
+    std::cout << "    Size     : " << cache_size / 1024 << " KB of "
+              << max_size_in_bytes / 1024 << " KB\n";
+    std::cout << "    Hits     : " << hits << '\n';
+    std::cout << "    Misses   : " << misses << '\n';
+    std::cout << "    Hit rate : " << hit_rate << "%\n";
+}
+
+auto amun::BuildCache::entry_path(const std::string& key, size_t index) -> std::string
+{
+    // Parallel code generation objects are named key.o, key.1.o, ..., key.N-1.o
+    auto entry_name = key;
+    if (index > 0) {
+        entry_name += "." + std::to_string(index);
+    }
+    entry_name += BUILD_CACHE_ENTRY_EXTENSION;
+
+    llvm::SmallString<128> path(directory);
+    llvm::sys::path::append(path, entry_name);
+    return std::string(path);
+}
+
+auto amun::BuildCache::record_lookup(bool is_hit) -> void
+{
+    if (llvm::sys::fs::create_directories(directory)) {
+        return;
+    }
+
+    // Statistics are approximate because concurrent compilers may overwrite each other updates
+    uint64 hits = 0;
+    uint64 misses = 0;
+    llvm::SmallString<128> statistics_path(directory);
+    llvm::sys::path::append(statistics_path, BUILD_CACHE_STATISTICS_FILE);
+    if (auto statistics = llvm::MemoryBuffer::getFile(statistics_path)) {
+        std::sscanf((*statistics)->getBufferStart(), "%" SCNu64 " %" SCNu64, &hits, &misses);
+    }
+
+    if (is_hit) {
+        hits++;
+    }
+    else {
+        misses++;
+    }
+
+    auto content = std::to_string(hits) + " " + std::to_string(misses) + "\n";
+    auto path = std::string(statistics_path);
+    auto error = llvm::writeFileAtomically(path + "-%%%%%%.tmp", path, content);
+    llvm::consumeError(std::move(error));
+}
+
+auto amun::BuildCache::evict_least_recently_used() -> void
+{
+    struct CacheEntry {
+        std::string path;
+        uint64 size;
+        llvm::sys::TimePoint<> last_use_time;
+    };
+
+    std::vector<CacheEntry> entries;
+    uint64 cache_size = 0;
+    std::error_code error_code;
+    for (llvm::sys::fs::directory_iterator entry(directory, error_code), end;
+         entry != end && !error_code; entry.increment(error_code)) {
+        if (llvm::sys::path::extension(entry->path()) != BUILD_CACHE_ENTRY_EXTENSION) {
+            continue;
+        }
+
+        auto entry_status = entry->status();
+        if (!entry_status) {
+            continue;
+        }
+
+        entries.push_back({entry->path(), entry_status->getSize(),
+                           entry_status->getLastModificationTime()});
+        cache_size += entry_status->getSize();
+    }
+
+    if (cache_size <= max_size_in_bytes) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const auto& first, const auto& second) {
+        return first.last_use_time < second.last_use_time;
+    });
+
+    for (const auto& entry : entries) {
+        if (cache_size <= max_size_in_bytes) {
+            break;
+        }
+        llvm::sys::fs::remove(entry.path);
+        cache_size -= entry.size;
+    }
+}
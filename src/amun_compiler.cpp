@@ -2,19 +2,58 @@
 #include "../include/amun_external_linker.hpp"
 #include "../include/amun_files.hpp"
 #include "../include/amun_llvm_backend.hpp"
+#include "../include/amun_llvm_intrinsic.hpp"
+#include "../include/amun_llvm_optimizer.hpp"
 #include "../include/amun_logger.hpp"
 #include "../include/amun_parser.hpp"
+#include "../include/amun_time_profiler.hpp"
 #include "../include/amun_typechecker.hpp"
 
 #include <llvm/ADT/Optional.h>
+#include <llvm/ADT/StringSet.h>
 #include <llvm/ADT/Triple.h>
+#include <llvm/BinaryFormat/Magic.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/CodeGen/ParallelCG.h>
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/ExecutionEngine/Orc/TargetProcess/TargetExecutionUtils.h>
+#include <llvm/IRReader/IRReader.h>
 #include <llvm/IR/LegacyPassManager.h>
+#include <llvm/Linker/Linker.h>
+#include <llvm/MC/SubtargetFeature.h>
 #include <llvm/MC/TargetRegistry.h>
 #include <llvm/Support/FileSystem.h>
 #include <llvm/Support/Host.h>
+#include <llvm/Support/SourceMgr.h>
 #include <llvm/Support/TargetSelect.h>
+#include <llvm/Support/TimeProfiler.h>
 #include <llvm/Target/TargetMachine.h>
 #include <llvm/Target/TargetOptions.h>
+#include <llvm/Transforms/IPO/Internalize.h>
+
+amun::Compiler::Compiler(Shared<amun::Context> context) : context(std::move(context))
+{
+    if (!this->context->options.time_trace_file_path.empty()) {
+        llvm::timeTraceProfilerInitialize(0, "amun");
+    }
+}
+
+amun::Compiler::~Compiler()
+{
+    const auto& options = context->options;
+    if (options.should_report_time) {
+        context->time_profiler.report_phases_time();
+    }
+
+    if (!options.time_trace_file_path.empty()) {
+        if (auto error = llvm::timeTraceProfilerWrite(options.time_trace_file_path, "")) {
+            std::cout << "Can't write time trace file " << llvm::toString(std::move(error))
+                      << '\n';
+        }
+        llvm::timeTraceProfilerCleanup();
+    }
+}
 
 auto amun::Compiler::compile_source_code(const char* source_file) -> int
 {
@@ -39,7 +78,10 @@ auto amun::Compiler::compile_source_code(const char* source_file) -> int
     auto compilation_unit = parse_source_code(source_file);
 
     amun::TypeChecker type_checker(context);
-    type_checker.check_compilation_unit(compilation_unit);
+    {
+        amun::PhaseTimeScope time_scope(context->time_profiler, "Type checking");
+        type_checker.check_compilation_unit(compilation_unit);
+    }
 
     if (context->options.should_report_warns and
         context->diagnostics.level_count(amun::DiagnosticLevel::WARNING) > 0) {
@@ -56,60 +98,54 @@ auto amun::Compiler::compile_source_code(const char* source_file) -> int
         return EXIT_FAILURE;
     }
 
-    amun::LLVMBackend llvm_backend;
-    auto llvm_ir_module = llvm_backend.compile(source_file, compilation_unit);
-
-    // Assert that main function exists to before creating executable file
-    if (llvm_ir_module->getFunction("main") == nullptr) {
-        std::cout << "consider adding a `main` function to " << source_file << "\n";
-        return EXIT_FAILURE;
+    // Math intrinsics that are not folded at compile time are lowered to C math library calls
+    for (const auto& intrinsic : context->intrinsics) {
+        if (llvm_math_intrinsics.contains(intrinsic)) {
+            external_linker.linker_libraries.emplace_back("-lm");
+            break;
+        }
     }
 
-    // Initalize native targers
-    llvm::InitializeNativeTarget();
-    llvm::InitializeNativeTargetAsmParser();
-    llvm::InitializeNativeTargetAsmPrinter();
-
-    std::string object_file_path = context->options.output_file_name + ".o";
-
-    std::error_code object_file_error;
-    auto flags = llvm::sys::fs::OF_None;
-    llvm::raw_fd_ostream stream(object_file_path, object_file_error, flags);
-    if (object_file_error.message() != "Success") {
-        std::cout << "Can't create output file " << object_file_error.message() << '\n';
+    auto target_machine = create_target_machine();
+    if (target_machine == nullptr) {
         return EXIT_FAILURE;
     }
 
-    // Get current machine target triple
-    auto target_triple = llvm::sys::getDefaultTargetTriple();
-
-    // Check if this target is available
-    std::string lookup_target_error;
-    const auto* target = llvm::TargetRegistry::lookupTarget(target_triple, lookup_target_error);
-    if (!lookup_target_error.empty()) {
-        std::cout << lookup_target_error << '\n';
-        return EXIT_FAILURE;
+    // Partitions object files are named output.o, output.1.o, ..., output.N-1.o
+    const auto& output_file_name = context->options.output_file_name;
+    std::vector<std::string> object_files_paths = {output_file_name + ".o"};
+    for (unsigned i = 1; i < context->options.codegen_threads; i++) {
+        object_files_paths.push_back(output_file_name + "." + std::to_string(i) + ".o");
     }
 
-    llvm::TargetOptions opt;
-    auto rm = llvm::Optional<llvm::Reloc::Model>();
-    llvm::legacy::PassManager pass_manager;
+    // Bitcode objects from the linker flags are linked into the program with link time
+    // optimization, so the program objects depend on files that are not part of the cache key
+    auto build_cache = create_build_cache();
+    auto use_build_cache =
+        build_cache.is_enabled() && !context->options.use_link_time_optimization;
+    std::string cache_key;
+    if (use_build_cache) {
+        cache_key = build_cache.compute_key(*context, target_machine.get(), "executable");
+    }
 
-    constexpr auto CPU = "generic";
-    constexpr auto FEATURES = "";
-    auto* target_machine = target->createTargetMachine(target_triple, CPU, FEATURES, opt, rm);
+    if (!use_build_cache || !build_cache.restore_objects(cache_key, object_files_paths)) {
+        if (emit_program_object_files(source_file, compilation_unit, target_machine.get(),
+                                      external_linker.linker_flags,
+                                      object_files_paths) != EXIT_SUCCESS) {
+            return EXIT_FAILURE;
+        }
 
-    auto file_type = llvm::CGFT_ObjectFile;
-    if (target_machine->addPassesToEmitFile(pass_manager, stream, nullptr, file_type, true)) {
-        std::cout << "Target machine can't emit a file of this type" << '\n';
-        return EXIT_FAILURE;
+        if (use_build_cache) {
+            build_cache.store_objects(cache_key, object_files_paths);
+        }
     }
 
-    pass_manager.run(*llvm_ir_module);
-    stream.flush();
-
-    // Link object file with optional libraries into executable
-    auto result = external_linker.link(object_file_path);
+    // Link object files with optional libraries into executable
+    int result;
+    {
+        amun::PhaseTimeScope time_scope(context->time_profiler, "Linking");
+        result = external_linker.link(object_files_paths);
+    }
     if (result == 0) {
         std::cout << "Successfully compiled " << source_file << " to executable\n";
     }
@@ -124,7 +160,10 @@ auto amun::Compiler::compile_to_object_file_from_source_code(const char* source_
     auto compilation_unit = parse_source_code(source_file);
 
     amun::TypeChecker type_checker(context);
-    type_checker.check_compilation_unit(compilation_unit);
+    {
+        amun::PhaseTimeScope time_scope(context->time_profiler, "Type checking");
+        type_checker.check_compilation_unit(compilation_unit);
+    }
 
     if (context->options.should_report_warns and
         context->diagnostics.level_count(amun::DiagnosticLevel::WARNING) > 0) {
@@ -141,70 +180,35 @@ auto amun::Compiler::compile_to_object_file_from_source_code(const char* source_
         return EXIT_FAILURE;
     }
 
-    amun::LLVMBackend llvm_backend;
-    auto llvm_ir_module = llvm_backend.compile(source_file, compilation_unit);
-
-    // Initalize native targers
-    llvm::InitializeNativeTarget();
-    llvm::InitializeNativeTargetAsmParser();
-    llvm::InitializeNativeTargetAsmPrinter();
-
-    std::string object_file_path = context->options.output_file_name + ".o";
-
-    std::error_code object_file_error;
-    auto flags = llvm::sys::fs::OF_None;
-    llvm::raw_fd_ostream stream(object_file_path, object_file_error, flags);
-    if (object_file_error.message() != "Success") {
-        std::cout << "Can't create output file " << object_file_error.message() << '\n';
+    auto target_machine = create_target_machine();
+    if (target_machine == nullptr) {
         return EXIT_FAILURE;
     }
 
-    // Get current machine target triple
-    auto target_triple = llvm::sys::getDefaultTargetTriple();
-
-    // Check if this target is available
-    std::string lookup_target_error;
-    const auto* target = llvm::TargetRegistry::lookupTarget(target_triple, lookup_target_error);
-    if (!lookup_target_error.empty()) {
-        std::cout << lookup_target_error << '\n';
-        return EXIT_FAILURE;
+    std::string object_file_path = context->options.output_file_name + ".o";
+    auto build_cache = create_build_cache();
+    std::string cache_key;
+    if (build_cache.is_enabled()) {
+        cache_key = build_cache.compute_key(*context, target_machine.get(), "object");
     }
 
-    llvm::TargetOptions opt;
-    auto rm = llvm::Optional<llvm::Reloc::Model>();
-    llvm::legacy::PassManager pass_manager;
-
-    std::string cpu_name = "generic";
-    std::stringstream cpu_features_str;
-
-    if (context->options.use_cpu_features) {
-        // Get current CPU name and Features
-        cpu_name = llvm::sys::getHostCPUName();
-        llvm::StringMap<bool> host_features;
-        llvm::sys::getHostCPUFeatures(host_features);
+    if (!build_cache.is_enabled() || !build_cache.restore_objects(cache_key, {object_file_path})) {
+        if (emit_source_object_file(source_file, compilation_unit, target_machine.get(),
+                                    object_file_path) != EXIT_SUCCESS) {
+            return EXIT_FAILURE;
+        }
 
-        // Append aviable features for this CPU
-        for (const auto& host_feature : host_features) {
-            if (cpu_features_str.rdbuf()->in_avail() > 0) {
-                cpu_features_str << ",";
-            }
-            cpu_features_str << (host_feature.second ? "+" : "-") << host_feature.first().str();
+        if (build_cache.is_enabled()) {
+            build_cache.store_objects(cache_key, {object_file_path});
         }
     }
 
-    auto features = cpu_features_str.str();
-    auto* target_machine = target->createTargetMachine(target_triple, cpu_name, features, opt, rm);
-
-    auto file_type = llvm::CGFT_ObjectFile;
-    if (target_machine->addPassesToEmitFile(pass_manager, stream, nullptr, file_type, true)) {
-        std::cout << "Target machine can't emit a file of this type" << '\n';
-        return EXIT_FAILURE;
+    if (context->options.use_link_time_optimization) {
+        std::cout << "Successfully compiled " << source_file << " to bitcode object file\n";
+    }
+    else {
+        std::cout << "Successfully compiled " << source_file << " to object file\n";
     }
-
-    pass_manager.run(*llvm_ir_module);
-    stream.flush();
-
-    std::cout << "Successfully compiled " << source_file << " to object file\n";
     return EXIT_SUCCESS;
 }
 
@@ -213,7 +217,10 @@ auto amun::Compiler::emit_llvm_ir_from_source_code(const char* source_file) -> i
     auto compilation_unit = parse_source_code(source_file);
 
     amun::TypeChecker type_checker(context);
-    type_checker.check_compilation_unit(compilation_unit);
+    {
+        amun::PhaseTimeScope time_scope(context->time_profiler, "Type checking");
+        type_checker.check_compilation_unit(compilation_unit);
+    }
 
     if (context->options.should_report_warns and
         context->diagnostics.level_count(amun::DiagnosticLevel::WARNING) > 0) {
@@ -230,8 +237,27 @@ auto amun::Compiler::emit_llvm_ir_from_source_code(const char* source_file) -> i
         exit(EXIT_FAILURE);
     }
 
-    amun::LLVMBackend llvm_backend;
-    auto llvm_ir_module = llvm_backend.compile(source_file, compilation_unit);
+    auto target_machine = create_target_machine();
+    if (target_machine == nullptr) {
+        return EXIT_FAILURE;
+    }
+
+    llvm::LLVMContext llvm_context;
+    amun::LLVMBackend llvm_backend(llvm_context);
+    Unique<llvm::Module> llvm_ir_module;
+    {
+        amun::PhaseTimeScope time_scope(context->time_profiler, "LLVM IR generation");
+        llvm_ir_module = llvm_backend.compile(source_file, compilation_unit, target_machine.get());
+    }
+
+    set_module_target_attributes(*llvm_ir_module, target_machine.get());
+
+    // Emit the optimized IR if user passed optimization level flag
+    {
+        amun::PhaseTimeScope time_scope(context->time_profiler, "Optimization");
+        auto optimization_level = context->options.optimization_level;
+        amun::optimize_llvm_module(*llvm_ir_module, target_machine.get(), optimization_level);
+    }
 
     std::string ir_file_name = context->options.output_file_name + ".ll";
 
@@ -247,12 +273,157 @@ auto amun::Compiler::emit_llvm_ir_from_source_code(const char* source_file) -> i
     return EXIT_SUCCESS;
 }
 
+auto amun::Compiler::run_source_code(const char* source_file,
+                                     const std::vector<std::string>& program_arguments) -> int
+{
+    auto compilation_unit = parse_source_code(source_file);
+
+    amun::TypeChecker type_checker(context);
+    {
+        amun::PhaseTimeScope time_scope(context->time_profiler, "Type checking");
+        type_checker.check_compilation_unit(compilation_unit);
+    }
+
+    if (context->options.should_report_warns and
+        context->diagnostics.level_count(amun::DiagnosticLevel::WARNING) > 0) {
+        context->diagnostics.report_diagnostics(amun::DiagnosticLevel::WARNING);
+    }
+
+    if (context->diagnostics.level_count(amun::DiagnosticLevel::ERROR) > 0) {
+        context->diagnostics.report_diagnostics(amun::DiagnosticLevel::ERROR);
+        return EXIT_FAILURE;
+    }
+
+    if (context->options.convert_warns_to_errors and
+        context->diagnostics.level_count(amun::DiagnosticLevel::WARNING) > 0) {
+        return EXIT_FAILURE;
+    }
+
+    auto target_machine = create_target_machine();
+    if (target_machine == nullptr) {
+        return EXIT_FAILURE;
+    }
+
+    // The LLVM context is owned by the JIT with the module after generating it
+    auto llvm_context = std::make_unique<llvm::LLVMContext>();
+    Unique<llvm::Module> llvm_ir_module;
+    {
+        amun::PhaseTimeScope time_scope(context->time_profiler, "LLVM IR generation");
+        amun::LLVMBackend llvm_backend(*llvm_context);
+        llvm_ir_module = llvm_backend.compile(source_file, compilation_unit, target_machine.get());
+    }
+
+    auto* main_function = llvm_ir_module->getFunction("main");
+    if (main_function == nullptr) {
+        std::cout << "consider adding a `main` function to " << source_file << "\n";
+        return EXIT_FAILURE;
+    }
+
+    // Main function can return void, in this case the program exit code is success
+    auto is_void_main = main_function->getReturnType()->isVoidTy();
+
+    set_module_target_attributes(*llvm_ir_module, target_machine.get());
+
+    {
+        amun::PhaseTimeScope time_scope(context->time_profiler, "Optimization");
+        auto optimization_level = context->options.optimization_level;
+        amun::optimize_llvm_module(*llvm_ir_module, target_machine.get(), optimization_level);
+    }
+
+    // JIT emit the machine code with the same target used to optimize the module
+    llvm::orc::JITTargetMachineBuilder jit_target_machine_builder(
+        target_machine->getTargetTriple());
+    auto target_features = llvm::SubtargetFeatures(target_machine->getTargetFeatureString());
+    jit_target_machine_builder.setCPU(target_machine->getTargetCPU().str());
+    jit_target_machine_builder.addFeatures(target_features.getFeatures());
+    jit_target_machine_builder.setCodeGenOptLevel(target_machine->getOptLevel());
+
+    auto jit = llvm::orc::LLJITBuilder()
+                   .setJITTargetMachineBuilder(std::move(jit_target_machine_builder))
+                   .create();
+    if (!jit) {
+        std::cout << "Can't create JIT " << llvm::toString(jit.takeError()) << '\n';
+        return EXIT_FAILURE;
+    }
+
+    // External functions such as libc functions are resolved from the compiler process
+    auto& main_library = (*jit)->getMainJITDylib();
+    auto global_prefix = (*jit)->getDataLayout().getGlobalPrefix();
+    auto process_symbols =
+        llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(global_prefix);
+    if (!process_symbols) {
+        std::cout << "Can't load process symbols " << llvm::toString(process_symbols.takeError())
+                  << '\n';
+        return EXIT_FAILURE;
+    }
+    main_library.addGenerator(std::move(*process_symbols));
+
+    // Shared libraries from linker flags are loaded, other flags has no meaning without linker
+    for (const auto& linker_flag : context->options.linker_extra_flags) {
+        if (!amun::is_file_exists(linker_flag)) {
+            std::cout << "Ignore linker flag " << linker_flag << " in run command\n";
+            continue;
+        }
+
+        auto library_symbols =
+            llvm::orc::DynamicLibrarySearchGenerator::Load(linker_flag.c_str(), global_prefix);
+        if (!library_symbols) {
+            std::cout << "Can't load shared library " << linker_flag << " "
+                      << llvm::toString(library_symbols.takeError()) << '\n';
+            return EXIT_FAILURE;
+        }
+        main_library.addGenerator(std::move(*library_symbols));
+    }
+
+    llvm::orc::ThreadSafeModule module(std::move(llvm_ir_module), std::move(llvm_context));
+    if (auto error = (*jit)->addIRModule(std::move(module))) {
+        std::cout << "Can't add module to JIT " << llvm::toString(std::move(error)) << '\n';
+        return EXIT_FAILURE;
+    }
+
+    // Machine code is emitted on the first lookup of the main function
+    llvm::JITTargetAddress main_address;
+    {
+        amun::PhaseTimeScope time_scope(context->time_profiler, "Machine code emission");
+        auto main_symbol = (*jit)->lookup("main");
+        if (!main_symbol) {
+            std::cout << "Can't find main function " << llvm::toString(main_symbol.takeError())
+                      << '\n';
+            return EXIT_FAILURE;
+        }
+        main_address = main_symbol->getAddress();
+    }
+
+    if (auto error = (*jit)->initialize(main_library)) {
+        std::cout << "Can't initialize program " << llvm::toString(std::move(error)) << '\n';
+        return EXIT_FAILURE;
+    }
+
+    int exit_code;
+    {
+        amun::PhaseTimeScope time_scope(context->time_profiler, "Execution");
+        auto* main_pointer = llvm::jitTargetAddressToPointer<int (*)(int, char**)>(main_address);
+        auto program_name = llvm::StringRef(source_file);
+        exit_code = llvm::orc::runAsMain(main_pointer, program_arguments, program_name);
+    }
+
+    if (auto error = (*jit)->deinitialize(main_library)) {
+        std::cout << "Can't deinitialize program " << llvm::toString(std::move(error)) << '\n';
+        return EXIT_FAILURE;
+    }
+
+    return is_void_main ? EXIT_SUCCESS : exit_code;
+}
+
 auto amun::Compiler::check_source_code(const char* source_file) -> int
 {
     auto compilation_unit = parse_source_code(source_file);
 
     amun::TypeChecker type_checker(context);
-    type_checker.check_compilation_unit(compilation_unit);
+    {
+        amun::PhaseTimeScope time_scope(context->time_profiler, "Type checking");
+        type_checker.check_compilation_unit(compilation_unit);
+    }
 
     if (context->options.should_report_warns and
         context->diagnostics.level_count(amun::DiagnosticLevel::WARNING) > 0) {
@@ -273,17 +444,16 @@ auto amun::Compiler::check_source_code(const char* source_file) -> int
     return EXIT_SUCCESS;
 }
 
-auto amun::Compiler::parse_source_code(const char* source_file) -> std::shared_ptr<CompilationUnit>
+auto amun::Compiler::parse_source_code(const char* source_file) -> CompilationUnit*
 {
     if (!amun::is_file_exists(source_file)) {
         amun::loge << "Path " << source_file << " not exists\n";
         exit(EXIT_FAILURE);
     }
 
+    amun::PhaseTimeScope time_scope(context->time_profiler, "Parsing", source_file);
     auto file_id = context->source_manager.register_source_path(source_file);
-    auto source_content = read_file_content(source_file);
-    amun::Tokenizer tokenizer(file_id, source_content);
-    amun::Parser parser(context, tokenizer);
+    amun::Parser parser(context, context->sources_scanner.take_tokens(file_id));
 
     auto compilation_unit = parser.parse_compilation_unit();
 
@@ -294,3 +464,338 @@ auto amun::Compiler::parse_source_code(const char* source_file) -> std::shared_p
 
     return compilation_unit;
 }
+
+auto amun::Compiler::create_target_machine() -> Unique<llvm::TargetMachine>
+{
+    // Initalize native targers
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmParser();
+    llvm::InitializeNativeTargetAsmPrinter();
+
+    // Get current machine target triple
+    auto target_triple = llvm::sys::getDefaultTargetTriple();
+
+    // Check if this target is available
+    std::string lookup_target_error;
+    const auto* target = llvm::TargetRegistry::lookupTarget(target_triple, lookup_target_error);
+    if (!lookup_target_error.empty()) {
+        std::cout << lookup_target_error << '\n';
+        return nullptr;
+    }
+
+    const auto& options = context->options;
+    auto is_native_cpu = options.target_cpu == TARGET_NATIVE_CPU_NAME;
+
+    std::string cpu_name = options.target_cpu;
+    std::stringstream cpu_features_str;
+
+    if (is_native_cpu) {
+        // Get current CPU name and Features
+        cpu_name = llvm::sys::getHostCPUName();
+        llvm::StringMap<bool> host_features;
+        llvm::sys::getHostCPUFeatures(host_features);
+
+        // Append aviable features for this CPU
+        for (const auto& host_feature : host_features) {
+            if (cpu_features_str.rdbuf()->in_avail() > 0) {
+                cpu_features_str << ",";
+            }
+            cpu_features_str << (host_feature.second ? "+" : "-") << host_feature.first().str();
+        }
+    }
+
+    // Explicit features are appended last so they override the host features
+    if (!options.target_features.empty()) {
+        if (cpu_features_str.rdbuf()->in_avail() > 0) {
+            cpu_features_str << ",";
+        }
+        cpu_features_str << options.target_features;
+    }
+
+    llvm::TargetOptions opt;
+    auto rm = llvm::Optional<llvm::Reloc::Model>();
+    auto features = cpu_features_str.str();
+    auto codegen_level = amun::llvm_codegen_optimization_level(options.optimization_level);
+    auto* target_machine = target->createTargetMachine(target_triple, cpu_name, features, opt, rm,
+                                                       llvm::None, codegen_level);
+
+    return Unique<llvm::TargetMachine>(target_machine);
+}
+
+auto amun::Compiler::create_build_cache() -> amun::BuildCache
+{
+    const auto& options = context->options;
+    auto max_size_in_bytes = static_cast<uint64>(options.build_cache_size) * 1024 * 1024;
+    return amun::BuildCache(options.build_cache_directory, max_size_in_bytes);
+}
+
+auto amun::Compiler::emit_program_object_files(const char* source_file,
+                                               CompilationUnit* compilation_unit,
+                                               llvm::TargetMachine* target_machine,
+                                               std::vector<std::string>& linker_flags,
+                                               const std::vector<std::string>& object_files_paths)
+    -> int
+{
+    llvm::LLVMContext llvm_context;
+    amun::LLVMBackend llvm_backend(llvm_context);
+    Unique<llvm::Module> llvm_ir_module;
+    {
+        amun::PhaseTimeScope time_scope(context->time_profiler, "LLVM IR generation");
+        llvm_ir_module = llvm_backend.compile(source_file, compilation_unit, target_machine);
+    }
+
+    // Assert that main function exists to before creating executable file
+    if (llvm_ir_module->getFunction("main") == nullptr) {
+        std::cout << "consider adding a `main` function to " << source_file << "\n";
+        return EXIT_FAILURE;
+    }
+
+    set_module_target_attributes(*llvm_ir_module, target_machine);
+
+    auto optimization_level = context->options.optimization_level;
+    if (context->options.use_link_time_optimization) {
+        // Link the bitcode objects so they can be optimized and inlined with the program
+        if (link_bitcode_object_files(*llvm_ir_module, linker_flags) != EXIT_SUCCESS) {
+            return EXIT_FAILURE;
+        }
+
+        // Only main function must be visible after linking, so unused functions can be removed
+        llvm::internalizeModule(*llvm_ir_module, [](const llvm::GlobalValue& global_value) {
+            return global_value.getName() == "main";
+        });
+
+        amun::PhaseTimeScope time_scope(context->time_profiler, "Optimization");
+        amun::optimize_llvm_module(*llvm_ir_module, target_machine, optimization_level,
+                                   amun::OptimizationPipeline::LINK_TIME);
+    }
+    else {
+        amun::PhaseTimeScope time_scope(context->time_profiler, "Optimization");
+        amun::optimize_llvm_module(*llvm_ir_module, target_machine, optimization_level);
+    }
+
+    if (object_files_paths.size() > 1) {
+        if (emit_object_files_in_parallel(*llvm_ir_module, target_machine,
+                                          object_files_paths) != EXIT_SUCCESS) {
+            return EXIT_FAILURE;
+        }
+    }
+    else if (emit_object_file(*llvm_ir_module, target_machine, object_files_paths[0]) !=
+             EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+auto amun::Compiler::emit_source_object_file(const char* source_file,
+                                             CompilationUnit* compilation_unit,
+                                             llvm::TargetMachine* target_machine,
+                                             const std::string& object_file_path) -> int
+{
+    // Bitcode object functions must be visible to be linked with the other modules
+    llvm::LLVMContext llvm_context;
+    auto should_export_functions = context->options.use_link_time_optimization;
+    amun::LLVMBackend llvm_backend(llvm_context, should_export_functions);
+    Unique<llvm::Module> llvm_ir_module;
+    {
+        amun::PhaseTimeScope time_scope(context->time_profiler, "LLVM IR generation");
+        llvm_ir_module = llvm_backend.compile(source_file, compilation_unit, target_machine);
+    }
+
+    set_module_target_attributes(*llvm_ir_module, target_machine);
+
+    // With link time optimization the object file contains bitcode to be optimized after linking
+    auto optimization_level = context->options.optimization_level;
+    if (context->options.use_link_time_optimization) {
+        {
+            amun::PhaseTimeScope time_scope(context->time_profiler, "Optimization");
+            amun::optimize_llvm_module(*llvm_ir_module, target_machine, optimization_level,
+                                       amun::OptimizationPipeline::PRE_LINK);
+        }
+        return emit_bitcode_file(*llvm_ir_module, object_file_path);
+    }
+
+    {
+        amun::PhaseTimeScope time_scope(context->time_profiler, "Optimization");
+        amun::optimize_llvm_module(*llvm_ir_module, target_machine, optimization_level);
+    }
+    return emit_object_file(*llvm_ir_module, target_machine, object_file_path);
+}
+
+auto amun::Compiler::set_module_target_attributes(llvm::Module& module,
+                                                  llvm::TargetMachine* target_machine) -> void
+{
+    auto cpu_name = target_machine->getTargetCPU();
+    auto features = target_machine->getTargetFeatureString();
+
+    // Tune for the host cpu the same way as `-mcpu=native`
+    auto tune_cpu = context->options.target_tune_cpu;
+    if (tune_cpu == TARGET_NATIVE_CPU_NAME) {
+        tune_cpu = llvm::sys::getHostCPUName().str();
+    }
+
+    // Attach the target information to each function so it still valid after linking modules
+    for (auto& function : module) {
+        if (function.isDeclaration()) {
+            continue;
+        }
+
+        function.addFnAttr("target-cpu", cpu_name);
+
+        if (!features.empty()) {
+            function.addFnAttr("target-features", features);
+        }
+
+        if (!tune_cpu.empty()) {
+            function.addFnAttr("tune-cpu", tune_cpu);
+        }
+    }
+}
+
+auto amun::Compiler::emit_object_file(llvm::Module& module, llvm::TargetMachine* target_machine,
+                                      const std::string& object_file_path) -> int
+{
+    amun::PhaseTimeScope time_scope(context->time_profiler, "Machine code emission");
+    std::error_code object_file_error;
+    auto flags = llvm::sys::fs::OF_None;
+    llvm::raw_fd_ostream stream(object_file_path, object_file_error, flags);
+    if (object_file_error.message() != "Success") {
+        std::cout << "Can't create output file " << object_file_error.message() << '\n';
+        return EXIT_FAILURE;
+    }
+
+    llvm::legacy::PassManager pass_manager;
+    auto file_type = llvm::CGFT_ObjectFile;
+    if (target_machine->addPassesToEmitFile(pass_manager, stream, nullptr, file_type, true)) {
+        std::cout << "Target machine can't emit a file of this type" << '\n';
+        return EXIT_FAILURE;
+    }
+
+    pass_manager.run(module);
+    stream.flush();
+    return EXIT_SUCCESS;
+}
+
+auto amun::Compiler::emit_object_files_in_parallel(
+    llvm::Module& module, llvm::TargetMachine* target_machine,
+    const std::vector<std::string>& object_files_paths) -> int
+{
+    amun::PhaseTimeScope time_scope(context->time_profiler, "Machine code emission");
+    std::vector<Unique<llvm::raw_fd_ostream>> streams;
+    std::vector<llvm::raw_pwrite_stream*> streams_pointers;
+    for (const auto& object_file_path : object_files_paths) {
+        std::error_code object_file_error;
+        auto flags = llvm::sys::fs::OF_None;
+        auto stream = std::make_unique<llvm::raw_fd_ostream>(object_file_path, object_file_error,
+                                                             flags);
+        if (object_file_error.message() != "Success") {
+            std::cout << "Can't create output file " << object_file_error.message() << '\n';
+            return EXIT_FAILURE;
+        }
+        streams_pointers.push_back(stream.get());
+        streams.push_back(std::move(stream));
+    }
+
+    // Target machine is not thread safe, so each thread create one with the same configurations
+    const auto& target = target_machine->getTarget();
+    auto target_triple = target_machine->getTargetTriple().str();
+    auto cpu_name = target_machine->getTargetCPU().str();
+    auto features = target_machine->getTargetFeatureString().str();
+    auto target_options = target_machine->Options;
+    auto relocation_model = target_machine->getRelocationModel();
+    auto code_model = target_machine->getCodeModel();
+    auto codegen_level = target_machine->getOptLevel();
+    auto target_machine_factory = [&]() -> Unique<llvm::TargetMachine> {
+        return Unique<llvm::TargetMachine>(
+            target.createTargetMachine(target_triple, cpu_name, features, target_options,
+                                       relocation_model, code_model, codegen_level));
+    };
+
+    // Each partition is cloned into a separate LLVM context and emitted on the thread pool,
+    // internal symbols stay local so they can't conflict with symbols from other object files
+    llvm::splitCodeGen(module, streams_pointers, {}, target_machine_factory,
+                       llvm::CGFT_ObjectFile, /*PreserveLocals=*/true);
+
+    for (size_t i = 0; i < streams.size(); i++) {
+        if (streams[i]->has_error()) {
+            std::cout << "Can't write output file " << object_files_paths[i] << " "
+                      << streams[i]->error().message() << '\n';
+            streams[i]->clear_error();
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+auto amun::Compiler::emit_bitcode_file(llvm::Module& module, const std::string& bitcode_file_path)
+    -> int
+{
+    amun::PhaseTimeScope time_scope(context->time_profiler, "Bitcode emission");
+    std::error_code bitcode_file_error;
+    llvm::raw_fd_ostream stream(bitcode_file_path, bitcode_file_error, llvm::sys::fs::OF_None);
+    if (bitcode_file_error.message() != "Success") {
+        std::cout << "Can't create output file " << bitcode_file_error.message() << '\n';
+        return EXIT_FAILURE;
+    }
+
+    llvm::WriteBitcodeToFile(module, stream);
+    stream.flush();
+    return EXIT_SUCCESS;
+}
+
+auto amun::Compiler::link_bitcode_object_files(llvm::Module& module,
+                                               std::vector<std::string>& linker_flags) -> int
+{
+    amun::PhaseTimeScope time_scope(context->time_profiler, "Bitcode linking");
+    std::vector<Unique<llvm::Module>> bitcode_modules;
+    std::vector<std::string> native_linker_flags;
+    for (const auto& linker_flag : linker_flags) {
+        // Flags and native object files are passed to the external linker as it is
+        llvm::file_magic file_magic;
+        if (llvm::identify_magic(linker_flag, file_magic) ||
+            file_magic != llvm::file_magic::bitcode) {
+            native_linker_flags.push_back(linker_flag);
+            continue;
+        }
+
+        llvm::SMDiagnostic diagnostic;
+        auto bitcode_module = llvm::parseIRFile(linker_flag, diagnostic, module.getContext());
+        if (bitcode_module == nullptr) {
+            diagnostic.print(linker_flag.c_str(), llvm::errs());
+            return EXIT_FAILURE;
+        }
+        bitcode_modules.push_back(std::move(bitcode_module));
+    }
+
+    // Only main and the symbols declared with @extern in one of the modules are linked by name,
+    // other symbols are internal to their module so functions with the same name never merge
+    llvm::StringSet<> external_symbols = {"main"};
+    auto collect_external_symbols = [&](const llvm::Module& linked_module) {
+        for (const auto& function : linked_module.functions()) {
+            if (function.isDeclaration() && !function.isIntrinsic()) {
+                external_symbols.insert(function.getName());
+            }
+        }
+    };
+
+    collect_external_symbols(module);
+    for (const auto& bitcode_module : bitcode_modules) {
+        collect_external_symbols(*bitcode_module);
+    }
+
+    llvm::Linker linker(module);
+    for (auto& bitcode_module : bitcode_modules) {
+        auto module_name = bitcode_module->getModuleIdentifier();
+        llvm::internalizeModule(*bitcode_module, [&](const llvm::GlobalValue& global_value) {
+            return external_symbols.contains(global_value.getName());
+        });
+
+        if (linker.linkInModule(std::move(bitcode_module))) {
+            std::cout << "Can't link bitcode object file " << module_name << '\n';
+            return EXIT_FAILURE;
+        }
+    }
+
+    linker_flags = native_linker_flags;
+    return EXIT_SUCCESS;
+}
@@ -46,6 +46,112 @@ auto amun::parse_compiler_options(amun::CompilerOptions* options, int argc, char
             continue;
         }
 
+        // Set the optimization level
+        if (amun::parse_optimization_level_flag(argument, &options->optimization_level)) {
+            amun::check_passed_twice_option(received_options, 4, argument);
+            received_options[4] = true;
+            continue;
+        }
+
+        // Enable link time optimization
+        if (strcmp(argument, LINK_TIME_OPTIMIZATION_FLAG) == 0) {
+            amun::check_passed_twice_option(received_options, 8, argument);
+            options->use_link_time_optimization = true;
+            received_options[8] = true;
+            continue;
+        }
+
+        // Set the number of code generation threads
+        if (auto threads = amun::parse_flag_value(argument, CODEGEN_THREADS_FLAG)) {
+            amun::check_passed_twice_option(received_options, 9, argument);
+            char* threads_end = nullptr;
+            auto threads_count = strtol(threads, &threads_end, 10);
+            if (*threads_end != '\0' || threads_count < 1) {
+                printf("Flag `%s` expect positive number of threads, but found `%s`\n",
+                       CODEGEN_THREADS_FLAG, threads);
+                exit(EXIT_FAILURE);
+            }
+            options->codegen_threads = static_cast<unsigned>(threads_count);
+            received_options[9] = true;
+            continue;
+        }
+
+        // Report the time spent in each compilation phase
+        if (strcmp(argument, TIME_REPORT_FLAG) == 0) {
+            amun::check_passed_twice_option(received_options, 10, argument);
+            options->should_report_time = true;
+            received_options[10] = true;
+            continue;
+        }
+
+        // Write the compilation time trace in Chrome trace event format
+        if (auto trace_file_path = amun::parse_flag_value(argument, TIME_TRACE_FLAG)) {
+            amun::check_passed_twice_option(received_options, 11, argument);
+            options->time_trace_file_path = trace_file_path;
+            received_options[11] = true;
+            continue;
+        }
+
+        // Always parse imported and loaded files without reading or writing precompiled modules
+        if (strcmp(argument, NO_MODULES_CACHE_FLAG) == 0) {
+            amun::check_passed_twice_option(received_options, 12, argument);
+            options->use_precompiled_modules = false;
+            received_options[12] = true;
+            continue;
+        }
+
+        // Cache the object files in this directory and reuse them if nothing changed
+        if (auto cache_directory = amun::parse_flag_value(argument, BUILD_CACHE_FLAG)) {
+            amun::check_passed_twice_option(received_options, 13, argument);
+            options->build_cache_directory = cache_directory;
+            received_options[13] = true;
+            continue;
+        }
+
+        // Set the maximum size of the build cache in megabytes
+        if (auto cache_size = amun::parse_flag_value(argument, BUILD_CACHE_SIZE_FLAG)) {
+            amun::check_passed_twice_option(received_options, 14, argument);
+            char* cache_size_end = nullptr;
+            auto cache_size_value = strtol(cache_size, &cache_size_end, 10);
+            if (*cache_size_end != '\0' || cache_size_value < 1) {
+                printf("Flag `%s` expect positive size in megabytes, but found `%s`\n",
+                       BUILD_CACHE_SIZE_FLAG, cache_size);
+                exit(EXIT_FAILURE);
+            }
+            options->build_cache_size = static_cast<unsigned>(cache_size_value);
+            received_options[14] = true;
+            continue;
+        }
+
+        // Set the target cpu name, `-march=` is accepted as alias for `-mcpu=`
+        auto target_cpu = amun::parse_flag_value(argument, TARGET_CPU_FLAG);
+        if (target_cpu == nullptr) {
+            target_cpu = amun::parse_flag_value(argument, TARGET_ARCH_FLAG);
+        }
+
+        if (target_cpu != nullptr) {
+            amun::check_passed_twice_option(received_options, 5, argument);
+            options->target_cpu = target_cpu;
+            received_options[5] = true;
+            continue;
+        }
+
+        // Set the cpu name used for scheduling and tuning decisions only
+        if (auto tune_cpu = amun::parse_flag_value(argument, TARGET_TUNE_CPU_FLAG)) {
+            amun::check_passed_twice_option(received_options, 6, argument);
+            options->target_tune_cpu = tune_cpu;
+            received_options[6] = true;
+            continue;
+        }
+
+        // Set extra target features for example `+avx2,-sse4.1`
+        if (auto features = amun::parse_flag_value(argument, TARGET_FEATURES_FLAG)) {
+            amun::check_passed_twice_option(received_options, 7, argument);
+            options->target_features = features;
+            received_options[7] = true;
+            continue;
+        }
+
         // Accept extra arguments for the external or internal linker
         if (strcmp(argument, LINKER_EXTREA_FLAG) == 0) {
             amun::check_passed_twice_option(received_options, 3, argument);
@@ -62,6 +168,52 @@ auto amun::parse_compiler_options(amun::CompilerOptions* options, int argc, char
     }
 }
 
+auto amun::parse_flag_value(const char* argument, const char* flag) -> const char*
+{
+    auto flag_length = strlen(flag);
+    if (strncmp(argument, flag, flag_length) != 0) {
+        return nullptr;
+    }
+
+    auto value = argument + flag_length;
+    if (*value == '\0') {
+        printf("Flag `%s` expect value after it, but found no thing\n", flag);
+        exit(EXIT_FAILURE);
+    }
+
+    return value;
+}
+
+auto amun::parse_optimization_level_flag(const char* flag, OptimizationLevel* level) -> bool
+{
+    if (strcmp(flag, OPTIMIZATION_LEVEL_0_FLAG) == 0) {
+        *level = OptimizationLevel::O0;
+        return true;
+    }
+
+    if (strcmp(flag, OPTIMIZATION_LEVEL_1_FLAG) == 0) {
+        *level = OptimizationLevel::O1;
+        return true;
+    }
+
+    if (strcmp(flag, OPTIMIZATION_LEVEL_2_FLAG) == 0) {
+        *level = OptimizationLevel::O2;
+        return true;
+    }
+
+    if (strcmp(flag, OPTIMIZATION_LEVEL_3_FLAG) == 0) {
+        *level = OptimizationLevel::O3;
+        return true;
+    }
+
+    if (strcmp(flag, OPTIMIZATION_LEVEL_S_FLAG) == 0) {
+        *level = OptimizationLevel::Os;
+        return true;
+    }
+
+    return false;
+}
+
 auto amun::check_passed_twice_option(const bool received_options[], int index, char* arg) -> void
 {
     if (received_options[index]) {
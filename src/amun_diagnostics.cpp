@@ -1,5 +1,4 @@
 #include "../include/amun_diagnostics.hpp"
-#include "../include/amun_files.hpp"
 
 #include <iostream>
 #include <string>
@@ -12,35 +11,35 @@ amun::DiagnosticEngine::DiagnosticEngine(amun::SourceManager& source_manager)
 
 auto amun::DiagnosticEngine::report_diagnostics(DiagnosticLevel level) -> void
 {
-    auto kind_diagnostics = diagnostics[level];
-    for (auto& diagnostic : kind_diagnostics) {
-        report_diagnostic(diagnostic);
+    // Render all diagnostics into one buffer so they are written to the output at once
+    std::string output;
+    for (const auto& diagnostic : diagnostics[level]) {
+        render_diagnostic(diagnostic, output);
     }
+    std::cout << output << std::flush;
 }
 
-auto amun::DiagnosticEngine::report_diagnostic(amun::Diagnostic& diagnostic) -> void
+auto amun::DiagnosticEngine::render_diagnostic(const amun::Diagnostic& diagnostic,
+                                               std::string& output) -> void
 {
     auto location = diagnostic.location;
-    auto message = diagnostic.message;
     auto file_name = source_manager.resolve_source_path(location.file_id);
     auto line_number = location.line_number;
-    auto source_line = amun::read_file_line(file_name.c_str(), line_number);
+    auto source_line = source_manager.resolve_source_line(location.file_id, line_number);
 
     const auto* kind_literal = diagnostic_level_literal[diagnostic.level];
 
-    std::cout << kind_literal << " in " << file_name << ':' << std::to_string(line_number) << ':'
-              << std::to_string(location.column_start) << std::endl;
+    output.append(kind_literal).append(" in ").append(file_name);
+    output.append(":").append(std::to_string(line_number));
+    output.append(":").append(std::to_string(location.column_start)).append("\n");
 
     auto line_number_header = std::to_string(line_number) + " | ";
-    std::cout << line_number_header << source_line << std::endl;
+    output.append(line_number_header).append(source_line).append("\n");
 
     auto header_size = line_number_header.size();
-    for (size_t i = 0; i < location.column_start + header_size; i++) {
-        std::cout << "~";
-    }
+    output.append(location.column_start + header_size, '~');
 
-    std::cout << "^ " << message << std::endl;
-    std::cout << std::endl;
+    output.append("^ ").append(diagnostic.message).append("\n\n");
 }
 
 auto amun::DiagnosticEngine::report_error(TokenSpan location, std::string message) -> void
@@ -1,43 +1,59 @@
-#include <sstream>
-
 #include "../include/amun_external_linker.hpp"
 
-auto amun::ExternalLinker::link(std::string object_file_path) -> int
-{
-    std::stringstream linker_command_builder;
+#include <llvm/ADT/StringRef.h>
+
+#include <iostream>
 
-    // Append linker name
-    linker_command_builder << current_linker_name;
+auto amun::ExternalLinker::link(const std::vector<std::string>& object_files_paths) -> int
+{
+    // Linker is executed directly with the arguments without starting a shell to parse them
+    std::vector<llvm::StringRef> linker_arguments;
+    linker_arguments.reserve(linker_flags.size() + object_files_paths.size() +
+                             linker_libraries.size() + 3);
+    linker_arguments.emplace_back(current_linker_name);
 
-    // Append linker flags
     for (const auto& linker_flag : linker_flags) {
-        linker_command_builder << " " + linker_flag;
+        linker_arguments.emplace_back(linker_flag);
     }
 
-    // Append object field path
-    linker_command_builder << " " + object_file_path;
-
-    // Set name for executable file to be the same name of oject file but removing .o extension
-    linker_command_builder << " -o ";
-    linker_command_builder << object_file_path.erase(object_file_path.size() - 2);
+    for (const auto& object_file_path : object_files_paths) {
+        linker_arguments.emplace_back(object_file_path);
+    }
 
-    // Build the full linker command
-    const std::string linker_coomand = linker_command_builder.str();
+    for (const auto& linker_library : linker_libraries) {
+        linker_arguments.emplace_back(linker_library);
+    }
 
-    // Execute the command
-    return std::system(linker_coomand.c_str());
+    // Set name for executable file to be the name of the first object file without .o extension
+    const auto& main_object_file_path = object_files_paths.front();
+    auto executable_path = main_object_file_path.substr(0, main_object_file_path.size() - 2);
+    linker_arguments.emplace_back("-o");
+    linker_arguments.emplace_back(executable_path);
+
+    std::string error_message;
+    auto result = llvm::sys::ExecuteAndWait(current_linker_path, linker_arguments, llvm::None,
+                                            {}, 0, 0, &error_message);
+    if (result < 0) {
+        std::cout << "Can't execute " << current_linker_name << ": " << error_message << '\n';
+    }
+    return result;
 }
 
 auto amun::ExternalLinker::check_aviable_linker() -> bool
 {
+    if (!current_linker_path.empty()) {
+        return true;
+    }
+
     for (const auto& linker_name : potentials_linkes_names) {
         auto optional_path = llvm::sys::findProgramByName(linker_name);
         if (auto error_code = optional_path.getError()) {
             continue;
         }
         current_linker_name = linker_name;
+        current_linker_path = *optional_path;
         return true;
     }
 
     return false;
-}
\ No newline at end of file
+}
@@ -12,18 +12,6 @@ auto amun::read_file_content(const char* file_path) -> std::string
     return content;
 }
 
-auto amun::read_file_line(const char* file_path, int line_number) -> std::string
-{
-    std::ifstream file(file_path);
-    int current_line_number = 1;
-    for (std::string line; std::getline(file, line); current_line_number++) {
-        if (current_line_number == line_number) {
-            return line;
-        }
-    }
-    return "";
-}
-
 auto amun::create_file_with_content(const std::string& path, const std::string& content) -> void
 {
     std::ofstream of_stream(path);
@@ -42,6 +30,15 @@ auto amun::find_parent_path(const std::string& path) -> std::string
     return file_system_path.parent_path().string();
 }
 
+auto amun::find_parent_directory(const std::string& path) -> std::string
+{
+    auto parent_path = find_parent_path(path);
+    if (!parent_path.empty() && !parent_path.ends_with(file_spreator())) {
+        parent_path += file_spreator();
+    }
+    return parent_path;
+}
+
 auto amun::is_file_exists(const std::string& path) -> bool { return std::filesystem::exists(path); }
 
 auto amun::file_spreator() -> char { return std::filesystem::path::preferred_separator; }
\ No newline at end of file
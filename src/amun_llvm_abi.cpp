@@ -0,0 +1,591 @@
+#include "../include/amun_llvm_abi.hpp"
+#include "../include/amun_basic.hpp"
+
+#include <llvm/IR/Attributes.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/DataLayout.h>
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/InstIterator.h>
+#include <llvm/IR/Instructions.h>
+
+#include <algorithm>
+#include <vector>
+
+// System V x86-64 classes of the eightbytes (8 bytes parts) of the value
+enum class EightbyteClass {
+    NO_CLASS,
+    INTEGER,
+    SSE,
+    MEMORY,
+};
+
+// How the value is passed, as it is, in registers with the coerced types or by pointer to memory
+enum class ArgumentKind {
+    DIRECT,
+    COERCED,
+    INDIRECT,
+};
+
+struct LoweredArgument {
+    ArgumentKind kind = ArgumentKind::DIRECT;
+    llvm::Type* type = nullptr;
+    std::vector<llvm::Type*> coerced_types;
+};
+
+struct LoweredSignature {
+    LoweredArgument return_value;
+    std::vector<LoweredArgument> arguments;
+    bool has_lowered_values = false;
+};
+
+// The number of registers that are still available to pass the arguments
+struct AvailableRegisters {
+    int integers = 6;
+    int sse = 8;
+};
+
+static auto merge_classes(EightbyteClass first, EightbyteClass second) -> EightbyteClass
+{
+    if (first == second || second == EightbyteClass::NO_CLASS) {
+        return first;
+    }
+
+    if (first == EightbyteClass::NO_CLASS) {
+        return second;
+    }
+
+    if (first == EightbyteClass::MEMORY || second == EightbyteClass::MEMORY) {
+        return EightbyteClass::MEMORY;
+    }
+
+    if (first == EightbyteClass::INTEGER || second == EightbyteClass::INTEGER) {
+        return EightbyteClass::INTEGER;
+    }
+
+    return EightbyteClass::SSE;
+}
+
+static auto classify_type(const llvm::DataLayout& data_layout, llvm::Type* type, uint64 offset,
+                          EightbyteClass classes[2]) -> void
+{
+    if (auto* struct_type = llvm::dyn_cast<llvm::StructType>(type)) {
+        auto* struct_layout = data_layout.getStructLayout(struct_type);
+        for (unsigned i = 0; i < struct_type->getNumElements(); i++) {
+            auto* field_type = struct_type->getElementType(i);
+            auto field_offset = offset + struct_layout->getElementOffset(i);
+
+            // Fields that are not aligned in packed structs must be passed in memory
+            if (field_offset % data_layout.getABITypeAlignment(field_type) != 0) {
+                classes[0] = EightbyteClass::MEMORY;
+                return;
+            }
+
+            classify_type(data_layout, field_type, field_offset, classes);
+        }
+        return;
+    }
+
+    if (auto* array_type = llvm::dyn_cast<llvm::ArrayType>(type)) {
+        auto* element_type = array_type->getElementType();
+        auto element_size = data_layout.getTypeAllocSize(element_type).getFixedSize();
+        for (uint64 i = 0; i < array_type->getNumElements(); i++) {
+            classify_type(data_layout, element_type, offset + i * element_size, classes);
+        }
+        return;
+    }
+
+    auto size = data_layout.getTypeStoreSize(type).getFixedSize();
+    auto value_class = EightbyteClass::MEMORY;
+    if ((type->isIntegerTy() && size <= 8) || type->isPointerTy()) {
+        value_class = EightbyteClass::INTEGER;
+    }
+    else if (type->isFloatTy() || type->isDoubleTy() || (type->isVectorTy() && size == 8)) {
+        value_class = EightbyteClass::SSE;
+    }
+
+    // Values that cross the eightbyte boundary can't be passed in registers
+    if (offset % 8 + size > 8) {
+        value_class = EightbyteClass::MEMORY;
+    }
+
+    auto index = offset / 8;
+    classes[index] = merge_classes(classes[index], value_class);
+}
+
+static auto is_aggregate_type(llvm::Type* type) -> bool
+{
+    return type->isStructTy() || type->isArrayTy();
+}
+
+// Classify the aggregate and set the types of its eightbytes, or return false if it's in memory
+static auto classify_aggregate(const llvm::DataLayout& data_layout, LoweredArgument& value)
+    -> bool
+{
+    auto size = data_layout.getTypeAllocSize(value.type).getFixedSize();
+    if (size > 16) {
+        return false;
+    }
+
+    EightbyteClass classes[2] = {EightbyteClass::NO_CLASS, EightbyteClass::NO_CLASS};
+    classify_type(data_layout, value.type, 0, classes);
+
+    auto& context = value.type->getContext();
+    auto eightbytes_count = (size + 7) / 8;
+    for (uint64 i = 0; i < eightbytes_count; i++) {
+        if (classes[i] == EightbyteClass::MEMORY) {
+            value.coerced_types.clear();
+            return false;
+        }
+
+        // Floats and doubles in the same eightbyte are passed as bits in the same SSE register
+        auto eightbyte_size = std::min<uint64>(8, size - i * 8);
+        if (classes[i] == EightbyteClass::SSE) {
+            value.coerced_types.push_back(eightbyte_size <= 4 ? llvm::Type::getFloatTy(context)
+                                                              : llvm::Type::getDoubleTy(context));
+        }
+        else {
+            value.coerced_types.push_back(llvm::IntegerType::get(context, eightbyte_size * 8));
+        }
+    }
+    return true;
+}
+
+static auto lower_argument(const llvm::DataLayout& data_layout, llvm::Type* type,
+                           AvailableRegisters& registers) -> LoweredArgument
+{
+    LoweredArgument argument;
+    argument.type = type;
+
+    if (!is_aggregate_type(type)) {
+        if (type->isFloatingPointTy() || type->isVectorTy()) {
+            registers.sse--;
+        }
+        else {
+            registers.integers--;
+        }
+        return argument;
+    }
+
+    // Empty aggregates has no values to pass
+    if (data_layout.getTypeAllocSize(type).getFixedSize() == 0) {
+        return argument;
+    }
+
+    argument.kind = ArgumentKind::INDIRECT;
+    if (!classify_aggregate(data_layout, argument)) {
+        return argument;
+    }
+
+    int needed_integers = 0;
+    int needed_sse = 0;
+    for (auto* coerced_type : argument.coerced_types) {
+        coerced_type->isIntegerTy() ? needed_integers++ : needed_sse++;
+    }
+
+    // Aggregate is passed in memory if it can't be passed completely in the registers
+    if (needed_integers > registers.integers || needed_sse > registers.sse) {
+        argument.coerced_types.clear();
+        return argument;
+    }
+
+    registers.integers -= needed_integers;
+    registers.sse -= needed_sse;
+    argument.kind = ArgumentKind::COERCED;
+    return argument;
+}
+
+static auto lower_signature(const llvm::DataLayout& data_layout,
+                            llvm::FunctionType* function_type,
+                            llvm::ArrayRef<llvm::Type*> varargs_types) -> LoweredSignature
+{
+    LoweredSignature signature;
+    AvailableRegisters registers;
+
+    auto* return_type = function_type->getReturnType();
+    signature.return_value.type = return_type;
+    if (is_aggregate_type(return_type) &&
+        data_layout.getTypeAllocSize(return_type).getFixedSize() != 0) {
+        if (classify_aggregate(data_layout, signature.return_value)) {
+            signature.return_value.kind = ArgumentKind::COERCED;
+        }
+        else {
+            // Pointer to the return value memory is passed in the first integer register
+            signature.return_value.kind = ArgumentKind::INDIRECT;
+            registers.integers--;
+        }
+    }
+
+    for (auto* parameter_type : function_type->params()) {
+        signature.arguments.push_back(lower_argument(data_layout, parameter_type, registers));
+    }
+
+    for (auto* vararg_type : varargs_types) {
+        signature.arguments.push_back(lower_argument(data_layout, vararg_type, registers));
+    }
+
+    signature.has_lowered_values = signature.return_value.kind != ArgumentKind::DIRECT;
+    for (const auto& argument : signature.arguments) {
+        signature.has_lowered_values |= argument.kind != ArgumentKind::DIRECT;
+    }
+    return signature;
+}
+
+static auto coerced_type(const LoweredArgument& value) -> llvm::Type*
+{
+    if (value.coerced_types.size() == 1) {
+        return value.coerced_types[0];
+    }
+    return llvm::StructType::get(value.type->getContext(), value.coerced_types);
+}
+
+static auto lowered_function_type(const LoweredSignature& signature,
+                                  llvm::FunctionType* function_type) -> llvm::FunctionType*
+{
+    const auto& return_value = signature.return_value;
+    auto* return_type = return_value.type;
+    std::vector<llvm::Type*> parameters;
+    if (return_value.kind == ArgumentKind::INDIRECT) {
+        parameters.push_back(return_type->getPointerTo());
+        return_type = llvm::Type::getVoidTy(return_type->getContext());
+    }
+    else if (return_value.kind == ArgumentKind::COERCED) {
+        return_type = coerced_type(return_value);
+    }
+
+    // Varargs values are not part of the function type
+    for (unsigned i = 0; i < function_type->getNumParams(); i++) {
+        const auto& argument = signature.arguments[i];
+        if (argument.kind == ArgumentKind::DIRECT) {
+            parameters.push_back(argument.type);
+        }
+        else if (argument.kind == ArgumentKind::COERCED) {
+            parameters.insert(parameters.end(), argument.coerced_types.begin(),
+                              argument.coerced_types.end());
+        }
+        else {
+            parameters.push_back(argument.type->getPointerTo());
+        }
+    }
+
+    return llvm::FunctionType::get(return_type, parameters, function_type->isVarArg());
+}
+
+static auto lowered_attributes(const llvm::DataLayout& data_layout,
+                               const LoweredSignature& signature, llvm::AttributeSet attributes)
+    -> llvm::AttributeList
+{
+    auto& context = signature.return_value.type->getContext();
+    std::vector<llvm::AttributeSet> parameters_attributes;
+
+    const auto& return_value = signature.return_value;
+    if (return_value.kind == ArgumentKind::INDIRECT) {
+        llvm::AttrBuilder builder(context);
+        builder.addStructRetAttr(return_value.type);
+        builder.addAttribute(llvm::Attribute::NoAlias);
+        builder.addAlignmentAttr(data_layout.getABITypeAlign(return_value.type));
+        parameters_attributes.push_back(llvm::AttributeSet::get(context, builder));
+    }
+
+    for (const auto& argument : signature.arguments) {
+        if (argument.kind == ArgumentKind::COERCED) {
+            parameters_attributes.insert(parameters_attributes.end(),
+                                         argument.coerced_types.size(), {});
+        }
+        else if (argument.kind == ArgumentKind::INDIRECT) {
+            // Values passed in memory are copied to the stack aligned to at least 8 bytes
+            llvm::AttrBuilder builder(context);
+            builder.addByValAttr(argument.type);
+            auto alignment = std::max(llvm::Align(8), data_layout.getABITypeAlign(argument.type));
+            builder.addAlignmentAttr(alignment);
+            parameters_attributes.push_back(llvm::AttributeSet::get(context, builder));
+        }
+        else {
+            parameters_attributes.emplace_back();
+        }
+    }
+
+    return llvm::AttributeList::get(context, attributes, {}, parameters_attributes);
+}
+
+// Temporary memory in the entry block that is large enough for the value and its coerced type
+static auto create_entry_slot(llvm::Function* function, llvm::Type* type, llvm::Type* other_type)
+    -> llvm::AllocaInst*
+{
+    const auto& data_layout = function->getParent()->getDataLayout();
+    if (other_type != nullptr && data_layout.getTypeAllocSize(other_type).getFixedSize() >
+                                     data_layout.getTypeAllocSize(type).getFixedSize()) {
+        std::swap(type, other_type);
+    }
+
+    auto alignment = data_layout.getPrefTypeAlign(type);
+    if (other_type != nullptr) {
+        alignment = std::max(alignment, data_layout.getPrefTypeAlign(other_type));
+    }
+
+    auto& entry_block = function->getEntryBlock();
+    llvm::IRBuilder<> builder(&entry_block, entry_block.begin());
+    auto* slot = builder.CreateAlloca(type);
+    slot->setAlignment(alignment);
+    return slot;
+}
+
+// Split the value into its coerced eightbytes values
+static auto value_to_coerced(llvm::IRBuilder<>& builder, llvm::Value* value,
+                             const LoweredArgument& lowered) -> std::vector<llvm::Value*>
+{
+    auto* function = builder.GetInsertBlock()->getParent();
+    auto* type = coerced_type(lowered);
+    auto* slot = create_entry_slot(function, lowered.type, type);
+    builder.CreateStore(value, builder.CreateBitCast(slot, lowered.type->getPointerTo()));
+
+    auto* coerced_pointer = builder.CreateBitCast(slot, type->getPointerTo());
+    if (lowered.coerced_types.size() == 1) {
+        return {builder.CreateLoad(type, coerced_pointer)};
+    }
+
+    std::vector<llvm::Value*> values;
+    for (unsigned i = 0; i < lowered.coerced_types.size(); i++) {
+        auto* pointer = builder.CreateStructGEP(type, coerced_pointer, i);
+        values.push_back(builder.CreateLoad(lowered.coerced_types[i], pointer));
+    }
+    return values;
+}
+
+// Rebuild the value from its coerced eightbytes values
+static auto coerced_to_value(llvm::IRBuilder<>& builder, llvm::ArrayRef<llvm::Value*> values,
+                             const LoweredArgument& lowered) -> llvm::Value*
+{
+    auto* function = builder.GetInsertBlock()->getParent();
+    auto* type = coerced_type(lowered);
+    auto* slot = create_entry_slot(function, lowered.type, type);
+
+    auto* coerced_pointer = builder.CreateBitCast(slot, type->getPointerTo());
+    if (values.size() == 1) {
+        builder.CreateStore(values[0], coerced_pointer);
+    }
+    else {
+        for (unsigned i = 0; i < values.size(); i++) {
+            builder.CreateStore(values[i], builder.CreateStructGEP(type, coerced_pointer, i));
+        }
+    }
+
+    auto* value_pointer = builder.CreateBitCast(slot, lowered.type->getPointerTo());
+    return builder.CreateLoad(lowered.type, value_pointer);
+}
+
+static auto lower_function_body(llvm::Function* function, llvm::Function* lowered_function,
+                                const LoweredSignature& signature) -> void
+{
+    lowered_function->getBasicBlockList().splice(lowered_function->begin(),
+                                                 function->getBasicBlockList());
+
+    auto& entry_block = lowered_function->getEntryBlock();
+    llvm::IRBuilder<> builder(&entry_block, entry_block.begin());
+
+    unsigned index = 0;
+    llvm::Argument* return_pointer = nullptr;
+    if (signature.return_value.kind == ArgumentKind::INDIRECT) {
+        return_pointer = lowered_function->getArg(index++);
+        return_pointer->setName("agg.result");
+    }
+
+    for (auto& argument : function->args()) {
+        const auto& lowered = signature.arguments[argument.getArgNo()];
+        if (lowered.kind == ArgumentKind::DIRECT) {
+            auto* lowered_argument = lowered_function->getArg(index++);
+            lowered_argument->takeName(&argument);
+            argument.replaceAllUsesWith(lowered_argument);
+            continue;
+        }
+
+        if (lowered.kind == ArgumentKind::INDIRECT) {
+            auto* lowered_argument = lowered_function->getArg(index++);
+            lowered_argument->setName(argument.getName());
+            argument.replaceAllUsesWith(builder.CreateLoad(lowered.type, lowered_argument));
+            continue;
+        }
+
+        std::vector<llvm::Value*> coerced_values;
+        for (size_t i = 0; i < lowered.coerced_types.size(); i++) {
+            auto* lowered_argument = lowered_function->getArg(index++);
+            lowered_argument->setName(argument.getName() + ".coerce" + std::to_string(i));
+            coerced_values.push_back(lowered_argument);
+        }
+        argument.replaceAllUsesWith(coerced_to_value(builder, coerced_values, lowered));
+    }
+
+    const auto& return_value = signature.return_value;
+    if (return_value.kind == ArgumentKind::DIRECT) {
+        return;
+    }
+
+    std::vector<llvm::ReturnInst*> returns;
+    for (auto& instruction : llvm::instructions(lowered_function)) {
+        if (auto* return_instruction = llvm::dyn_cast<llvm::ReturnInst>(&instruction)) {
+            returns.push_back(return_instruction);
+        }
+    }
+
+    for (auto* return_instruction : returns) {
+        builder.SetInsertPoint(return_instruction);
+        auto* value = return_instruction->getReturnValue();
+        if (return_value.kind == ArgumentKind::INDIRECT) {
+            builder.CreateStore(value, return_pointer);
+            builder.CreateRetVoid();
+        }
+        else {
+            auto coerced_values = value_to_coerced(builder, value, return_value);
+            if (coerced_values.size() == 1) {
+                builder.CreateRet(coerced_values[0]);
+            }
+            else {
+                llvm::Value* coerced_value = llvm::UndefValue::get(coerced_type(return_value));
+                for (unsigned i = 0; i < coerced_values.size(); i++) {
+                    coerced_value = builder.CreateInsertValue(coerced_value, coerced_values[i], i);
+                }
+                builder.CreateRet(coerced_value);
+            }
+        }
+        return_instruction->eraseFromParent();
+    }
+}
+
+static auto lower_function(llvm::Function* function) -> void
+{
+    const auto& data_layout = function->getParent()->getDataLayout();
+    auto signature = lower_signature(data_layout, function->getFunctionType(), {});
+    if (!signature.has_lowered_values) {
+        return;
+    }
+
+    auto* lowered_type = lowered_function_type(signature, function->getFunctionType());
+    auto* lowered_function = llvm::Function::Create(lowered_type, function->getLinkage(),
+                                                    function->getAddressSpace(), "", nullptr);
+    function->getParent()->getFunctionList().insert(function->getIterator(), lowered_function);
+    lowered_function->copyAttributesFrom(function);
+    lowered_function->setAttributes(lowered_attributes(
+        data_layout, signature, function->getAttributes().getFnAttrs()));
+    lowered_function->takeName(function);
+
+    if (!function->isDeclaration()) {
+        lower_function_body(function, lowered_function, signature);
+    }
+
+    // Functions used as values are casted to the old type and lowered when they are called
+    function->replaceAllUsesWith(
+        llvm::ConstantExpr::getBitCast(lowered_function, function->getType()));
+    function->eraseFromParent();
+}
+
+static auto lower_call(llvm::CallInst* call) -> void
+{
+    auto* function_type = call->getFunctionType();
+    std::vector<llvm::Type*> varargs_types;
+    for (unsigned i = function_type->getNumParams(); i < call->arg_size(); i++) {
+        varargs_types.push_back(call->getArgOperand(i)->getType());
+    }
+
+    auto* function = call->getFunction();
+    const auto& data_layout = function->getParent()->getDataLayout();
+    auto signature = lower_signature(data_layout, function_type, varargs_types);
+    if (!signature.has_lowered_values) {
+        return;
+    }
+
+    llvm::IRBuilder<> builder(call);
+    auto* lowered_type = lowered_function_type(signature, function_type);
+    auto* callee = builder.CreateBitCast(call->getCalledOperand(), lowered_type->getPointerTo());
+
+    const auto& return_value = signature.return_value;
+    std::vector<llvm::Value*> arguments;
+    llvm::AllocaInst* return_slot = nullptr;
+    if (return_value.kind == ArgumentKind::INDIRECT) {
+        return_slot = create_entry_slot(function, return_value.type, nullptr);
+        arguments.push_back(return_slot);
+    }
+
+    for (unsigned i = 0; i < call->arg_size(); i++) {
+        auto* value = call->getArgOperand(i);
+        const auto& lowered = signature.arguments[i];
+        if (lowered.kind == ArgumentKind::DIRECT) {
+            arguments.push_back(value);
+        }
+        else if (lowered.kind == ArgumentKind::COERCED) {
+            auto coerced_values = value_to_coerced(builder, value, lowered);
+            arguments.insert(arguments.end(), coerced_values.begin(), coerced_values.end());
+        }
+        else {
+            auto* slot = create_entry_slot(function, lowered.type, nullptr);
+            builder.CreateStore(value, slot);
+            arguments.push_back(slot);
+        }
+    }
+
+    auto* lowered_call = builder.CreateCall(lowered_type, callee, arguments);
+    lowered_call->setCallingConv(call->getCallingConv());
+    lowered_call->setAttributes(
+        lowered_attributes(data_layout, signature, call->getAttributes().getFnAttrs()));
+
+    llvm::Value* result = lowered_call;
+    if (return_value.kind == ArgumentKind::INDIRECT) {
+        result = builder.CreateLoad(return_value.type, return_slot);
+    }
+    else if (return_value.kind == ArgumentKind::COERCED) {
+        std::vector<llvm::Value*> coerced_values;
+        if (return_value.coerced_types.size() == 1) {
+            coerced_values.push_back(lowered_call);
+        }
+        else {
+            for (unsigned i = 0; i < return_value.coerced_types.size(); i++) {
+                coerced_values.push_back(builder.CreateExtractValue(lowered_call, i));
+            }
+        }
+        result = coerced_to_value(builder, coerced_values, return_value);
+    }
+
+    if (!call->getType()->isVoidTy()) {
+        result->takeName(call);
+        call->replaceAllUsesWith(result);
+    }
+    call->eraseFromParent();
+}
+
+auto amun::lower_platform_abi(llvm::Module& module, const llvm::Triple& target_triple) -> void
+{
+    if (target_triple.getArch() != llvm::Triple::x86_64 || target_triple.isOSWindows()) {
+        return;
+    }
+
+    std::vector<llvm::Function*> functions;
+    for (auto& function : module) {
+        if (!function.isIntrinsic()) {
+            functions.push_back(&function);
+        }
+    }
+
+    for (auto* function : functions) {
+        lower_function(function);
+    }
+
+    // Direct and indirect calls are lowered using the function type of the call, so functions
+    // called by pointers are called the same way as they are lowered
+    std::vector<llvm::CallInst*> calls;
+    for (auto& function : module) {
+        for (auto& instruction : llvm::instructions(function)) {
+            auto* call = llvm::dyn_cast<llvm::CallInst>(&instruction);
+            if (call == nullptr || call->isInlineAsm()) {
+                continue;
+            }
+
+            auto* callee = call->getCalledFunction();
+            if (callee == nullptr || !callee->isIntrinsic()) {
+                calls.push_back(call);
+            }
+        }
+    }
+
+    for (auto* call : calls) {
+        lower_call(call);
+    }
+}
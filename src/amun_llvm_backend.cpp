@@ -1,6 +1,6 @@
 #include "../include/amun_llvm_backend.hpp"
 #include "../include/amun_ast_visitor.hpp"
-#include "../include/amun_llvm_builder.hpp"
+#include "../include/amun_llvm_abi.hpp"
 #include "../include/amun_llvm_intrinsic.hpp"
 #include "../include/amun_logger.hpp"
 #include "../include/amun_name_mangle.hpp"
@@ -18,16 +18,41 @@
 #include <llvm/IR/Value.h>
 #include <llvm/IR/Verifier.h>
 #include <llvm/Support/Casting.h>
+#include <llvm/Support/TimeProfiler.h>
 
-#include <any>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
-auto amun::LLVMBackend::compile(std::string module_name, Shared<CompilationUnit> compilation_unit)
+amun::LLVMBackend::LLVMBackend(llvm::LLVMContext& llvm_context, bool should_export_functions)
+    : llvm_context(llvm_context), Builder(llvm_context),
+      llvm_int1_type(llvm::Type::getInt1Ty(llvm_context)),
+      llvm_int8_type(llvm::Type::getInt8Ty(llvm_context)),
+      llvm_int16_type(llvm::Type::getInt16Ty(llvm_context)),
+      llvm_int32_type(llvm::Type::getInt32Ty(llvm_context)),
+      llvm_int64_type(llvm::Type::getInt64Ty(llvm_context)),
+      llvm_int64_ptr_type(llvm::Type::getInt64PtrTy(llvm_context)),
+      llvm_int8_ptr_type(llvm::Type::getInt8PtrTy(llvm_context)),
+      llvm_float32_type(llvm::Type::getFloatTy(llvm_context)),
+      llvm_float64_type(llvm::Type::getDoubleTy(llvm_context)),
+      llvm_void_type(llvm::Type::getVoidTy(llvm_context)),
+      llvm_void_ptr_type(llvm::PointerType::get(llvm_int8_type, 0)),
+      false_value(Builder.getInt1(false)), zero_int32_value(Builder.getInt32(0)),
+      should_export_functions(should_export_functions)
+{
+    alloca_inst_table.push_new_scope();
+}
+
+auto amun::LLVMBackend::compile(std::string module_name, CompilationUnit* compilation_unit,
+                                llvm::TargetMachine* target_machine)
     -> std::unique_ptr<llvm::Module>
 {
     llvm_module = std::make_unique<llvm::Module>(module_name, llvm_context);
+
+    // Data layout must be set before code generation to compute types sizes and alignments
+    llvm_module->setDataLayout(target_machine->createDataLayout());
+    llvm_module->setTargetTriple(target_machine->getTargetTriple().str());
     try {
         for (const auto& statement : compilation_unit->tree_nodes) {
             statement->accept(this);
@@ -36,10 +61,13 @@ auto amun::LLVMBackend::compile(std::string module_name, Shared<CompilationUnit>
     catch (...) {
         amun::loge << "LLVM Backend Exception \n";
     }
+
+    // Structs values are lowered after generating all functions and calls that use them
+    amun::lower_platform_abi(*llvm_module, target_machine->getTargetTriple());
     return std::move(llvm_module);
 }
 
-auto amun::LLVMBackend::visit(BlockStatement* node) -> std::any
+auto amun::LLVMBackend::visit(BlockStatement* node) -> llvm::Value*
 {
     push_alloca_inst_scope();
     defer_calls_stack.top().push_new_scope();
@@ -51,7 +79,9 @@ auto amun::LLVMBackend::visit(BlockStatement* node) -> std::any
             execute_all_defer_calls();
         }
 
+        stack_slots_stack.top().begin_statement();
         statement->accept(this);
+        stack_slots_stack.top().end_statement(Builder);
 
         // In the same block there are no needs to generate code for unreachable code
         if (ast_node_type == AstNodeType::AST_RETURN or ast_node_type == AstNodeType::AST_BREAK or
@@ -66,21 +96,21 @@ auto amun::LLVMBackend::visit(BlockStatement* node) -> std::any
 
     defer_calls_stack.top().pop_current_scope();
     pop_alloca_inst_scope();
-    return 0;
+    return nullptr;
 }
 
-auto amun::LLVMBackend::visit(FieldDeclaration* node) -> std::any
+auto amun::LLVMBackend::visit(FieldDeclaration* node) -> llvm::Value*
 {
-    auto var_name = node->name.literal;
+    auto var_name = std::string(node->name.literal);
     auto field_type = node->type;
     if (field_type->type_kind == amun::TypeKind::GENERIC_PARAMETER) {
-        auto generic = std::static_pointer_cast<amun::GenericParameterType>(field_type);
+        auto generic = static_cast<amun::GenericParameterType*>(field_type);
         field_type = generic_types[generic->name];
     }
 
     llvm::Type* llvm_type;
     if (field_type->type_kind == amun::TypeKind::GENERIC_STRUCT) {
-        auto generic_type = std::static_pointer_cast<amun::GenericStructType>(field_type);
+        auto generic_type = static_cast<amun::GenericStructType*>(field_type);
         llvm_type = resolve_generic_struct(generic_type);
     }
     else {
@@ -103,11 +133,11 @@ auto amun::LLVMBackend::visit(FieldDeclaration* node) -> std::any
             new llvm::GlobalVariable(*llvm_module, llvm_type, false,
                                      llvm::GlobalValue::ExternalLinkage, constants_value, var_name);
         global_variable->setAlignment(llvm::MaybeAlign(0));
-        return 0;
+        return nullptr;
     }
 
     // if field has initalizer evaluate it, else initalize it with default value
-    std::any value;
+    llvm::Value* value;
     if (node->value == nullptr) {
         value = create_llvm_null(llvm_type_from_amun_type(field_type));
     }
@@ -116,9 +146,21 @@ auto amun::LLVMBackend::visit(FieldDeclaration* node) -> std::any
     }
 
     auto current_function = Builder.GetInsertBlock()->getParent();
-    if (value.type() == typeid(llvm::Value*)) {
-        auto init_value = std::any_cast<llvm::Value*>(value);
-        auto init_value_type = init_value->getType();
+    if (auto alloca = llvm::dyn_cast<llvm::AllocaInst>(value)) {
+        // Temporary value become the variable so it must be alive until the end of function
+        stack_slots_stack.top().retain(alloca);
+        Builder.CreateLoad(alloca->getAllocatedType(), alloca, var_name);
+        alloca_inst_table.define(var_name, alloca);
+    }
+    else if (auto function = llvm::dyn_cast<llvm::Function>(value)) {
+        llvm_functions[var_name] = function;
+        auto function_type = function->getType();
+        auto alloc_inst = create_entry_block_alloca(current_function, var_name, function_type);
+        Builder.CreateStore(function, alloc_inst);
+        alloca_inst_table.define(var_name, alloc_inst);
+    }
+    else {
+        auto init_value_type = value->getType();
 
         // This case if you assign derefernced variable for example
         // Case in C Language
@@ -126,70 +168,19 @@ auto amun::LLVMBackend::visit(FieldDeclaration* node) -> std::any
         // int value = *ptr;
         // Clang compiler emit load instruction twice to resolve this problem
         if (init_value_type != llvm_type && init_value_type->getPointerElementType() == llvm_type) {
-            init_value = derefernecs_llvm_pointer(init_value);
+            value = derefernecs_llvm_pointer(value);
         }
 
         auto alloc_inst = create_entry_block_alloca(current_function, var_name, llvm_type);
-        Builder.CreateStore(init_value, alloc_inst);
+        Builder.CreateStore(value, alloc_inst);
         alloca_inst_table.define(var_name, alloc_inst);
     }
-    else if (value.type() == typeid(llvm::CallInst*)) {
-        auto init_value = std::any_cast<llvm::CallInst*>(value);
-        auto alloc_inst = create_entry_block_alloca(current_function, var_name, llvm_type);
-        Builder.CreateStore(init_value, alloc_inst);
-        alloca_inst_table.define(var_name, alloc_inst);
-    }
-    else if (value.type() == typeid(llvm::AllocaInst*)) {
-        auto init_value = std::any_cast<llvm::AllocaInst*>(value);
-        Builder.CreateLoad(init_value->getAllocatedType(), init_value, var_name);
-        alloca_inst_table.define(var_name, init_value);
-    }
-    else if (value.type() == typeid(llvm::Constant*)) {
-        auto constant = std::any_cast<llvm::Constant*>(value);
-        auto alloc_inst = create_entry_block_alloca(current_function, var_name, llvm_type);
-        Builder.CreateStore(constant, alloc_inst);
-        alloca_inst_table.define(var_name, alloc_inst);
-    }
-    else if (value.type() == typeid(llvm::ConstantInt*)) {
-        auto constant = std::any_cast<llvm::ConstantInt*>(value);
-        auto alloc_inst = create_entry_block_alloca(current_function, var_name, llvm_type);
-        Builder.CreateStore(constant, alloc_inst);
-        alloca_inst_table.define(var_name, alloc_inst);
-    }
-    else if (value.type() == typeid(llvm::LoadInst*)) {
-        auto load_inst = std::any_cast<llvm::LoadInst*>(value);
-        auto alloc_inst = create_entry_block_alloca(current_function, var_name, llvm_type);
-        Builder.CreateStore(load_inst, alloc_inst);
-        alloca_inst_table.define(var_name, alloc_inst);
-    }
-    else if (value.type() == typeid(llvm::PHINode*)) {
-        auto node = std::any_cast<llvm::PHINode*>(value);
-        auto alloc_inst = create_entry_block_alloca(current_function, var_name, llvm_type);
-        Builder.CreateStore(node, alloc_inst);
-        alloca_inst_table.define(var_name, alloc_inst);
-    }
-    else if (value.type() == typeid(llvm::Function*)) {
-        auto node = std::any_cast<llvm::Function*>(value);
-        llvm_functions[var_name] = node;
-        auto alloc_inst = create_entry_block_alloca(current_function, var_name, node->getType());
-        Builder.CreateStore(node, alloc_inst);
-        alloca_inst_table.define(var_name, alloc_inst);
-    }
-    else if (value.type() == typeid(llvm::UndefValue*)) {
-        auto undefined = std::any_cast<llvm::UndefValue*>(value);
-        auto alloc_inst = create_entry_block_alloca(current_function, var_name, llvm_type);
-        Builder.CreateStore(undefined, alloc_inst);
-        alloca_inst_table.define(var_name, alloc_inst);
-    }
-    else {
-        internal_compiler_error("Un supported rvalue for field declaration");
-    }
-    return 0;
+    return nullptr;
 }
 
-auto amun::LLVMBackend::visit(DestructuringDeclaraion* node) -> std::any
+auto amun::LLVMBackend::visit(DestructuringDeclaraion* node) -> llvm::Value*
 {
-    auto tuple_value = llvm_node_value(node->value->accept(this));
+    auto tuple_value = node->value->accept(this);
     auto tuple_type = llvm_type_from_amun_type(node->value->get_type_node());
 
     const auto& variables_names = node->names;
@@ -200,27 +191,33 @@ auto amun::LLVMBackend::visit(DestructuringDeclaraion* node) -> std::any
 
     for (size_t i = 0; i < number_of_elements; i++) {
         // Variable information
-        auto variable_name = variables_names[i].literal;
+        auto variable_name = std::string(variables_names[i].literal);
         auto variable_type = llvm_type_from_amun_type(variables_types[i]);
 
         // Declare new variable
         auto alloc_inst = create_entry_block_alloca(current_function, variable_name, variable_type);
 
-        // Load element form struct with index
-        auto value = access_struct_member_pointer(tuple_value, tuple_type, i);
-        auto loaded_value = derefernecs_llvm_pointer(value);
+        // Load element form struct with index, or extract it if the tuple is a value
+        llvm::Value* loaded_value;
+        if (is_aggregate_value(tuple_value)) {
+            loaded_value = Builder.CreateExtractValue(tuple_value, i);
+        }
+        else {
+            auto value = access_struct_member_pointer(tuple_value, tuple_type, i);
+            loaded_value = derefernecs_llvm_pointer(value);
+        }
 
         // Store value in variable and define it inside Allocation instruction table
         Builder.CreateStore(loaded_value, alloc_inst);
         alloca_inst_table.define(variable_name, alloc_inst);
     }
 
-    return 0;
+    return nullptr;
 }
 
-auto amun::LLVMBackend::visit(ConstDeclaration* node) -> std::any { return 0; }
+auto amun::LLVMBackend::visit(ConstDeclaration* node) -> llvm::Value* { return nullptr; }
 
-auto amun::LLVMBackend::visit(FunctionPrototype* node) -> std::any
+auto amun::LLVMBackend::visit(FunctionPrototype* node) -> llvm::Value*
 {
     auto parameters = node->parameters;
     size_t parameters_size = parameters.size();
@@ -231,10 +228,15 @@ auto amun::LLVMBackend::visit(FunctionPrototype* node) -> std::any
 
     auto return_type = llvm_type_from_amun_type(node->return_type);
     auto function_type = llvm::FunctionType::get(return_type, arguments, node->has_varargs);
-    auto function_name = node->name.literal;
+    auto function_name = std::string(node->name.literal);
     auto linkage = node->is_external || function_name == "main" ? llvm::Function::ExternalLinkage
                                                                 : llvm::Function::InternalLinkage;
 
+    // Exported functions are internalized again when linking if no other module declares them
+    if (should_export_functions) {
+        linkage = llvm::Function::ExternalLinkage;
+    }
+
     auto function = llvm::Function::Create(function_type, linkage, function_name, nullptr);
     llvm_module->getFunctionList().push_back(function);
 
@@ -250,9 +252,9 @@ auto amun::LLVMBackend::visit(FunctionPrototype* node) -> std::any
     return function;
 }
 
-auto amun::LLVMBackend::visit(IntrinsicPrototype* node) -> std::any
+auto amun::LLVMBackend::visit(IntrinsicPrototype* node) -> llvm::Value*
 {
-    auto name = node->name.literal;
+    auto name = std::string(node->name.literal);
     auto prototype_parameters = node->parameters;
 
     std::vector<llvm::Type*> parameters_types;
@@ -278,18 +280,18 @@ auto amun::LLVMBackend::visit(IntrinsicPrototype* node) -> std::any
 }
 
 auto amun::LLVMBackend::resolve_generic_function(FunctionDeclaration* node,
-                                                 std::vector<Shared<amun::Type>> generic_parameters)
+                                                 std::vector<amun::Type*> generic_parameters)
     -> llvm::Function*
 {
 
     is_on_global_scope = false;
     auto prototype = node->prototype;
-    auto name = prototype->name.literal;
+    auto name = std::string(prototype->name.literal);
     auto mangled_name = name + mangle_types(generic_parameters);
 
     if (alloca_inst_table.is_defined(mangled_name)) {
         auto value = alloca_inst_table.lookup(mangled_name);
-        return std::any_cast<llvm::Function*>(value);
+        return llvm::cast<llvm::Function>(value);
     }
 
     // Resolve Generic Parameters
@@ -300,15 +302,14 @@ auto amun::LLVMBackend::resolve_generic_function(FunctionDeclaration* node,
 
     auto return_type = prototype->return_type;
     if (prototype->return_type->type_kind == amun::TypeKind::GENERIC_PARAMETER) {
-        auto generic_type = std::static_pointer_cast<amun::GenericParameterType>(return_type);
+        auto generic_type = static_cast<amun::GenericParameterType*>(return_type);
         return_type = generic_types[generic_type->name];
     }
 
     std::vector<llvm::Type*> arguments;
     for (const auto& parameter : prototype->parameters) {
         if (parameter->type->type_kind == amun::TypeKind::GENERIC_PARAMETER) {
-            auto generic_type =
-                std::static_pointer_cast<amun::GenericParameterType>(parameter->type);
+            auto generic_type = static_cast<amun::GenericParameterType*>(parameter->type);
             arguments.push_back(llvm_type_from_amun_type(generic_types[generic_type->name]));
         }
         else {
@@ -342,6 +343,7 @@ auto amun::LLVMBackend::resolve_generic_function(FunctionDeclaration* node,
     Builder.SetInsertPoint(entry_block);
 
     defer_calls_stack.push({});
+    stack_slots_stack.emplace(function);
     push_alloca_inst_scope();
 
     for (auto& arg : function->args()) {
@@ -351,17 +353,23 @@ auto amun::LLVMBackend::resolve_generic_function(FunctionDeclaration* node,
         Builder.CreateStore(&arg, alloca_inst);
     }
 
+    auto outer_generic_arguments = generic_arguments;
+    generic_arguments = generic_parameters;
+
     const auto& body = node->body;
     body->accept(this);
 
+    generic_arguments = outer_generic_arguments;
+
     pop_alloca_inst_scope();
+    stack_slots_stack.pop();
     defer_calls_stack.pop();
 
     alloca_inst_table.define(mangled_name, function);
 
     // Assert that this block end with return statement or unreachable
     if (body->get_ast_node_type() == AstNodeType::AST_BLOCK) {
-        const auto& body_statement = std::dynamic_pointer_cast<BlockStatement>(body);
+        const auto& body_statement = dynamic_cast<BlockStatement*>(body);
         const auto& statements = body_statement->statements;
         if (statements.empty() ||
             statements.back()->get_ast_node_type() != AstNodeType::AST_RETURN) {
@@ -380,23 +388,26 @@ auto amun::LLVMBackend::resolve_generic_function(FunctionDeclaration* node,
     return function;
 }
 
-auto amun::LLVMBackend::visit(FunctionDeclaration* node) -> std::any
+auto amun::LLVMBackend::visit(FunctionDeclaration* node) -> llvm::Value*
 {
     is_on_global_scope = false;
     auto prototype = node->prototype;
-    auto name = prototype->name.literal;
+    auto name = std::string(prototype->name.literal);
     if (prototype->is_generic) {
         functions_declaraions[name] = node;
-        return 0;
+        return nullptr;
     }
 
+    llvm::TimeTraceScope trace_scope("Generate function", name);
+
     functions_table[name] = prototype;
 
-    auto function = std::any_cast<llvm::Function*>(prototype->accept(this));
+    auto function = llvm::cast<llvm::Function>(prototype->accept(this));
     auto entry_block = llvm::BasicBlock::Create(llvm_context, "entry", function);
     Builder.SetInsertPoint(entry_block);
 
     defer_calls_stack.push({});
+    stack_slots_stack.emplace(function);
     push_alloca_inst_scope();
     for (auto& arg : function->args()) {
         const std::string arg_name_str = std::string(arg.getName());
@@ -409,13 +420,14 @@ auto amun::LLVMBackend::visit(FunctionDeclaration* node) -> std::any
     body->accept(this);
 
     pop_alloca_inst_scope();
+    stack_slots_stack.pop();
     defer_calls_stack.pop();
 
     alloca_inst_table.define(name, function);
 
     // Assert that this block end with return statement or unreachable
     if (body->get_ast_node_type() == AstNodeType::AST_BLOCK) {
-        const auto& body_statement = std::dynamic_pointer_cast<BlockStatement>(body);
+        const auto& body_statement = dynamic_cast<BlockStatement*>(body);
         const auto& statements = body_statement->statements;
         if (statements.empty() ||
             statements.back()->get_ast_node_type() != AstNodeType::AST_RETURN) {
@@ -430,33 +442,33 @@ auto amun::LLVMBackend::visit(FunctionDeclaration* node) -> std::any
     return function;
 }
 
-auto amun::LLVMBackend::visit(OperatorFunctionDeclaraion* node) -> std::any
+auto amun::LLVMBackend::visit(OperatorFunctionDeclaraion* node) -> llvm::Value*
 {
     return node->function->accept(this);
 }
 
-auto amun::LLVMBackend::visit(StructDeclaration* node) -> std::any
+auto amun::LLVMBackend::visit(StructDeclaration* node) -> llvm::Value*
 {
     const auto struct_type = node->struct_type;
 
     // Generic Struct is a template and should be defined only when used
     if (struct_type->is_generic) {
-        return 0;
+        return nullptr;
     }
 
     const auto struct_name = struct_type->name;
-    return create_llvm_struct_type(struct_name, struct_type->fields_types, struct_type->is_packed,
-                                   struct_type->is_extern);
-    return 0;
+    create_llvm_struct_type(struct_name, struct_type->fields_types, struct_type->is_packed,
+                            struct_type->is_extern);
+    return nullptr;
 }
 
-auto amun::LLVMBackend::visit([[maybe_unused]] EnumDeclaration* node) -> std::any
+auto amun::LLVMBackend::visit([[maybe_unused]] EnumDeclaration* node) -> llvm::Value*
 {
     // Enumeration type is only compile time type, no need to generate any IR for it
-    return 0;
+    return nullptr;
 }
 
-auto amun::LLVMBackend::visit(IfStatement* node) -> std::any
+auto amun::LLVMBackend::visit(IfStatement* node) -> llvm::Value*
 {
     auto* current_function = Builder.GetInsertBlock()->getParent();
     auto* start_block = llvm::BasicBlock::Create(llvm_context, "if.start");
@@ -506,14 +518,17 @@ auto amun::LLVMBackend::visit(IfStatement* node) -> std::any
         Builder.SetInsertPoint(end_block);
     }
 
-    return 0;
+    return nullptr;
 }
 
-auto amun::LLVMBackend::visit(ForRangeStatement* node) -> std::any
+auto amun::LLVMBackend::visit(ForRangeStatement* node) -> llvm::Value*
 {
     auto start = llvm_resolve_value(node->range_start->accept(this));
     auto end = llvm_resolve_value(node->range_end->accept(this));
 
+    auto node_type = node->range_start->get_type_node();
+    auto is_unsigned = amun::is_unsigned_integer_type(node_type);
+
     llvm::Value* step = nullptr;
     if (node->step) {
         // Resolve user declared step
@@ -521,22 +536,26 @@ auto amun::LLVMBackend::visit(ForRangeStatement* node) -> std::any
     }
     else {
         // Default step is 1 with number type as the same as range start
-        auto node_type = node->range_start->get_type_node();
-        auto number_type = std::static_pointer_cast<amun::NumberType>(node_type);
+        auto number_type = static_cast<amun::NumberType*>(node_type);
         step = llvm_number_value("1", number_type->number_kind);
     }
 
-    start = create_llvm_numbers_bianry(TokenKind::TOKEN_MINUS, start, step);
-    end = create_llvm_numbers_bianry(TokenKind::TOKEN_MINUS, end, step);
-
     const auto element_llvm_type = start->getType();
+    const auto is_integer_range = element_llvm_type->isIntegerTy();
+
+    auto compare = [&](TokenKind op, llvm::Value* left, llvm::Value* right) -> llvm::Value* {
+        if (is_unsigned) {
+            return create_llvm_unsigned_integers_comparison(op, left, right);
+        }
+        return create_llvm_numbers_comparison(op, left, right);
+    };
 
-    auto condition_block = llvm::BasicBlock::Create(llvm_context, "for.cond");
     auto body_block = llvm::BasicBlock::Create(llvm_context, "for");
+    auto latch_block = llvm::BasicBlock::Create(llvm_context, "for.latch");
     auto end_block = llvm::BasicBlock::Create(llvm_context, "for.end");
 
     break_blocks_stack.push(end_block);
-    continue_blocks_stack.push(condition_block);
+    continue_blocks_stack.push(latch_block);
 
     push_alloca_inst_scope();
 
@@ -544,25 +563,19 @@ auto amun::LLVMBackend::visit(ForRangeStatement* node) -> std::any
     const auto var_name = node->element_name;
     const auto current_function = Builder.GetInsertBlock()->getParent();
     auto alloc_inst = create_entry_block_alloca(current_function, var_name, element_llvm_type);
-    Builder.CreateStore(start, alloc_inst);
     alloca_inst_table.define(var_name, alloc_inst);
-    Builder.CreateBr(condition_block);
 
-    // Generate condition block
-    current_function->getBasicBlockList().push_back(condition_block);
-    Builder.SetInsertPoint(condition_block);
-    auto variable = derefernecs_llvm_pointer(alloc_inst);
-    auto condition = create_llvm_numbers_comparison(TokenKind::TOKEN_SMALLER_EQUAL, variable, end);
-    Builder.CreateCondBr(condition, body_block, end_block);
+    // Loop is rotated and guarded, the body is executed only if the range is not empty
+    auto preheader_block = Builder.GetInsertBlock();
+    auto is_not_empty = compare(TokenKind::TOKEN_SMALLER_EQUAL, start, end);
+    Builder.CreateCondBr(is_not_empty, body_block, end_block);
 
-    // Generate For body IR Code
+    // Induction variable is a PHI node, and the iterator variable is a copy of it
     current_function->getBasicBlockList().push_back(body_block);
     Builder.SetInsertPoint(body_block);
-
-    // Increment loop variable
-    auto value_ptr = Builder.CreateLoad(alloc_inst->getAllocatedType(), alloc_inst);
-    auto new_value = create_llvm_numbers_bianry(TokenKind::TOKEN_PLUS, value_ptr, step);
-    Builder.CreateStore(new_value, alloc_inst);
+    auto induction = Builder.CreatePHI(element_llvm_type, 2, "for.iv");
+    induction->addIncoming(start, preheader_block);
+    Builder.CreateStore(induction, alloc_inst);
 
     node->body->accept(this);
     pop_alloca_inst_scope();
@@ -571,8 +584,48 @@ auto amun::LLVMBackend::visit(ForRangeStatement* node) -> std::any
         has_break_or_continue_statement = false;
     }
     else {
-        Builder.CreateBr(condition_block);
+        Builder.CreateBr(latch_block);
+    }
+
+    // Generate the latch block that increment the induction variable
+    current_function->getBasicBlockList().push_back(latch_block);
+    Builder.SetInsertPoint(latch_block);
+
+    llvm::Value* next = nullptr;
+    llvm::Value* condition = nullptr;
+    auto constant_step = llvm::dyn_cast<llvm::ConstantInt>(step);
+    auto constant_end = llvm::dyn_cast<llvm::ConstantInt>(end);
+    if (is_integer_range && constant_step && constant_step->isOne()) {
+        // Increment only if the current value is smaller than end so it can't wrap
+        condition = compare(TokenKind::TOKEN_SMALLER, induction, end);
+        next = Builder.CreateAdd(induction, step, "for.next", is_unsigned, !is_unsigned);
+    }
+    else if (is_integer_range) {
+        // The increment can't wrap if both end and positive step are known and end + step fit
+        bool is_overflow = true;
+        if (constant_step && constant_end && !constant_step->isNegative()) {
+            const auto& end_value = constant_end->getValue();
+            const auto& step_value = constant_step->getValue();
+            if (is_unsigned) {
+                (void)end_value.uadd_ov(step_value, is_overflow);
+            }
+            else {
+                (void)end_value.sadd_ov(step_value, is_overflow);
+            }
+        }
+        auto has_no_wrap = !is_overflow;
+        next = Builder.CreateAdd(induction, step, "for.next", has_no_wrap && is_unsigned,
+                                 has_no_wrap && !is_unsigned);
+        condition = compare(TokenKind::TOKEN_SMALLER_EQUAL, next, end);
     }
+    else {
+        next = Builder.CreateFAdd(induction, step, "for.next");
+        condition = compare(TokenKind::TOKEN_SMALLER_EQUAL, next, end);
+    }
+
+    induction->addIncoming(next, latch_block);
+    Builder.CreateCondBr(condition, body_block, end_block);
+    set_loop_hints_metadata(node->hints, body_block, preheader_block);
 
     // Set the insertion point to the end block
     current_function->getBasicBlockList().push_back(end_block);
@@ -581,34 +634,36 @@ auto amun::LLVMBackend::visit(ForRangeStatement* node) -> std::any
     break_blocks_stack.pop();
     continue_blocks_stack.pop();
 
-    return 0;
+    return nullptr;
 }
 
-auto amun::LLVMBackend::visit(ForEachStatement* node) -> std::any
+auto amun::LLVMBackend::visit(ForEachStatement* node) -> llvm::Value*
 {
     auto collection_expression = node->collection;
+    Unique<LiteralExpression> temp_collection_literal;
     auto collection_exp_type = collection_expression->get_type_node();
-    auto collection_value = llvm_node_value(collection_expression->accept(this));
+    auto collection_value = collection_expression->accept(this);
     auto collection = llvm_resolve_value(collection_value);
     auto collection_type = collection->getType();
 
     // If collection type is fixed size array with zero length, no need to generate for each
     if (collection_type->isArrayTy() && collection_type->getArrayNumElements() == 0) {
-        return 0;
+        return nullptr;
     }
 
     auto is_foreach_string = amun::is_types_equals(collection_exp_type, amun::i8_ptr_type);
 
-    auto zero_value = create_llvm_int64(-1, true);
+    auto zero_value = create_llvm_int64(0, true);
     auto step = create_llvm_int64(1, true);
 
-    // Get length of collections depending on type
+    // Get length of collections depending on type, it's constant for arrays and vectors so the
+    // loop trip count is known at compile time
     llvm::Value* length;
     if (is_foreach_string) {
         length = create_llvm_string_length(collection);
     }
     else if (collection_type->isVectorTy()) {
-        auto vector_type = std::static_pointer_cast<amun::StaticVectorType>(collection_exp_type);
+        auto vector_type = static_cast<amun::StaticVectorType*>(collection_exp_type);
         auto array_count = vector_type->array->size;
         length = create_llvm_int64(array_count, true);
     }
@@ -616,13 +671,12 @@ auto amun::LLVMBackend::visit(ForEachStatement* node) -> std::any
         length = create_llvm_int64(collection_type->getArrayNumElements(), true);
     }
 
-    auto end = create_llvm_integers_bianry(TokenKind::TOKEN_MINUS, length, step);
-    auto condition_block = llvm::BasicBlock::Create(llvm_context, "for.cond");
     auto body_block = llvm::BasicBlock::Create(llvm_context, "for");
+    auto latch_block = llvm::BasicBlock::Create(llvm_context, "for.latch");
     auto end_block = llvm::BasicBlock::Create(llvm_context, "for.end");
 
     break_blocks_stack.push(end_block);
-    continue_blocks_stack.push(condition_block);
+    continue_blocks_stack.push(latch_block);
 
     push_alloca_inst_scope();
 
@@ -630,7 +684,6 @@ auto amun::LLVMBackend::visit(ForEachStatement* node) -> std::any
     const auto index_name = node->index_name;
     const auto current_function = Builder.GetInsertBlock()->getParent();
     auto index_alloca = create_entry_block_alloca(current_function, index_name, llvm_int64_type);
-    Builder.CreateStore(zero_value, index_alloca);
     alloca_inst_table.define(index_name, index_alloca);
 
     // Resolve element name to be collection[it_index]
@@ -640,7 +693,7 @@ auto amun::LLVMBackend::visit(ForEachStatement* node) -> std::any
     // Detect element type for string, array or vector
     llvm::Type* element_type;
     if (collection_exp_type->type_kind == TypeKind::STATIC_VECTOR) {
-        auto vector_type = std::static_pointer_cast<amun::StaticVectorType>(collection_exp_type);
+        auto vector_type = static_cast<amun::StaticVectorType*>(collection_exp_type);
         element_type = llvm_type_from_amun_type(vector_type->array->element_type);
     }
     else if (collection_type->isArrayTy()) {
@@ -654,24 +707,6 @@ auto amun::LLVMBackend::visit(ForEachStatement* node) -> std::any
         element_alloca = create_entry_block_alloca(current_function, element_name, element_type);
     }
 
-    Builder.CreateBr(condition_block);
-
-    // Generate condition block
-    current_function->getBasicBlockList().push_back(condition_block);
-    Builder.SetInsertPoint(condition_block);
-    auto variable = derefernecs_llvm_pointer(index_alloca);
-    auto condition = create_llvm_numbers_comparison(TokenKind::TOKEN_SMALLER, variable, end);
-    Builder.CreateCondBr(condition, body_block, end_block);
-
-    // Generate For body IR Code
-    current_function->getBasicBlockList().push_back(body_block);
-    Builder.SetInsertPoint(body_block);
-
-    // Increment loop variable
-    auto value_ptr = Builder.CreateLoad(index_alloca->getAllocatedType(), index_alloca);
-    auto new_value = create_llvm_numbers_bianry(TokenKind::TOKEN_PLUS, value_ptr, step);
-    Builder.CreateStore(new_value, index_alloca);
-
     // If array expression is passed directly we should first save it on temp variable
     if (node->collection->get_ast_node_type() == AstNodeType::AST_ARRAY) {
         auto temp_name = "_temp";
@@ -681,14 +716,26 @@ auto amun::LLVMBackend::visit(ForEachStatement* node) -> std::any
 
         auto location = TokenSpan();
         auto token = Token{TokenKind::TOKEN_IDENTIFIER, location, temp_name};
-        collection_expression = std::make_shared<LiteralExpression>(token);
-        collection_expression->set_type_node(node->collection->get_type_node());
+        temp_collection_literal = std::make_unique<LiteralExpression>(token);
+        temp_collection_literal->set_type_node(node->collection->get_type_node());
+        collection_expression = temp_collection_literal.get();
     }
 
+    // Loop is rotated and guarded, the body is executed only if the collection is not empty
+    auto preheader_block = Builder.GetInsertBlock();
+    auto is_not_empty = Builder.CreateICmpSLT(zero_value, length);
+    Builder.CreateCondBr(is_not_empty, body_block, end_block);
+
+    // Induction variable is a PHI node, and the index variable is a copy of it
+    current_function->getBasicBlockList().push_back(body_block);
+    Builder.SetInsertPoint(body_block);
+    auto induction = Builder.CreatePHI(llvm_int64_type, 2, "for.iv");
+    induction->addIncoming(zero_value, preheader_block);
+    Builder.CreateStore(induction, index_alloca);
+
     // Update it variable with the element in the current index
     if (element_name != "_") {
-        auto current_index = derefernecs_llvm_pointer(index_alloca);
-        auto value = access_array_element(collection_expression, current_index);
+        auto value = access_array_element(collection_expression, induction);
         Builder.CreateStore(value, element_alloca);
         alloca_inst_table.define(element_name, element_alloca);
     }
@@ -700,9 +747,18 @@ auto amun::LLVMBackend::visit(ForEachStatement* node) -> std::any
         has_break_or_continue_statement = false;
     }
     else {
-        Builder.CreateBr(condition_block);
+        Builder.CreateBr(latch_block);
     }
 
+    // Generate the latch block, the index is always smaller than length so it can't wrap
+    current_function->getBasicBlockList().push_back(latch_block);
+    Builder.SetInsertPoint(latch_block);
+    auto next = Builder.CreateAdd(induction, step, "for.next", true, true);
+    induction->addIncoming(next, latch_block);
+    auto condition = Builder.CreateICmpSLT(next, length);
+    Builder.CreateCondBr(condition, body_block, end_block);
+    set_loop_hints_metadata(node->hints, body_block, preheader_block);
+
     // Set the insertion point to the end block
     current_function->getBasicBlockList().push_back(end_block);
     Builder.SetInsertPoint(end_block);
@@ -710,10 +766,10 @@ auto amun::LLVMBackend::visit(ForEachStatement* node) -> std::any
     break_blocks_stack.pop();
     continue_blocks_stack.pop();
 
-    return 0;
+    return nullptr;
 }
 
-auto amun::LLVMBackend::visit(ForeverStatement* node) -> std::any
+auto amun::LLVMBackend::visit(ForeverStatement* node) -> llvm::Value*
 {
     auto body_block = llvm::BasicBlock::Create(llvm_context, "forever");
     auto end_block = llvm::BasicBlock::Create(llvm_context, "forever.end");
@@ -724,6 +780,7 @@ auto amun::LLVMBackend::visit(ForeverStatement* node) -> std::any
     push_alloca_inst_scope();
 
     const auto current_function = Builder.GetInsertBlock()->getParent();
+    auto preheader_block = Builder.GetInsertBlock();
 
     Builder.CreateBr(body_block);
 
@@ -741,6 +798,8 @@ auto amun::LLVMBackend::visit(ForeverStatement* node) -> std::any
         Builder.CreateBr(body_block);
     }
 
+    set_loop_hints_metadata(node->hints, body_block, preheader_block);
+
     // Set the insertion point to the end block
     current_function->getBasicBlockList().push_back(end_block);
     Builder.SetInsertPoint(end_block);
@@ -748,10 +807,10 @@ auto amun::LLVMBackend::visit(ForeverStatement* node) -> std::any
     break_blocks_stack.pop();
     continue_blocks_stack.pop();
 
-    return 0;
+    return nullptr;
 }
 
-auto amun::LLVMBackend::visit(WhileStatement* node) -> std::any
+auto amun::LLVMBackend::visit(WhileStatement* node) -> llvm::Value*
 {
     auto current_function = Builder.GetInsertBlock()->getParent();
     auto condition_branch = llvm::BasicBlock::Create(llvm_context, "while.condition");
@@ -761,11 +820,12 @@ auto amun::LLVMBackend::visit(WhileStatement* node) -> std::any
     break_blocks_stack.push(end_branch);
     continue_blocks_stack.push(condition_branch);
 
+    auto preheader_branch = Builder.GetInsertBlock();
     Builder.CreateBr(condition_branch);
     current_function->getBasicBlockList().push_back(condition_branch);
     Builder.SetInsertPoint(condition_branch);
 
-    auto condition = llvm_node_value(node->condition->accept(this));
+    auto condition = node->condition->accept(this);
     Builder.CreateCondBr(condition, loop_branch, end_branch);
 
     current_function->getBasicBlockList().push_back(loop_branch);
@@ -782,21 +842,41 @@ auto amun::LLVMBackend::visit(WhileStatement* node) -> std::any
         Builder.CreateBr(condition_branch);
     }
 
+    set_loop_hints_metadata(node->hints, condition_branch, preheader_branch);
+
     current_function->getBasicBlockList().push_back(end_branch);
     Builder.SetInsertPoint(end_branch);
 
     break_blocks_stack.pop();
     continue_blocks_stack.pop();
 
-    return 0;
+    return nullptr;
 }
 
-auto amun::LLVMBackend::visit(SwitchStatement* node) -> std::any
+auto amun::LLVMBackend::visit(SwitchStatement* node) -> llvm::Value*
 {
+    // If all cases are integer constants and the operator is `==`, lower it to llvm switch
+    // instruction so it can be optimized to jump table instead of comparing cases one by one
+    if (node->op == TokenKind::TOKEN_EQUAL_EQUAL) {
+        auto cases_count = node->cases.size() - (node->has_default_case ? 1 : 0);
+        std::vector<std::vector<llvm::ConstantInt*>> cases_values(cases_count);
+
+        bool is_integer_cases = true;
+        for (size_t i = 0; i < cases_count && is_integer_cases; i++) {
+            is_integer_cases = resolve_switch_integer_cases(node->argument, node->cases[i]->values,
+                                                            cases_values[i]);
+        }
+
+        if (is_integer_cases) {
+            create_llvm_switch_statement(node, cases_values);
+            return nullptr;
+        }
+    }
+
     size_t blocks_count = node->cases.size();
     std::vector<llvm::BasicBlock*> llvm_branches;
     std::vector<llvm::Value*> llvm_values;
-    std::vector<Shared<Statement>> bodies;
+    std::vector<Statement*> bodies;
 
     // Create blocks and collect values in arrays
     for (size_t i = 0; i < blocks_count; i++) {
@@ -864,10 +944,10 @@ auto amun::LLVMBackend::visit(SwitchStatement* node) -> std::any
         Builder.SetInsertPoint(end_block);
     }
 
-    return 0;
+    return nullptr;
 }
 
-auto amun::LLVMBackend::visit(ReturnStatement* node) -> std::any
+auto amun::LLVMBackend::visit(ReturnStatement* node) -> llvm::Value*
 {
     has_return_statement = true;
 
@@ -878,51 +958,18 @@ auto amun::LLVMBackend::visit(ReturnStatement* node) -> std::any
 
     auto value = node->value->accept(this);
 
-    if (value.type() == typeid(llvm::Value*)) {
-        auto return_value = std::any_cast<llvm::Value*>(value);
-        return Builder.CreateRet(return_value);
-    }
-
-    if (value.type() == typeid(llvm::CallInst*)) {
-        auto init_value = std::any_cast<llvm::CallInst*>(value);
-        return Builder.CreateRet(init_value);
-    }
-
-    if (value.type() == typeid(llvm::AllocaInst*)) {
-        auto init_value = std::any_cast<llvm::AllocaInst*>(value);
-        auto value_litearl = Builder.CreateLoad(init_value->getAllocatedType(), init_value);
+    if (auto alloca = llvm::dyn_cast<llvm::AllocaInst>(value)) {
+        auto value_litearl = Builder.CreateLoad(alloca->getAllocatedType(), alloca);
         return Builder.CreateRet(value_litearl);
     }
 
-    if (value.type() == typeid(llvm::Function*)) {
-        auto node = std::any_cast<llvm::Function*>(value);
-        return Builder.CreateRet(node);
-    }
-
-    if (value.type() == typeid(llvm::Constant*)) {
-        auto init_value = std::any_cast<llvm::Constant*>(value);
-        return Builder.CreateRet(init_value);
-    }
-
-    if (value.type() == typeid(llvm::ConstantInt*)) {
-        auto init_value = std::any_cast<llvm::ConstantInt*>(value);
-        return Builder.CreateRet(init_value);
-    }
-
-    if (value.type() == typeid(llvm::LoadInst*)) {
-        auto load_inst = std::any_cast<llvm::LoadInst*>(value);
-        return Builder.CreateRet(load_inst);
-    }
-
-    if (value.type() == typeid(llvm::GlobalVariable*)) {
-        auto variable = std::any_cast<llvm::GlobalVariable*>(value);
+    if (auto variable = llvm::dyn_cast<llvm::GlobalVariable>(value)) {
         auto value = Builder.CreateLoad(variable->getValueType(), variable);
         return Builder.CreateRet(value);
     }
 
     // Used when use return node is if or switch expression
-    if (value.type() == typeid(llvm::PHINode*)) {
-        auto phi = std::any_cast<llvm::PHINode*>(value);
+    if (auto phi = llvm::dyn_cast<llvm::PHINode>(value)) {
         auto expected_type = node->value->get_type_node();
         auto expected_llvm_type = llvm_type_from_amun_type(expected_type);
 
@@ -934,17 +981,17 @@ auto amun::LLVMBackend::visit(ReturnStatement* node) -> std::any
         return Builder.CreateRet(phi_value);
     }
 
-    internal_compiler_error("Un expected return type");
+    return Builder.CreateRet(value);
 }
 
-auto amun::LLVMBackend::visit(DeferStatement* node) -> std::any
+auto amun::LLVMBackend::visit(DeferStatement* node) -> llvm::Value*
 {
     auto call_expression = node->call_expression;
-    auto callee = std::dynamic_pointer_cast<LiteralExpression>(call_expression->callee);
-    auto callee_literal = callee->name.literal;
+    auto callee = dynamic_cast<LiteralExpression*>(call_expression->callee);
+    auto callee_literal = std::string(callee->name.literal);
     auto function = lookup_function(callee_literal);
     if (not function) {
-        auto value = llvm_node_value(alloca_inst_table.lookup(callee_literal));
+        auto value = alloca_inst_table.lookup(callee_literal);
         if (auto alloca = llvm::dyn_cast<llvm::AllocaInst>(value)) {
             auto loaded = Builder.CreateLoad(alloca->getAllocatedType(), alloca);
             auto function_type = llvm_type_from_amun_type(call_expression->get_type_node());
@@ -954,7 +1001,7 @@ auto amun::LLVMBackend::visit(DeferStatement* node) -> std::any
                 std::vector<llvm::Value*> arguments_values;
                 arguments_values.reserve(arguments_size);
                 for (size_t i = 0; i < arguments_size; i++) {
-                    auto value = llvm_node_value(arguments[i]->accept(this));
+                    auto value = arguments[i]->accept(this);
                     if (function_pointer->getParamType(i) == value->getType()) {
                         arguments_values.push_back(value);
                     }
@@ -964,12 +1011,15 @@ auto amun::LLVMBackend::visit(DeferStatement* node) -> std::any
                         arguments_values.push_back(loaded_value);
                     }
                 }
+                for (auto* argument_value : arguments_values) {
+                    stack_slots_stack.top().retain(argument_value);
+                }
                 auto defer_function_call = std::make_shared<amun::DeferFunctionPtrCall>(
                     function_pointer, loaded, arguments_values);
                 defer_calls_stack.top().push_front(defer_function_call);
             }
         }
-        return 0;
+        return nullptr;
     }
 
     auto arguments = call_expression->arguments;
@@ -979,7 +1029,7 @@ auto amun::LLVMBackend::visit(DeferStatement* node) -> std::any
     arguments_values.reserve(arguments_size);
     for (size_t i = 0; i < arguments_size; i++) {
         auto argument = arguments[i];
-        auto value = llvm_node_value(argument->accept(this));
+        auto value = argument->accept(this);
 
         if (i >= parameter_size) {
             if (argument->get_ast_node_type() == AstNodeType::AST_LITERAL) {
@@ -1002,15 +1052,20 @@ auto amun::LLVMBackend::visit(DeferStatement* node) -> std::any
         arguments_values.push_back(loaded_value);
     }
 
+    // Deferred call is executed at the end of the scope so its arguments must be still alive
+    for (auto* argument_value : arguments_values) {
+        stack_slots_stack.top().retain(argument_value);
+    }
+
     auto defer_function_call =
         std::make_shared<amun::DeferFunctionCall>(function, arguments_values);
 
     // Inser must be at the begin to simulate stack but in vector to easy traverse and clear
     defer_calls_stack.top().push_front(defer_function_call);
-    return 0;
+    return nullptr;
 }
 
-auto amun::LLVMBackend::visit(BreakStatement* node) -> std::any
+auto amun::LLVMBackend::visit(BreakStatement* node) -> llvm::Value*
 {
     has_break_or_continue_statement = true;
 
@@ -1019,10 +1074,10 @@ auto amun::LLVMBackend::visit(BreakStatement* node) -> std::any
     }
 
     Builder.CreateBr(break_blocks_stack.top());
-    return 0;
+    return nullptr;
 }
 
-auto amun::LLVMBackend::visit(ContinueStatement* node) -> std::any
+auto amun::LLVMBackend::visit(ContinueStatement* node) -> llvm::Value*
 {
     has_break_or_continue_statement = true;
 
@@ -1031,20 +1086,20 @@ auto amun::LLVMBackend::visit(ContinueStatement* node) -> std::any
     }
 
     Builder.CreateBr(continue_blocks_stack.top());
-    return 0;
+    return nullptr;
 }
 
-auto amun::LLVMBackend::visit(ExpressionStatement* node) -> std::any
+auto amun::LLVMBackend::visit(ExpressionStatement* node) -> llvm::Value*
 {
     node->expression->accept(this);
-    return 0;
+    return nullptr;
 }
 
-auto amun::LLVMBackend::visit(IfExpression* node) -> std::any
+auto amun::LLVMBackend::visit(IfExpression* node) -> llvm::Value*
 {
     // If it constant, we can resolve it at Compile time
     if (is_global_block() && node->is_constant()) {
-        return resolve_constant_if_expression(std::make_shared<IfExpression>(*node));
+        return resolve_constant_if_expression(node);
     }
 
     const auto blocks_count = node->tokens.size();
@@ -1099,11 +1154,19 @@ auto amun::LLVMBackend::visit(IfExpression* node) -> std::any
     return phi_node;
 }
 
-auto amun::LLVMBackend::visit(SwitchExpression* node) -> std::any
+auto amun::LLVMBackend::visit(SwitchExpression* node) -> llvm::Value*
 {
     // If it constant, we can resolve it at Compile time
     if (is_global_block() && node->is_constant()) {
-        return resolve_constant_switch_expression(std::make_shared<SwitchExpression>(*node));
+        return resolve_constant_switch_expression(node);
+    }
+
+    // If all cases are integer constants and the operator is `==`, lower it to llvm switch
+    if (node->op == TokenKind::TOKEN_EQUAL_EQUAL) {
+        std::vector<llvm::ConstantInt*> cases_values;
+        if (resolve_switch_integer_cases(node->argument, node->switch_cases, cases_values)) {
+            return create_llvm_switch_expression(node, cases_values);
+        }
     }
 
     // Resolve the argument condition
@@ -1156,7 +1219,7 @@ auto amun::LLVMBackend::visit(SwitchExpression* node) -> std::any
         auto* current_branch = llvm_branches[i];
 
         // Compare the argument value with current case
-        auto* case_value = llvm_node_value(cases[i - 1]->accept(this));
+        auto* case_value = cases[i - 1]->accept(this);
         auto* condition = create_llvm_integers_comparison(node->op, argument, case_value);
 
         // Jump to the merge block if current case equal to argument,
@@ -1183,36 +1246,34 @@ auto amun::LLVMBackend::visit(SwitchExpression* node) -> std::any
     return phi_node;
 }
 
-auto amun::LLVMBackend::visit(TupleExpression* node) -> std::any
+auto amun::LLVMBackend::visit(TupleExpression* node) -> llvm::Value*
 {
     auto tuple_type = llvm_type_from_amun_type(node->type);
-    auto alloc_inst = Builder.CreateAlloca(tuple_type);
 
-    size_t argument_index = 0;
+    // Tuple is created as value so its fields can be used without storing it in memory
+    llvm::Value* tuple_value = llvm::UndefValue::get(tuple_type);
+    unsigned argument_index = 0;
     for (const auto& argument : node->values) {
         auto argument_value = llvm_resolve_value(argument->accept(this));
-        auto index = llvm::ConstantInt::get(llvm_context, llvm::APInt(32, argument_index, true));
-        auto member_ptr = Builder.CreateGEP(tuple_type, alloc_inst, {zero_int32_value, index});
-        Builder.CreateStore(argument_value, member_ptr);
+        tuple_value = Builder.CreateInsertValue(tuple_value, argument_value, argument_index);
         argument_index++;
     }
 
-    return alloc_inst;
+    return tuple_value;
 }
 
-auto amun::LLVMBackend::visit(AssignExpression* node) -> std::any
+auto amun::LLVMBackend::visit(AssignExpression* node) -> llvm::Value*
 {
     auto left_node = node->left;
     // Assign value to variable
     // variable = value
-    if (auto literal = std::dynamic_pointer_cast<LiteralExpression>(left_node)) {
-        auto name = literal->name.literal;
+    if (auto literal = dynamic_cast<LiteralExpression*>(left_node)) {
+        auto name = std::string(literal->name.literal);
         auto value = node->right->accept(this);
 
         auto right_value = llvm_resolve_value(value);
         auto left_value = node->left->accept(this);
-        if (left_value.type() == typeid(llvm::AllocaInst*)) {
-            auto alloca = std::any_cast<llvm::AllocaInst*>(left_value);
+        if (auto alloca = llvm::dyn_cast<llvm::AllocaInst>(left_value)) {
 
             // Alloca type must be a pointer to rvalue type
             // this case solve assiging dereferneced value into variable
@@ -1230,8 +1291,7 @@ auto amun::LLVMBackend::visit(AssignExpression* node) -> std::any
             return right_value;
         }
 
-        if (left_value.type() == typeid(llvm::GlobalVariable*)) {
-            auto global_variable = std::any_cast<llvm::GlobalVariable*>(left_value);
+        if (auto global_variable = llvm::dyn_cast<llvm::GlobalVariable>(left_value)) {
             Builder.CreateStore(right_value, global_variable);
             return right_value;
         }
@@ -1239,26 +1299,22 @@ auto amun::LLVMBackend::visit(AssignExpression* node) -> std::any
 
     // Assign value to n dimentions array position
     // array []? = value
-    if (auto index_expression = std::dynamic_pointer_cast<IndexExpression>(left_node)) {
+    if (auto index_expression = dynamic_cast<IndexExpression*>(left_node)) {
         auto node_value = index_expression->value;
         auto index = llvm_resolve_value(index_expression->index->accept(this));
-        auto right_value = llvm_node_value(node->right->accept(this));
+        auto right_value = node->right->accept(this);
 
         // Update element value in Single dimention Array
-        if (auto array_literal = std::dynamic_pointer_cast<LiteralExpression>(node_value)) {
+        if (auto array_literal = dynamic_cast<LiteralExpression*>(node_value)) {
             auto array = array_literal->accept(this);
-            if (array.type() == typeid(llvm::AllocaInst*)) {
-                auto alloca = llvm::dyn_cast<llvm::AllocaInst>(
-                    llvm_node_value(alloca_inst_table.lookup(array_literal->name.literal)));
+            if (auto alloca = llvm::dyn_cast<llvm::AllocaInst>(array)) {
                 auto ptr = Builder.CreateGEP(alloca->getAllocatedType(), alloca,
                                              {zero_int32_value, index});
                 Builder.CreateStore(right_value, ptr);
                 return right_value;
             }
 
-            if (array.type() == typeid(llvm::GlobalVariable*)) {
-                auto global_variable_array =
-                    llvm::dyn_cast<llvm::GlobalVariable>(llvm_node_value(array));
+            if (auto global_variable_array = llvm::dyn_cast<llvm::GlobalVariable>(array)) {
                 auto ptr = Builder.CreateGEP(global_variable_array->getValueType(),
                                              global_variable_array, {zero_int32_value, index});
                 Builder.CreateStore(right_value, ptr);
@@ -1269,8 +1325,8 @@ auto amun::LLVMBackend::visit(AssignExpression* node) -> std::any
         }
 
         // Update element value in Multi dimentions Array
-        if (auto sub_index_expression = std::dynamic_pointer_cast<IndexExpression>(node_value)) {
-            auto array = llvm_node_value(node_value->accept(this));
+        if (node_value->get_ast_node_type() == AstNodeType::AST_INDEX) {
+            auto array = node_value->accept(this);
             auto load_inst = dyn_cast<llvm::LoadInst>(array);
             auto ptr = Builder.CreateGEP(array->getType(), load_inst->getPointerOperand(),
                                          {zero_int32_value, index});
@@ -1279,11 +1335,11 @@ auto amun::LLVMBackend::visit(AssignExpression* node) -> std::any
         }
 
         // Update element value in struct field array
-        if (auto struct_acess = std::dynamic_pointer_cast<DotExpression>(node_value)) {
+        if (auto struct_acess = dynamic_cast<DotExpression*>(node_value)) {
             auto struct_field = struct_acess->accept(this);
-            if (auto load_inst = std::any_cast<llvm::LoadInst*>(struct_field)) {
+            if (auto load_inst = llvm::dyn_cast<llvm::LoadInst>(struct_field)) {
                 auto ptr =
-                    Builder.CreateGEP(llvm_node_value(struct_field)->getType(),
+                    Builder.CreateGEP(struct_field->getType(),
                                       load_inst->getPointerOperand(), {zero_int32_value, index});
                 if (right_value->getType() == ptr->getType()) {
                     right_value = derefernecs_llvm_pointer(right_value);
@@ -1295,8 +1351,8 @@ auto amun::LLVMBackend::visit(AssignExpression* node) -> std::any
     }
 
     // Assign value to structure field
-    if (auto dot_expression = std::dynamic_pointer_cast<DotExpression>(left_node)) {
-        auto member_ptr = access_struct_member_pointer(dot_expression.get());
+    if (auto dot_expression = dynamic_cast<DotExpression*>(left_node)) {
+        auto member_ptr = access_struct_member_pointer(dot_expression);
         auto rvalue = llvm_resolve_value(node->right->accept(this));
         Builder.CreateStore(rvalue, member_ptr);
         return rvalue;
@@ -1304,15 +1360,15 @@ auto amun::LLVMBackend::visit(AssignExpression* node) -> std::any
 
     // Assign value to pointer address
     // *ptr = value;
-    if (auto unary_expression = std::dynamic_pointer_cast<PrefixUnaryExpression>(left_node)) {
+    if (auto unary_expression = dynamic_cast<PrefixUnaryExpression*>(left_node)) {
         auto opt = unary_expression->operator_token.kind;
         if (opt == TokenKind::TOKEN_STAR) {
             auto rvalue = llvm_resolve_value(node->right->accept(this));
             auto unary_right_type = unary_expression->right->get_type_node();
-            auto pointer_type = std::static_pointer_cast<amun::PointerType>(unary_right_type);
-            auto pointer_base_type = llvm_type_from_amun_type(pointer_type->base_type);
-            auto pointer = llvm_node_value(unary_expression->right->accept(this));
-            auto load = Builder.CreateLoad(pointer_base_type, pointer);
+            auto pointer_type = static_cast<amun::PointerType*>(unary_right_type);
+            auto pointer_llvm_type = llvm_type_from_amun_type(pointer_type);
+            auto pointer = unary_expression->right->accept(this);
+            auto load = Builder.CreateLoad(pointer_llvm_type, pointer);
             Builder.CreateStore(rvalue, load);
             return rvalue;
         }
@@ -1321,7 +1377,7 @@ auto amun::LLVMBackend::visit(AssignExpression* node) -> std::any
     internal_compiler_error("Invalid assignments expression with unexpected lvalue type");
 }
 
-auto amun::LLVMBackend::visit(BinaryExpression* node) -> std::any
+auto amun::LLVMBackend::visit(BinaryExpression* node) -> llvm::Value*
 {
     auto lhs = llvm_resolve_value(node->left->accept(this));
     auto rhs = llvm_resolve_value(node->right->accept(this));
@@ -1338,7 +1394,7 @@ auto amun::LLVMBackend::visit(BinaryExpression* node) -> std::any
     }
 
     if (lhs->getType()->isVectorTy() && rhs->getType()->isVectorTy()) {
-        auto vector_type = std::static_pointer_cast<amun::StaticVectorType>(node->type);
+        auto vector_type = static_cast<amun::StaticVectorType*>(node->type);
         auto element_type = vector_type->array->element_type;
         if (amun::is_unsigned_integer_type(element_type)) {
             return create_llvm_integers_vectors_bianry(op, lhs, rhs);
@@ -1354,7 +1410,7 @@ auto amun::LLVMBackend::visit(BinaryExpression* node) -> std::any
     return create_overloading_function_call(name, {lhs, rhs});
 }
 
-auto amun::LLVMBackend::visit(BitwiseExpression* node) -> std::any
+auto amun::LLVMBackend::visit(BitwiseExpression* node) -> llvm::Value*
 {
     auto lhs = llvm_resolve_value(node->left->accept(this));
     auto rhs = llvm_resolve_value(node->right->accept(this));
@@ -1392,7 +1448,7 @@ auto amun::LLVMBackend::visit(BitwiseExpression* node) -> std::any
     return create_overloading_function_call(name, {lhs, rhs});
 }
 
-auto amun::LLVMBackend::visit(ComparisonExpression* node) -> std::any
+auto amun::LLVMBackend::visit(ComparisonExpression* node) -> llvm::Value*
 {
     auto lhs = llvm_resolve_value(node->left->accept(this));
     auto rhs = llvm_resolve_value(node->right->accept(this));
@@ -1418,9 +1474,9 @@ auto amun::LLVMBackend::visit(ComparisonExpression* node) -> std::any
         // Can be optimized by checking if both sides are String literal expression
         if (node->left->get_ast_node_type() == AstNodeType::AST_STRING &&
             node->right->get_ast_node_type() == AstNodeType::AST_STRING) {
-            auto lhs_str = std::dynamic_pointer_cast<StringExpression>(node->left)->value.literal;
-            auto rlhs_str = std::dynamic_pointer_cast<StringExpression>(node->right)->value.literal;
-            auto compare = std::strcmp(lhs_str.c_str(), rlhs_str.c_str());
+            auto lhs_str = dynamic_cast<StringExpression*>(node->left)->value.literal;
+            auto rlhs_str = dynamic_cast<StringExpression*>(node->right)->value.literal;
+            auto compare = lhs_str.compare(rlhs_str);
             auto result_llvm = create_llvm_int32(compare, true);
             return create_llvm_integers_comparison(op, result_llvm, zero_int32_value);
         }
@@ -1437,7 +1493,7 @@ auto amun::LLVMBackend::visit(ComparisonExpression* node) -> std::any
 
     // Comparison Operations for vectors types
     if (lhs->getType()->isVectorTy() && rhs->getType()->isVectorTy()) {
-        auto vector_type = std::static_pointer_cast<amun::StaticVectorType>(node->type);
+        auto vector_type = static_cast<amun::StaticVectorType*>(node->type);
         auto element_type = vector_type->array->element_type;
         if (amun::is_unsigned_integer_type(element_type)) {
             return create_llvm_unsigned_integers_comparison(op, lhs, rhs);
@@ -1453,7 +1509,7 @@ auto amun::LLVMBackend::visit(ComparisonExpression* node) -> std::any
     return create_overloading_function_call(name, {lhs, rhs});
 }
 
-auto amun::LLVMBackend::visit(LogicalExpression* node) -> std::any
+auto amun::LLVMBackend::visit(LogicalExpression* node) -> llvm::Value*
 {
     auto lhs = llvm_resolve_value(node->left->accept(this));
     auto rhs = llvm_resolve_value(node->right->accept(this));
@@ -1478,7 +1534,7 @@ auto amun::LLVMBackend::visit(LogicalExpression* node) -> std::any
     return create_overloading_function_call(name, {lhs, rhs});
 }
 
-auto amun::LLVMBackend::visit(PrefixUnaryExpression* node) -> std::any
+auto amun::LLVMBackend::visit(PrefixUnaryExpression* node) -> llvm::Value*
 {
     auto operand = node->right;
     auto operator_kind = node->operator_token.kind;
@@ -1510,7 +1566,7 @@ auto amun::LLVMBackend::visit(PrefixUnaryExpression* node) -> std::any
 
     // Pointer * Dereference operator
     if (operator_kind == TokenKind::TOKEN_STAR) {
-        auto right = llvm_node_value(operand->accept(this));
+        auto right = operand->accept(this);
         auto is_expect_struct_type = node->get_type_node()->type_kind == amun::TypeKind::STRUCT;
         // No need to emit 2 load inst if the current type is pointer to struct
         if (is_expect_struct_type) {
@@ -1522,8 +1578,9 @@ auto amun::LLVMBackend::visit(PrefixUnaryExpression* node) -> std::any
 
     // Address of operator (&) to return pointer of operand
     if (operator_kind == TokenKind::TOKEN_AND) {
-        auto right = llvm_node_value(operand->accept(this));
-        auto ptr = Builder.CreateAlloca(right->getType(), nullptr);
+        auto right = operand->accept(this);
+        auto current_function = Builder.GetInsertBlock()->getParent();
+        auto ptr = create_entry_block_alloca(current_function, "", right->getType());
         Builder.CreateStore(right, ptr);
         return ptr;
     }
@@ -1563,7 +1620,7 @@ auto amun::LLVMBackend::visit(PrefixUnaryExpression* node) -> std::any
     internal_compiler_error("Invalid Prefix Unary operator");
 }
 
-auto amun::LLVMBackend::visit(PostfixUnaryExpression* node) -> std::any
+auto amun::LLVMBackend::visit(PostfixUnaryExpression* node) -> llvm::Value*
 {
     auto operand = node->right;
     auto operator_kind = node->operator_token.kind;
@@ -1593,14 +1650,14 @@ auto amun::LLVMBackend::visit(PostfixUnaryExpression* node) -> std::any
     internal_compiler_error("Invalid Postfix Unary operator");
 }
 
-auto amun::LLVMBackend::visit(CallExpression* node) -> std::any
+auto amun::LLVMBackend::visit(CallExpression* node) -> llvm::Value*
 {
     auto callee_ast_node_type = node->callee->get_ast_node_type();
 
     // If callee is also a CallExpression this case when you have a function that return a
     // function pointer and you call it for example function()();
     if (callee_ast_node_type == AstNodeType::AST_CALL) {
-        auto callee_function = llvm_node_value(node->callee->accept(this));
+        auto callee_function = node->callee->accept(this);
         auto call_instruction = llvm::dyn_cast<llvm::CallInst>(callee_function);
         auto function = call_instruction->getCalledFunction();
         auto callee_function_type = function->getFunctionType();
@@ -1612,7 +1669,7 @@ auto amun::LLVMBackend::visit(CallExpression* node) -> std::any
         std::vector<llvm::Value*> arguments_values;
         arguments_values.reserve(arguments_size);
         for (size_t i = 0; i < arguments_size; i++) {
-            auto value = llvm_node_value(arguments[i]->accept(this));
+            auto value = arguments[i]->accept(this);
             if (function_pointer_type->getParamType(i) == value->getType()) {
                 arguments_values.push_back(value);
             }
@@ -1627,8 +1684,8 @@ auto amun::LLVMBackend::visit(CallExpression* node) -> std::any
 
     // If callee is literal expression that mean it a function call or function pointer call
     if (callee_ast_node_type == AstNodeType::AST_LITERAL) {
-        auto callee = std::dynamic_pointer_cast<LiteralExpression>(node->callee);
-        auto callee_literal = callee->name.literal;
+        auto callee = dynamic_cast<LiteralExpression*>(node->callee);
+        auto callee_literal = std::string(callee->name.literal);
         auto function = lookup_function(callee_literal);
         if (not function && functions_declaraions.contains(callee_literal)) {
             auto declaraion = functions_declaraions[callee_literal];
@@ -1637,7 +1694,7 @@ auto amun::LLVMBackend::visit(CallExpression* node) -> std::any
         }
 
         if (not function) {
-            auto value = llvm_node_value(alloca_inst_table.lookup(callee_literal));
+            auto value = alloca_inst_table.lookup(callee_literal);
             if (auto alloca = llvm::dyn_cast<llvm::AllocaInst>(value)) {
                 auto loaded = Builder.CreateLoad(alloca->getAllocatedType(), alloca);
                 auto function_type = llvm_type_from_amun_type(node->get_type_node());
@@ -1647,7 +1704,7 @@ auto amun::LLVMBackend::visit(CallExpression* node) -> std::any
                     std::vector<llvm::Value*> arguments_values;
                     arguments_values.reserve(arguments_size);
                     for (size_t i = 0; i < arguments_size; i++) {
-                        auto value = llvm_node_value(arguments[i]->accept(this));
+                        auto value = arguments[i]->accept(this);
                         if (function_pointer->getParamType(i) == value->getType()) {
                             arguments_values.push_back(value);
                         }
@@ -1690,7 +1747,7 @@ auto amun::LLVMBackend::visit(CallExpression* node) -> std::any
         // Resolve explicit arguments
         for (size_t i = 0; i < arguments_size; i++) {
             auto argument = arguments[i];
-            auto value = llvm_node_value(argument->accept(this));
+            auto value = argument->accept(this);
 
             // This condition works only if this function has varargs flag
             if (i >= parameter_size) {
@@ -1738,8 +1795,8 @@ auto amun::LLVMBackend::visit(CallExpression* node) -> std::any
 
     // If callee is lambda expression that mean we can call it as function pointer
     if (callee_ast_node_type == AstNodeType::AST_LAMBDA) {
-        auto lambda = std::dynamic_pointer_cast<LambdaExpression>(node->callee);
-        auto lambda_value = llvm_node_value(lambda->accept(this));
+        auto lambda = dynamic_cast<LambdaExpression*>(node->callee);
+        auto lambda_value = lambda->accept(this);
         auto function = llvm::dyn_cast<llvm::Function>(lambda_value);
 
         auto arguments = node->arguments;
@@ -1749,7 +1806,7 @@ auto amun::LLVMBackend::visit(CallExpression* node) -> std::any
         arguments_values.reserve(arguments_size);
         for (size_t i = 0; i < arguments_size; i++) {
             auto argument = arguments[i];
-            auto value = llvm_node_value(argument->accept(this));
+            auto value = argument->accept(this);
 
             // This condition works only if this function has varargs flag
             if (i >= parameter_size) {
@@ -1780,12 +1837,12 @@ auto amun::LLVMBackend::visit(CallExpression* node) -> std::any
 
     // If callee is dot expression that mean we call function pointer from struct element
     if (callee_ast_node_type == AstNodeType::AST_DOT) {
-        auto dot = std::dynamic_pointer_cast<DotExpression>(node->callee);
-        auto struct_fun_ptr = llvm_node_value(dot->accept(this));
+        auto dot = dynamic_cast<DotExpression*>(node->callee);
+        auto struct_fun_ptr = dot->accept(this);
 
         auto function_value = derefernecs_llvm_pointer(struct_fun_ptr);
 
-        auto function_ptr_type = std::static_pointer_cast<amun::PointerType>(dot->get_type_node());
+        auto function_ptr_type = static_cast<amun::PointerType*>(dot->get_type_node());
         auto llvm_type = llvm_type_from_amun_type(function_ptr_type->base_type);
         auto llvm_fun_type = llvm::dyn_cast<llvm::FunctionType>(llvm_type);
 
@@ -1796,7 +1853,7 @@ auto amun::LLVMBackend::visit(CallExpression* node) -> std::any
         arguments_values.reserve(arguments_size);
         for (size_t i = 0; i < arguments_size; i++) {
             auto argument = arguments[i];
-            auto value = llvm_node_value(argument->accept(this));
+            auto value = argument->accept(this);
 
             // This condition works only if this function has varargs flag
             if (i >= parameter_size) {
@@ -1829,13 +1886,13 @@ auto amun::LLVMBackend::visit(CallExpression* node) -> std::any
     internal_compiler_error("Invalid call expression callee type");
 }
 
-auto amun::LLVMBackend::visit(InitializeExpression* node) -> std::any
+auto amun::LLVMBackend::visit(InitializeExpression* node) -> llvm::Value*
 {
 
     // Convert struct and resolve it first if it generic to LLVM struct type
     llvm::Type* struct_type;
     if (node->type->type_kind == amun::TypeKind::GENERIC_STRUCT) {
-        auto generic = std::static_pointer_cast<amun::GenericStructType>(node->type);
+        auto generic = static_cast<amun::GenericStructType*>(node->type);
         struct_type = resolve_generic_struct(generic);
     }
     else {
@@ -1856,26 +1913,22 @@ auto amun::LLVMBackend::visit(InitializeExpression* node) -> std::any
         return llvm::ConstantStruct::get(llvm_struct_type, constants_arguments);
     }
 
-    auto alloc_inst = Builder.CreateAlloca(struct_type);
-
-    // Loop over arguments and set them by index
-    size_t argument_index = 0;
+    // Loop over arguments and insert them into the struct value by index
+    llvm::Value* struct_value = llvm::UndefValue::get(struct_type);
+    unsigned argument_index = 0;
     for (auto& argument : node->arguments) {
         auto argument_value = llvm_resolve_value(argument->accept(this));
-        auto index = llvm::ConstantInt::get(llvm_context, llvm::APInt(32, argument_index, true));
-        auto member_ptr = Builder.CreateGEP(struct_type, alloc_inst, {zero_int32_value, index});
-        Builder.CreateStore(argument_value, member_ptr);
+        struct_value = Builder.CreateInsertValue(struct_value, argument_value, argument_index);
         argument_index++;
     }
 
-    // Return refernce to the struct initializer
-    return alloc_inst;
+    return struct_value;
 }
 
-auto amun::LLVMBackend::visit(LambdaExpression* node) -> std::any
+auto amun::LLVMBackend::visit(LambdaExpression* node) -> llvm::Value*
 {
     auto lambda_name = "_lambda" + std::to_string(lambda_unique_id++);
-    auto function_ptr_type = std::static_pointer_cast<amun::PointerType>(node->get_type_node());
+    auto function_ptr_type = static_cast<amun::PointerType*>(node->get_type_node());
     auto node_llvm_type = llvm_type_from_amun_type(function_ptr_type->base_type);
     auto function_type = llvm::dyn_cast<llvm::FunctionType>(node_llvm_type);
 
@@ -1916,9 +1969,11 @@ auto amun::LLVMBackend::visit(LambdaExpression* node) -> std::any
     }
 
     defer_calls_stack.push({});
+    stack_slots_stack.emplace(function);
 
     node->body->accept(this);
 
+    stack_slots_stack.pop();
     defer_calls_stack.pop();
 
     pop_alloca_inst_scope();
@@ -1932,7 +1987,7 @@ auto amun::LLVMBackend::visit(LambdaExpression* node) -> std::any
     return function;
 }
 
-auto amun::LLVMBackend::visit(DotExpression* node) -> std::any
+auto amun::LLVMBackend::visit(DotExpression* node) -> llvm::Value*
 {
     auto callee = node->callee;
     auto callee_type = callee->get_type_node();
@@ -1965,12 +2020,12 @@ auto amun::LLVMBackend::visit(DotExpression* node) -> std::any
 
             // If node is string expression, length can calculated without strlen
             if (node->callee->get_ast_node_type() == AstNodeType::AST_STRING) {
-                auto string = std::dynamic_pointer_cast<StringExpression>(node->callee);
+                auto string = dynamic_cast<StringExpression*>(node->callee);
                 auto length = string->value.literal.size();
                 return create_llvm_int64(length, true);
             }
 
-            auto string_ptr = llvm_node_value(callee->accept(this));
+            auto string_ptr = callee->accept(this);
 
             // Check if it **int8 that mean the string is store in variable and should
             // dereferneceed
@@ -1983,7 +2038,16 @@ auto amun::LLVMBackend::visit(DotExpression* node) -> std::any
         internal_compiler_error("Invalid String Attribute");
     }
 
-    auto member_ptr = access_struct_member_pointer(node);
+    auto callee_value = callee->accept(this);
+
+    // Fields of struct values like function call results or if and switch expressions are
+    // extracted directly, pointers fields still need the address for example node.next.data
+    if (is_aggregate_value(callee_value) && !expected_llvm_type->isPointerTy()) {
+        return Builder.CreateExtractValue(callee_value, node->field_index);
+    }
+
+    auto member_ptr =
+        access_struct_member_pointer(callee_value, callee_llvm_type, node->field_index);
 
     // If expected type is pointer no need for loading it for example node.next.data
     if (expected_llvm_type->isPointerTy()) {
@@ -1993,7 +2057,7 @@ auto amun::LLVMBackend::visit(DotExpression* node) -> std::any
     return Builder.CreateLoad(expected_llvm_type, member_ptr);
 }
 
-auto amun::LLVMBackend::visit(CastExpression* node) -> std::any
+auto amun::LLVMBackend::visit(CastExpression* node) -> llvm::Value*
 {
     auto value = llvm_resolve_value(node->value->accept(this));
     auto value_type = llvm_type_from_amun_type(node->value->get_type_node());
@@ -2047,7 +2111,8 @@ auto amun::LLVMBackend::visit(CastExpression* node) -> std::any
 
         // No need for load instruction if array is array literal not variable
         // Example -> var ptr = cast(*int64) [1, 2, 3];
-        auto alloca = Builder.CreateAlloca(value_type);
+        auto current_function = Builder.GetInsertBlock()->getParent();
+        auto alloca = create_entry_block_alloca(current_function, "", value_type);
         Builder.CreateStore(value, alloca);
         auto load = Builder.CreateLoad(alloca->getAllocatedType(), alloca);
         const auto& load_inst = dyn_cast<llvm::LoadInst>(load);
@@ -2059,21 +2124,21 @@ auto amun::LLVMBackend::visit(CastExpression* node) -> std::any
     return Builder.CreateBitCast(value, target_type);
 }
 
-auto amun::LLVMBackend::visit(TypeSizeExpression* node) -> std::any
+auto amun::LLVMBackend::visit(TypeSizeExpression* node) -> llvm::Value*
 {
     auto llvm_type = llvm_type_from_amun_type(node->type);
     auto type_alloc_size = llvm_module->getDataLayout().getTypeAllocSize(llvm_type);
     return create_llvm_int64(type_alloc_size, true);
 }
 
-auto amun::LLVMBackend::visit(TypeAlignExpression* node) -> std::any
+auto amun::LLVMBackend::visit(TypeAlignExpression* node) -> llvm::Value*
 {
     auto llvm_type = llvm_type_from_amun_type(node->type);
     auto allign = llvm_module->getDataLayout().getABITypeAlign(llvm_type);
     return create_llvm_int64(allign.value(), true);
 }
 
-auto amun::LLVMBackend::visit(ValueSizeExpression* node) -> std::any
+auto amun::LLVMBackend::visit(ValueSizeExpression* node) -> llvm::Value*
 {
     auto llvm_type = llvm_type_from_amun_type(node->value->get_type_node());
     auto type_alloc_size = llvm_module->getDataLayout().getTypeAllocSize(llvm_type);
@@ -2081,43 +2146,49 @@ auto amun::LLVMBackend::visit(ValueSizeExpression* node) -> std::any
     return type_size;
 }
 
-auto amun::LLVMBackend::visit(IndexExpression* node) -> std::any
+auto amun::LLVMBackend::visit(IndexExpression* node) -> llvm::Value*
 {
     auto index = llvm_resolve_value(node->index->accept(this));
     return access_array_element(node->value, index);
 }
 
-auto amun::LLVMBackend::visit(EnumAccessExpression* node) -> std::any
+auto amun::LLVMBackend::visit(EnumAccessExpression* node) -> llvm::Value*
 {
     auto element_type = llvm_type_from_amun_type(node->get_type_node());
     auto element_index = llvm::ConstantInt::get(element_type, node->enum_element_index);
     return llvm::dyn_cast<llvm::Value>(element_index);
 }
 
-auto amun::LLVMBackend::visit(LiteralExpression* node) -> std::any
+auto amun::LLVMBackend::visit(LiteralExpression* node) -> llvm::Value*
 {
-    const auto name = node->name.literal;
+    const auto name = std::string(node->name.literal);
     // If found in alloca inst table that mean it local variable
-    auto alloca_inst = alloca_inst_table.lookup(name);
-    if (alloca_inst.type() != typeid(nullptr)) {
+    if (auto alloca_inst = alloca_inst_table.lookup(name)) {
         return alloca_inst;
     }
     // If it not in alloca inst table,that mean it global variable
     return llvm_module->getNamedGlobal(name);
 }
 
-auto amun::LLVMBackend::visit(NumberExpression* node) -> std::any
+auto amun::LLVMBackend::visit(NumberExpression* node) -> llvm::Value*
 {
-    auto number_type = std::static_pointer_cast<amun::NumberType>(node->get_type_node());
-    return llvm_number_value(node->value.literal, number_type->number_kind);
+    auto number_type = static_cast<amun::NumberType*>(node->get_type_node());
+    return llvm_number_value(std::string(node->value.literal), number_type->number_kind);
 }
 
-auto amun::LLVMBackend::visit(ArrayExpression* node) -> std::any
+auto amun::LLVMBackend::visit(ArrayExpression* node) -> llvm::Value*
 {
     auto node_values = node->values;
     auto size = node_values.size();
+
+    auto* node_type = node->get_type_node();
+    auto instance_type = node->generic_instances_types.find(generic_arguments);
+    if (instance_type != node->generic_instances_types.end()) {
+        node_type = instance_type->second;
+    }
+
     if (node->is_constant()) {
-        auto* llvm_type = llvm_type_from_amun_type(node->get_type_node());
+        auto* llvm_type = llvm_type_from_amun_type(node_type);
         auto* array_type = llvm::dyn_cast<llvm::ArrayType>(llvm_type);
 
         std::vector<llvm::Constant*> values;
@@ -2129,7 +2200,7 @@ auto amun::LLVMBackend::visit(ArrayExpression* node) -> std::any
         return llvm::ConstantArray::get(array_type, values);
     }
 
-    auto* array_type = llvm_type_from_amun_type(node->get_type_node());
+    auto* array_type = llvm_type_from_amun_type(node_type);
     auto* array_element_type = array_type->getArrayElementType();
 
     std::vector<llvm::Value*> values;
@@ -2138,7 +2209,7 @@ auto amun::LLVMBackend::visit(ArrayExpression* node) -> std::any
         values.push_back(llvm_resolve_value(value->accept(this)));
     }
 
-    auto* alloca = Builder.CreateAlloca(array_type);
+    auto* alloca = create_temporary_alloca(array_type);
     for (size_t i = 0; i < size; i++) {
         auto* index = llvm::ConstantInt::get(llvm_context, llvm::APInt(32, i, true));
         auto* ptr =
@@ -2155,12 +2226,12 @@ auto amun::LLVMBackend::visit(ArrayExpression* node) -> std::any
     return alloca;
 }
 
-auto amun::LLVMBackend::visit(VectorExpression* node) -> std::any
+auto amun::LLVMBackend::visit(VectorExpression* node) -> llvm::Value*
 {
     auto array = node->array;
-    auto array_type = std::static_pointer_cast<amun::StaticArrayType>(array->type);
+    auto array_type = static_cast<amun::StaticArrayType*>(array->type);
     auto element_type = array_type->element_type;
-    auto number_type = std::static_pointer_cast<amun::NumberType>(element_type);
+    auto number_type = static_cast<amun::NumberType*>(element_type);
     auto number_kind = number_type->number_kind;
     auto array_values = array->values;
     auto array_size = array_values.size();
@@ -2170,8 +2241,8 @@ auto amun::LLVMBackend::visit(VectorExpression* node) -> std::any
         values.reserve(array_size);
 
         for (auto& value : array_values) {
-            auto number = std::dynamic_pointer_cast<NumberExpression>(value);
-            values.push_back(str_to_int(number->value.literal.c_str()));
+            auto number = dynamic_cast<NumberExpression*>(value);
+            values.push_back(str_to_int(std::string(number->value.literal).c_str()));
         }
 
         return llvm::ConstantDataVector::get(llvm_context, values);
@@ -2182,8 +2253,8 @@ auto amun::LLVMBackend::visit(VectorExpression* node) -> std::any
         values.reserve(array_size);
 
         for (auto& value : array_values) {
-            auto number = std::dynamic_pointer_cast<NumberExpression>(value);
-            values.push_back(str_to_int(number->value.literal.c_str()));
+            auto number = dynamic_cast<NumberExpression*>(value);
+            values.push_back(str_to_int(std::string(number->value.literal).c_str()));
         }
 
         return llvm::ConstantDataVector::get(llvm_context, values);
@@ -2194,8 +2265,8 @@ auto amun::LLVMBackend::visit(VectorExpression* node) -> std::any
         values.reserve(array_size);
 
         for (auto& value : array_values) {
-            auto number = std::dynamic_pointer_cast<NumberExpression>(value);
-            values.push_back(str_to_int(number->value.literal.c_str()));
+            auto number = dynamic_cast<NumberExpression*>(value);
+            values.push_back(str_to_int(std::string(number->value.literal).c_str()));
         }
 
         return llvm::ConstantDataVector::get(llvm_context, values);
@@ -2206,8 +2277,8 @@ auto amun::LLVMBackend::visit(VectorExpression* node) -> std::any
         values.reserve(array_size);
 
         for (auto& value : array_values) {
-            auto number = std::dynamic_pointer_cast<NumberExpression>(value);
-            values.push_back(str_to_int(number->value.literal.c_str()));
+            auto number = dynamic_cast<NumberExpression*>(value);
+            values.push_back(str_to_int(std::string(number->value.literal).c_str()));
         }
 
         return llvm::ConstantDataVector::get(llvm_context, values);
@@ -2218,8 +2289,8 @@ auto amun::LLVMBackend::visit(VectorExpression* node) -> std::any
         values.reserve(array_size);
 
         for (auto& value : array_values) {
-            auto number = std::dynamic_pointer_cast<NumberExpression>(value);
-            values.push_back(str_to_float(number->value.literal.c_str()));
+            auto number = dynamic_cast<NumberExpression*>(value);
+            values.push_back(str_to_float(std::string(number->value.literal).c_str()));
         }
 
         return llvm::ConstantDataVector::get(llvm_context, values);
@@ -2230,8 +2301,8 @@ auto amun::LLVMBackend::visit(VectorExpression* node) -> std::any
         values.reserve(array_size);
 
         for (auto& value : array_values) {
-            auto number = std::dynamic_pointer_cast<NumberExpression>(value);
-            values.push_back(str_to_float(number->value.literal.c_str()));
+            auto number = dynamic_cast<NumberExpression*>(value);
+            values.push_back(str_to_float(std::string(number->value.literal).c_str()));
         }
 
         return llvm::ConstantDataVector::get(llvm_context, values);
@@ -2240,100 +2311,59 @@ auto amun::LLVMBackend::visit(VectorExpression* node) -> std::any
     internal_compiler_error("Invalid number size on Vector Expression");
 }
 
-auto amun::LLVMBackend::visit(StringExpression* node) -> std::any
+auto amun::LLVMBackend::visit(StringExpression* node) -> llvm::Value*
 {
-    std::string literal = node->value.literal;
+    auto literal = std::string(node->value.literal);
     return resolve_constant_string_expression(literal);
 }
 
-auto amun::LLVMBackend::visit(CharacterExpression* node) -> std::any
+auto amun::LLVMBackend::visit(CharacterExpression* node) -> llvm::Value*
 {
     char char_asci_value = node->value.literal[0];
     return create_llvm_int8(char_asci_value, false);
 }
 
-auto amun::LLVMBackend::visit(BooleanExpression* node) -> std::any
+auto amun::LLVMBackend::visit(BooleanExpression* node) -> llvm::Value*
 {
     return create_llvm_int1(node->value.kind == TokenKind::TOKEN_TRUE);
 }
 
-auto amun::LLVMBackend::visit(NullExpression* node) -> std::any
+auto amun::LLVMBackend::visit(NullExpression* node) -> llvm::Value*
 {
     auto llvm_type = llvm_type_from_amun_type(node->null_base_type);
     return create_llvm_null(llvm_type);
 }
 
-auto amun::LLVMBackend::visit(UndefinedExpression* node) -> std::any
+auto amun::LLVMBackend::visit(UndefinedExpression* node) -> llvm::Value*
 {
     auto* llvm_type = llvm_type_from_amun_type(node->base_type);
     return llvm::UndefValue::get(llvm_type);
 }
 
-auto amun::LLVMBackend::visit(InfinityExpression* node) -> std::any
+auto amun::LLVMBackend::visit(InfinityExpression* node) -> llvm::Value*
 {
     auto* type = llvm_type_from_amun_type(node->get_type_node());
     return llvm::ConstantFP::getInfinity(type);
 }
 
-auto amun::LLVMBackend::llvm_node_value(std::any any_value) -> llvm::Value*
+auto amun::LLVMBackend::llvm_resolve_value(llvm::Value* value) -> llvm::Value*
 {
-    if (any_value.type() == typeid(llvm::Value*)) {
-        return std::any_cast<llvm::Value*>(any_value);
-    }
-    else if (any_value.type() == typeid(llvm::CallInst*)) {
-        return std::any_cast<llvm::CallInst*>(any_value);
-    }
-    else if (any_value.type() == typeid(llvm::AllocaInst*)) {
-        return std::any_cast<llvm::AllocaInst*>(any_value);
-    }
-    else if (any_value.type() == typeid(llvm::Constant*)) {
-        return std::any_cast<llvm::Constant*>(any_value);
-    }
-    else if (any_value.type() == typeid(llvm::ConstantInt*)) {
-        return std::any_cast<llvm::ConstantInt*>(any_value);
-    }
-    else if (any_value.type() == typeid(llvm::LoadInst*)) {
-        return std::any_cast<llvm::LoadInst*>(any_value);
-    }
-    else if (any_value.type() == typeid(llvm::PHINode*)) {
-        return std::any_cast<llvm::PHINode*>(any_value);
-    }
-    else if (any_value.type() == typeid(llvm::Function*)) {
-        return std::any_cast<llvm::Function*>(any_value);
-    }
-    else if (any_value.type() == typeid(llvm::GlobalVariable*)) {
-        return std::any_cast<llvm::GlobalVariable*>(any_value);
-    }
-    else if (any_value.type() == typeid(llvm::ConstantPointerNull*)) {
-        return std::any_cast<llvm::ConstantPointerNull*>(any_value);
-    }
-    else if (any_value.type() == typeid(llvm::UndefValue*)) {
-        return std::any_cast<llvm::UndefValue*>(any_value);
-    }
-    internal_compiler_error("Unknown type llvm node type ");
-}
-
-auto amun::LLVMBackend::llvm_resolve_value(std::any any_value) -> llvm::Value*
-{
-    auto llvm_value = llvm_node_value(any_value);
-
-    if (auto alloca = llvm::dyn_cast<llvm::AllocaInst>(llvm_value)) {
+    if (auto alloca = llvm::dyn_cast<llvm::AllocaInst>(value)) {
         return Builder.CreateLoad(alloca->getAllocatedType(), alloca);
     }
 
-    if (auto variable = llvm::dyn_cast<llvm::GlobalVariable>(llvm_value)) {
+    if (auto variable = llvm::dyn_cast<llvm::GlobalVariable>(value)) {
         return variable->getInitializer();
     }
 
-    return llvm_value;
+    return value;
 }
 
 auto amun::LLVMBackend::llvm_resolve_variable(const std::string& name) -> llvm::Value*
 {
     // If found in alloca inst table that mean it local variable
-    auto alloca_inst = alloca_inst_table.lookup(name);
-    if (alloca_inst.type() != typeid(nullptr)) {
-        return llvm_node_value(alloca_inst);
+    if (auto alloca_inst = alloca_inst_table.lookup(name)) {
+        return alloca_inst;
     }
     // If it not in alloca inst table,that mean it global variable
     return llvm_module->getNamedGlobal(name);
@@ -2390,11 +2420,11 @@ inline auto amun::LLVMBackend::llvm_number_value(const std::string& value_litear
     }
 }
 
-auto amun::LLVMBackend::llvm_type_from_amun_type(Shared<amun::Type> type) -> llvm::Type*
+auto amun::LLVMBackend::llvm_type_from_amun_type(amun::Type* type) -> llvm::Type*
 {
     amun::TypeKind type_kind = type->type_kind;
     if (type_kind == amun::TypeKind::NUMBER) {
-        auto amun_number_type = std::static_pointer_cast<amun::NumberType>(type);
+        auto amun_number_type = static_cast<amun::NumberType*>(type);
         amun::NumberKind number_kind = amun_number_type->number_kind;
         switch (number_kind) {
         case amun::NumberKind::INTEGER_1: return llvm_int1_type;
@@ -2412,14 +2442,14 @@ auto amun::LLVMBackend::llvm_type_from_amun_type(Shared<amun::Type> type) -> llv
     }
 
     if (type_kind == amun::TypeKind::STATIC_ARRAY) {
-        auto amun_array_type = std::static_pointer_cast<amun::StaticArrayType>(type);
+        auto amun_array_type = static_cast<amun::StaticArrayType*>(type);
         auto element_type = llvm_type_from_amun_type(amun_array_type->element_type);
         auto size = amun_array_type->size;
         return llvm::ArrayType::get(element_type, size);
     }
 
     if (type_kind == amun::TypeKind::STATIC_VECTOR) {
-        auto amun_vec_type = std::static_pointer_cast<amun::StaticVectorType>(type);
+        auto amun_vec_type = static_cast<amun::StaticVectorType*>(type);
         auto array_type = amun_vec_type->array;
         auto llvm_element_type = llvm_type_from_amun_type(array_type->element_type);
         auto length = llvm::ElementCount::get(array_type->size, false);
@@ -2427,7 +2457,7 @@ auto amun::LLVMBackend::llvm_type_from_amun_type(Shared<amun::Type> type) -> llv
     }
 
     if (type_kind == amun::TypeKind::POINTER) {
-        auto amun_pointer_type = std::static_pointer_cast<amun::PointerType>(type);
+        auto amun_pointer_type = static_cast<amun::PointerType*>(type);
         auto pointer_base = amun_pointer_type->base_type;
 
         // In llvm *void should be generated as *i8
@@ -2437,7 +2467,7 @@ auto amun::LLVMBackend::llvm_type_from_amun_type(Shared<amun::Type> type) -> llv
 
         // Check if it's a self reference to the current struct type
         if (pointer_base->type_kind == amun::TypeKind::STRUCT) {
-            auto amun_struct_type = std::static_pointer_cast<amun::StructType>(pointer_base);
+            auto amun_struct_type = static_cast<amun::StructType*>(pointer_base);
             if (amun_struct_type->name == current_struct_type->getName()) {
                 return current_struct_type->getPointerTo();
             }
@@ -2448,7 +2478,7 @@ auto amun::LLVMBackend::llvm_type_from_amun_type(Shared<amun::Type> type) -> llv
     }
 
     if (type_kind == amun::TypeKind::FUNCTION) {
-        auto amun_function_type = std::static_pointer_cast<amun::FunctionType>(type);
+        auto amun_function_type = static_cast<amun::FunctionType*>(type);
         auto parameters = amun_function_type->parameters;
         int parameters_size = parameters.size();
         std::vector<llvm::Type*> arguments(parameters_size);
@@ -2461,7 +2491,7 @@ auto amun::LLVMBackend::llvm_type_from_amun_type(Shared<amun::Type> type) -> llv
     }
 
     if (type_kind == amun::TypeKind::STRUCT) {
-        auto struct_type = std::static_pointer_cast<amun::StructType>(type);
+        auto struct_type = static_cast<amun::StructType*>(type);
         auto struct_name = struct_type->name;
         if (structures_types_map.contains(struct_name)) {
             return structures_types_map[struct_name];
@@ -2474,12 +2504,12 @@ auto amun::LLVMBackend::llvm_type_from_amun_type(Shared<amun::Type> type) -> llv
     }
 
     if (type_kind == amun::TypeKind::TUPLE) {
-        auto tuple_type = std::static_pointer_cast<amun::TupleType>(type);
+        auto tuple_type = static_cast<amun::TupleType*>(type);
         if (tuple_type->name == "_tuple_") {
-            std::vector<Shared<amun::Type>> resolved_fileds;
+            std::vector<amun::Type*> resolved_fileds;
             for (const auto& field : tuple_type->fields_types) {
                 if (field->type_kind == TypeKind::GENERIC_PARAMETER) {
-                    auto generic_type = std::static_pointer_cast<amun::GenericParameterType>(field);
+                    auto generic_type = static_cast<amun::GenericParameterType*>(field);
                     if (this->generic_types.contains(generic_type->name)) {
                         resolved_fileds.push_back(this->generic_types[generic_type->name]);
                         continue;
@@ -2488,13 +2518,13 @@ auto amun::LLVMBackend::llvm_type_from_amun_type(Shared<amun::Type> type) -> llv
                 resolved_fileds.push_back(field);
             }
             auto new_tuple = "_tuple_" + mangle_types(resolved_fileds);
-            tuple_type = std::make_shared<amun::TupleType>(new_tuple, resolved_fileds);
+            return create_llvm_struct_type(new_tuple, resolved_fileds, false, false);
         }
         return create_llvm_struct_type(tuple_type->name, tuple_type->fields_types, false, false);
     }
 
     if (type_kind == amun::TypeKind::ENUM_ELEMENT) {
-        auto enum_element_type = std::static_pointer_cast<amun::EnumElementType>(type);
+        auto enum_element_type = static_cast<amun::EnumElementType*>(type);
         return llvm_type_from_amun_type(enum_element_type->element_type);
     }
 
@@ -2503,12 +2533,12 @@ auto amun::LLVMBackend::llvm_type_from_amun_type(Shared<amun::Type> type) -> llv
     }
 
     if (type_kind == amun::TypeKind::GENERIC_STRUCT) {
-        auto generic_struct_type = std::static_pointer_cast<amun::GenericStructType>(type);
+        auto generic_struct_type = static_cast<amun::GenericStructType*>(type);
         return resolve_generic_struct(generic_struct_type);
     }
 
     if (type_kind == amun::TypeKind::GENERIC_PARAMETER) {
-        auto generic_paramter = std::static_pointer_cast<amun::GenericParameterType>(type);
+        auto generic_paramter = static_cast<amun::GenericParameterType*>(type);
         auto generic_name = generic_paramter->name;
         if (!this->generic_types.contains(generic_name)) {
             internal_compiler_error("Trying to resolve an invalid generic parameter name");
@@ -2772,31 +2802,22 @@ auto amun::LLVMBackend::create_llvm_strings_comparison(TokenKind op, llvm::Value
     }
 }
 
-auto amun::LLVMBackend::create_llvm_value_increment(Shared<Expression> operand, bool is_prefix)
+auto amun::LLVMBackend::create_llvm_value_increment(Expression* operand, bool is_prefix)
     -> llvm::Value*
 {
-    auto number_type = std::static_pointer_cast<amun::NumberType>(operand->get_type_node());
+    auto number_type = static_cast<amun::NumberType*>(operand->get_type_node());
     auto constants_one = llvm_number_value("1", number_type->number_kind);
 
-    std::any right = nullptr;
+    llvm::Value* right = nullptr;
     if (operand->get_ast_node_type() == AstNodeType::AST_DOT) {
-        auto dot_expression = std::dynamic_pointer_cast<DotExpression>(operand);
-        right = access_struct_member_pointer(dot_expression.get());
+        auto dot_expression = dynamic_cast<DotExpression*>(operand);
+        right = access_struct_member_pointer(dot_expression);
     }
     else {
         right = operand->accept(this);
     }
 
-    if (right.type() == typeid(llvm::LoadInst*)) {
-        auto current_value = std::any_cast<llvm::LoadInst*>(right);
-        auto new_value =
-            create_llvm_integers_bianry(TokenKind::TOKEN_PLUS, current_value, constants_one);
-        Builder.CreateStore(new_value, current_value->getPointerOperand());
-        return is_prefix ? new_value : current_value;
-    }
-
-    if (right.type() == typeid(llvm::AllocaInst*)) {
-        auto alloca = std::any_cast<llvm::AllocaInst*>(right);
+    if (auto alloca = llvm::dyn_cast<llvm::AllocaInst>(right)) {
         auto current_value = Builder.CreateLoad(alloca->getAllocatedType(), alloca);
         auto new_value =
             create_llvm_integers_bianry(TokenKind::TOKEN_PLUS, current_value, constants_one);
@@ -2804,8 +2825,7 @@ auto amun::LLVMBackend::create_llvm_value_increment(Shared<Expression> operand,
         return is_prefix ? new_value : current_value;
     }
 
-    if (right.type() == typeid(llvm::GlobalVariable*)) {
-        auto global_variable = std::any_cast<llvm::GlobalVariable*>(right);
+    if (auto global_variable = llvm::dyn_cast<llvm::GlobalVariable>(right)) {
         auto current_value = Builder.CreateLoad(global_variable->getValueType(), global_variable);
         auto new_value =
             create_llvm_integers_bianry(TokenKind::TOKEN_PLUS, current_value, constants_one);
@@ -2813,44 +2833,40 @@ auto amun::LLVMBackend::create_llvm_value_increment(Shared<Expression> operand,
         return is_prefix ? new_value : current_value;
     }
 
-    if (right.type() == typeid(llvm::Value*)) {
-        auto current_value_ptr = std::any_cast<llvm::Value*>(right);
-        auto number_llvm_type = llvm_type_from_amun_type(number_type);
-        auto current_value = Builder.CreateLoad(number_llvm_type, current_value_ptr);
+    auto number_llvm_type = llvm_type_from_amun_type(number_type);
+
+    // Index and dot expressions resolve the element value, so update the element pointer
+    auto* element_value = llvm::dyn_cast<llvm::LoadInst>(right);
+    if (element_value != nullptr && element_value->getType() == number_llvm_type) {
         auto new_value =
-            create_llvm_integers_bianry(TokenKind::TOKEN_PLUS, current_value, constants_one);
-        Builder.CreateStore(new_value, current_value_ptr);
-        return is_prefix ? new_value : current_value;
+            create_llvm_integers_bianry(TokenKind::TOKEN_PLUS, element_value, constants_one);
+        Builder.CreateStore(new_value, element_value->getPointerOperand());
+        return is_prefix ? new_value : element_value;
     }
 
-    internal_compiler_error("Unary expression with non global or alloca type");
+    auto current_value = Builder.CreateLoad(number_llvm_type, right);
+    auto new_value =
+        create_llvm_integers_bianry(TokenKind::TOKEN_PLUS, current_value, constants_one);
+    Builder.CreateStore(new_value, right);
+    return is_prefix ? new_value : current_value;
 }
 
-auto amun::LLVMBackend::create_llvm_value_decrement(Shared<Expression> operand, bool is_prefix)
+auto amun::LLVMBackend::create_llvm_value_decrement(Expression* operand, bool is_prefix)
     -> llvm::Value*
 {
-    auto number_type = std::static_pointer_cast<amun::NumberType>(operand->get_type_node());
+    auto number_type = static_cast<amun::NumberType*>(operand->get_type_node());
     auto constants_one = llvm_number_value("1", number_type->number_kind);
 
-    std::any right = nullptr;
+    llvm::Value* right = nullptr;
     if (operand->get_ast_node_type() == AstNodeType::AST_DOT) {
-        auto dot_expression = std::dynamic_pointer_cast<DotExpression>(operand);
-        right = access_struct_member_pointer(dot_expression.get());
+        auto dot_expression = dynamic_cast<DotExpression*>(operand);
+        right = access_struct_member_pointer(dot_expression);
     }
     else {
         right = operand->accept(this);
     }
 
-    if (right.type() == typeid(llvm::LoadInst*)) {
-        auto current_value = std::any_cast<llvm::LoadInst*>(right);
-        auto new_value =
-            create_llvm_integers_bianry(TokenKind::TOKEN_MINUS, current_value, constants_one);
-        Builder.CreateStore(new_value, current_value->getPointerOperand());
-        return is_prefix ? new_value : current_value;
-    }
-
-    if (right.type() == typeid(llvm::AllocaInst*)) {
-        auto alloca = std::any_cast<llvm::AllocaInst*>(right);
+    if (auto alloca = llvm::dyn_cast<llvm::AllocaInst>(right)) {
         auto current_value = Builder.CreateLoad(alloca->getAllocatedType(), alloca);
         auto new_value =
             create_llvm_integers_bianry(TokenKind::TOKEN_MINUS, current_value, constants_one);
@@ -2858,8 +2874,7 @@ auto amun::LLVMBackend::create_llvm_value_decrement(Shared<Expression> operand,
         return is_prefix ? new_value : current_value;
     }
 
-    if (right.type() == typeid(llvm::GlobalVariable*)) {
-        auto global_variable = std::any_cast<llvm::GlobalVariable*>(right);
+    if (auto global_variable = llvm::dyn_cast<llvm::GlobalVariable>(right)) {
         auto current_value = Builder.CreateLoad(global_variable->getValueType(), global_variable);
         auto new_value =
             create_llvm_integers_bianry(TokenKind::TOKEN_MINUS, current_value, constants_one);
@@ -2867,17 +2882,22 @@ auto amun::LLVMBackend::create_llvm_value_decrement(Shared<Expression> operand,
         return is_prefix ? new_value : current_value;
     }
 
-    if (right.type() == typeid(llvm::Value*)) {
-        auto current_value_ptr = std::any_cast<llvm::Value*>(right);
-        auto number_llvm_type = llvm_type_from_amun_type(number_type);
-        auto current_value = Builder.CreateLoad(number_llvm_type, current_value_ptr);
+    auto number_llvm_type = llvm_type_from_amun_type(number_type);
+
+    // Index and dot expressions resolve the element value, so update the element pointer
+    auto* element_value = llvm::dyn_cast<llvm::LoadInst>(right);
+    if (element_value != nullptr && element_value->getType() == number_llvm_type) {
         auto new_value =
-            create_llvm_integers_bianry(TokenKind::TOKEN_MINUS, current_value, constants_one);
-        Builder.CreateStore(new_value, current_value_ptr);
-        return is_prefix ? new_value : current_value;
+            create_llvm_integers_bianry(TokenKind::TOKEN_MINUS, element_value, constants_one);
+        Builder.CreateStore(new_value, element_value->getPointerOperand());
+        return is_prefix ? new_value : element_value;
     }
 
-    internal_compiler_error("Unary expression with non global or alloca type");
+    auto current_value = Builder.CreateLoad(number_llvm_type, right);
+    auto new_value =
+        create_llvm_integers_bianry(TokenKind::TOKEN_MINUS, current_value, constants_one);
+    Builder.CreateStore(new_value, right);
+    return is_prefix ? new_value : current_value;
 }
 
 auto amun::LLVMBackend::create_llvm_string_length(llvm::Value* string) -> llvm::Value*
@@ -2893,7 +2913,7 @@ auto amun::LLVMBackend::create_llvm_string_length(llvm::Value* string) -> llvm::
 }
 
 auto amun::LLVMBackend::create_llvm_struct_type(std::string name,
-                                                std::vector<Shared<amun::Type>> members,
+                                                std::vector<amun::Type*> members,
                                                 bool is_packed, bool is_extern) -> llvm::StructType*
 {
     if (structures_types_map.contains(name)) {
@@ -2920,10 +2940,10 @@ auto amun::LLVMBackend::create_llvm_struct_type(std::string name,
 
         // Resolve if tuple field is a self reference pointer to the current class
         if (field->type_kind == TypeKind::POINTER) {
-            auto pointer_type = std::static_pointer_cast<amun::PointerType>(field);
+            auto pointer_type = static_cast<amun::PointerType*>(field);
             auto base = pointer_type->base_type;
             if (base->type_kind == TypeKind::STRUCT) {
-                auto struct_type = std::static_pointer_cast<amun::StructType>(base);
+                auto struct_type = static_cast<amun::StructType*>(base);
                 if (current_struct_type && current_struct_type->getName() == struct_type->name) {
                     struct_fields.push_back(current_struct_type->getPointerTo());
                     continue;
@@ -2940,6 +2960,116 @@ auto amun::LLVMBackend::create_llvm_struct_type(std::string name,
     return struct_llvm_type;
 }
 
+auto amun::LLVMBackend::create_llvm_switch_statement(
+    SwitchStatement* node, std::vector<std::vector<llvm::ConstantInt*>>& cases_values) -> void
+{
+    auto* current_function = Builder.GetInsertBlock()->getParent();
+    auto* argument = llvm_resolve_value(node->argument->accept(this));
+
+    auto cases_count = cases_values.size();
+    auto* end_block = llvm::BasicBlock::Create(llvm_context, "switch.end");
+
+    // If there is no default case, jump to the end block if no case match the argument
+    auto* default_block = end_block;
+    if (node->has_default_case) {
+        default_block = llvm::BasicBlock::Create(llvm_context, "switch.default");
+    }
+
+    auto* switch_inst = Builder.CreateSwitch(argument, default_block, cases_count);
+
+    std::vector<llvm::BasicBlock*> cases_blocks;
+    std::unordered_set<llvm::ConstantInt*> visited_values;
+    for (size_t i = 0; i < cases_count; i++) {
+        auto* case_block = llvm::BasicBlock::Create(llvm_context, "switch.case");
+        cases_blocks.push_back(case_block);
+
+        // Duplicated values are matched by the first case only
+        for (auto* case_value : cases_values[i]) {
+            if (visited_values.insert(case_value).second) {
+                switch_inst->addCase(case_value, case_block);
+            }
+        }
+    }
+
+    if (node->has_default_case) {
+        cases_blocks.push_back(default_block);
+    }
+
+    for (size_t i = 0; i < cases_blocks.size(); i++) {
+        current_function->getBasicBlockList().push_back(cases_blocks[i]);
+        Builder.SetInsertPoint(cases_blocks[i]);
+
+        push_alloca_inst_scope();
+        node->cases[i]->body->accept(this);
+        pop_alloca_inst_scope();
+
+        // If there are not return, break or continue statement, must branch end block
+        if (not has_break_or_continue_statement && not has_return_statement) {
+            Builder.CreateBr(end_block);
+        }
+
+        has_return_statement = false;
+        has_break_or_continue_statement = false;
+    }
+
+    current_function->getBasicBlockList().push_back(end_block);
+    Builder.SetInsertPoint(end_block);
+}
+
+auto amun::LLVMBackend::create_llvm_switch_expression(SwitchExpression* node,
+                                                      std::vector<llvm::ConstantInt*>& cases_values)
+    -> llvm::Value*
+{
+    auto* function = Builder.GetInsertBlock()->getParent();
+    auto* argument = llvm_resolve_value(node->argument->accept(this));
+    auto* value_type = llvm_type_from_amun_type(node->get_type_node());
+
+    auto cases_count = cases_values.size();
+    std::vector<llvm::BasicBlock*> cases_blocks;
+    for (size_t i = 0; i < cases_count; i++) {
+        cases_blocks.push_back(llvm::BasicBlock::Create(llvm_context, "switch.case"));
+    }
+
+    // Switch expression without else branch must be complete, so the last case is the default
+    std::vector<Expression*> values = node->switch_cases_values;
+    auto* default_block = cases_blocks.back();
+    if (node->default_value) {
+        default_block = llvm::BasicBlock::Create(llvm_context, "switch.default");
+        cases_blocks.push_back(default_block);
+        values.push_back(node->default_value);
+    }
+
+    auto* switch_inst = Builder.CreateSwitch(argument, default_block, cases_count);
+
+    // Duplicated values are matched by the first case only
+    std::unordered_set<llvm::ConstantInt*> visited_values;
+    for (size_t i = 0; i < cases_count; i++) {
+        if (visited_values.insert(cases_values[i]).second) {
+            switch_inst->addCase(cases_values[i], cases_blocks[i]);
+        }
+    }
+
+    // Each case value is resolved in it own block then jump to the merge block
+    auto* merge_block = llvm::BasicBlock::Create(llvm_context, "switch.merge");
+    std::vector<std::pair<llvm::Value*, llvm::BasicBlock*>> incoming_values;
+    for (size_t i = 0; i < cases_blocks.size(); i++) {
+        function->getBasicBlockList().push_back(cases_blocks[i]);
+        Builder.SetInsertPoint(cases_blocks[i]);
+        auto* value = llvm_resolve_value(values[i]->accept(this));
+        incoming_values.emplace_back(value, Builder.GetInsertBlock());
+        Builder.CreateBr(merge_block);
+    }
+
+    function->getBasicBlockList().push_back(merge_block);
+    Builder.SetInsertPoint(merge_block);
+
+    auto* phi_node = Builder.CreatePHI(value_type, incoming_values.size());
+    for (const auto& [value, block] : incoming_values) {
+        phi_node->addIncoming(value, block);
+    }
+    return phi_node;
+}
+
 auto amun::LLVMBackend::create_overloading_function_call(std::string& name,
                                                          std::vector<llvm::Value*> args)
     -> llvm::Value*
@@ -2957,13 +3087,13 @@ auto amun::LLVMBackend::access_struct_member_pointer(llvm::Value* callee_value,
     // Access struct member allocaed on the stack or derefernecs from pointer
     // struct.member or (*struct).member
     if (callee_llvm_type->isStructTy()) {
-        // Access struct member coming from pattern matching if or switch expression
-        if (auto* phi_node = llvm::dyn_cast<llvm::PHINode>(callee_value)) {
+        // Access struct member address of struct value for example pattern matching if or
+        // switch expression or struct initializer
+        if (is_aggregate_value(callee_value)) {
             // Struct type used it to access member from it
             auto struct_type = callee_value->getType();
-            assert(struct_type->isStructTy());
-            // Store result from pattern matching Phi node in alloca
-            auto alloca = Builder.CreateAlloca(struct_type);
+            // Store struct value in alloca
+            auto alloca = create_temporary_alloca(struct_type);
             Builder.CreateStore(callee_value, alloca);
             // Access stuct field from alloca inst
             return Builder.CreateGEP(struct_type, alloca, {zero_int32_value, index});
@@ -3003,7 +3133,7 @@ auto amun::LLVMBackend::access_struct_member_pointer(llvm::Value* callee_value,
         auto struct_type = callee_value->getType();
         assert(struct_type->isStructTy());
         // Create alloca inst to save return value from function call
-        auto alloca = Builder.CreateAlloca(struct_type);
+        auto alloca = create_temporary_alloca(struct_type);
         Builder.CreateStore(callee_value, alloca);
         return Builder.CreateGEP(struct_type, alloca, {zero_int32_value, index});
     }
@@ -3012,24 +3142,23 @@ auto amun::LLVMBackend::access_struct_member_pointer(llvm::Value* callee_value,
 auto amun::LLVMBackend::access_struct_member_pointer(Expression* callee, int field_index)
     -> llvm::Value*
 {
-    auto callee_value = llvm_node_value(callee->accept(this));
+    auto callee_value = callee->accept(this);
     auto callee_type = llvm_type_from_amun_type(callee->get_type_node());
     return access_struct_member_pointer(callee_value, callee_type, field_index);
 }
 
 auto amun::LLVMBackend::access_struct_member_pointer(DotExpression* expression) -> llvm::Value*
 {
-    auto callee = expression->callee;
-    return access_struct_member_pointer(expression->callee.get(), expression->field_index);
+    return access_struct_member_pointer(expression->callee, expression->field_index);
 }
 
-auto amun::LLVMBackend::access_array_element(Shared<Expression> node_value, llvm::Value* index)
+auto amun::LLVMBackend::access_array_element(Expression* node_value, llvm::Value* index)
     -> llvm::Value*
 {
     auto values = node_value->get_type_node();
 
     if (values->type_kind == amun::TypeKind::POINTER) {
-        auto pointer_type = std::static_pointer_cast<amun::PointerType>(values);
+        auto pointer_type = static_cast<amun::PointerType*>(values);
         auto element_type = llvm_type_from_amun_type(pointer_type->base_type);
         auto value = llvm_resolve_value(node_value->accept(this));
         auto ptr = Builder.CreateGEP(element_type, value, index);
@@ -3037,11 +3166,10 @@ auto amun::LLVMBackend::access_array_element(Shared<Expression> node_value, llvm
     }
 
     // One dimension Array Index Expression
-    if (auto array_literal = std::dynamic_pointer_cast<LiteralExpression>(node_value)) {
+    if (auto array_literal = dynamic_cast<LiteralExpression*>(node_value)) {
         auto array = array_literal->accept(this);
 
-        if (array.type() == typeid(llvm::AllocaInst*)) {
-            auto alloca = llvm::dyn_cast<llvm::AllocaInst>(llvm_node_value(array));
+        if (auto alloca = llvm::dyn_cast<llvm::AllocaInst>(array)) {
             auto alloca_type = alloca->getAllocatedType();
             auto ptr = Builder.CreateGEP(alloca_type, alloca, {zero_int32_value, index});
             llvm::Type* element_type;
@@ -3061,10 +3189,7 @@ auto amun::LLVMBackend::access_array_element(Shared<Expression> node_value, llvm
             return derefernecs_llvm_pointer(ptr);
         }
 
-        if (array.type() == typeid(llvm::GlobalVariable*)) {
-            auto global_variable_array =
-                llvm::dyn_cast<llvm::GlobalVariable>(llvm_node_value(array));
-
+        if (auto global_variable_array = llvm::dyn_cast<llvm::GlobalVariable>(array)) {
             auto local_insert_block = Builder.GetInsertBlock();
 
             // Its local
@@ -3098,8 +3223,8 @@ auto amun::LLVMBackend::access_array_element(Shared<Expression> node_value, llvm
     }
 
     // Multidimensional Array Index Expression
-    if (auto index_expression = std::dynamic_pointer_cast<IndexExpression>(node_value)) {
-        auto array = llvm_node_value(node_value->accept(this));
+    if (node_value->get_ast_node_type() == AstNodeType::AST_INDEX) {
+        auto array = node_value->accept(this);
         if (auto load_inst = dyn_cast<llvm::LoadInst>(array)) {
             auto ptr = Builder.CreateGEP(array->getType(), load_inst->getPointerOperand(),
                                          {zero_int32_value, index});
@@ -3113,8 +3238,8 @@ auto amun::LLVMBackend::access_array_element(Shared<Expression> node_value, llvm
     }
 
     // Index expression from array expression for example [1, 2, 3][0]
-    if (auto array_expession = std::dynamic_pointer_cast<ArrayExpression>(node_value)) {
-        auto array = llvm_node_value(array_expession->accept(this));
+    if (auto array_expession = dynamic_cast<ArrayExpression*>(node_value)) {
+        auto array = array_expession->accept(this);
         if (auto load_inst = dyn_cast<llvm::LoadInst>(array)) {
             auto ptr = Builder.CreateGEP(array->getType(), load_inst->getPointerOperand(),
                                          {zero_int32_value, index});
@@ -3128,10 +3253,10 @@ auto amun::LLVMBackend::access_array_element(Shared<Expression> node_value, llvm
     }
 
     // Index expression from struct field array for example node.children[i]
-    if (auto dot_expression = std::dynamic_pointer_cast<DotExpression>(node_value)) {
+    if (auto dot_expression = dynamic_cast<DotExpression*>(node_value)) {
         auto struct_field = dot_expression->accept(this);
-        if (auto load_inst = std::any_cast<llvm::LoadInst*>(struct_field)) {
-            auto ptr = Builder.CreateGEP(llvm_node_value(struct_field)->getType(),
+        if (auto load_inst = llvm::dyn_cast<llvm::LoadInst>(struct_field)) {
+            auto ptr = Builder.CreateGEP(struct_field->getType(),
                                          load_inst->getPointerOperand(), {zero_int32_value, index});
             return derefernecs_llvm_pointer(ptr);
         }
@@ -3140,7 +3265,7 @@ auto amun::LLVMBackend::access_array_element(Shared<Expression> node_value, llvm
     internal_compiler_error("Invalid Index expression");
 }
 
-auto amun::LLVMBackend::resolve_constant_expression(Shared<Expression> value) -> llvm::Constant*
+auto amun::LLVMBackend::resolve_constant_expression(Expression* value) -> llvm::Constant*
 {
     auto field_type = value->get_type_node();
 
@@ -3151,13 +3276,13 @@ auto amun::LLVMBackend::resolve_constant_expression(Shared<Expression> value) ->
 
     // If right value is index expression resolve it and return constant value
     if (value->get_ast_node_type() == AstNodeType::AST_INDEX) {
-        auto index_expression = std::dynamic_pointer_cast<IndexExpression>(value);
+        auto index_expression = dynamic_cast<IndexExpression*>(value);
         return resolve_constant_index_expression(index_expression);
     }
 
     // If right value is if expression, resolve it to constant value
     if (value->get_ast_node_type() == AstNodeType::AST_IF_EXPRESSION) {
-        auto if_expression = std::dynamic_pointer_cast<IfExpression>(value);
+        auto if_expression = dynamic_cast<IfExpression*>(value);
         return resolve_constant_if_expression(if_expression);
     }
 
@@ -3166,12 +3291,12 @@ auto amun::LLVMBackend::resolve_constant_expression(Shared<Expression> value) ->
     return llvm::dyn_cast<llvm::Constant>(llvm_value);
 }
 
-auto amun::LLVMBackend::resolve_constant_index_expression(Shared<IndexExpression> expression)
+auto amun::LLVMBackend::resolve_constant_index_expression(IndexExpression* expression)
     -> llvm::Constant*
 {
-    auto llvm_array = llvm_node_value(expression->value->accept(this));
+    auto llvm_array = expression->value->accept(this);
     auto index_value = expression->index->accept(this);
-    auto constants_index = llvm::dyn_cast<llvm::ConstantInt>(llvm_node_value(index_value));
+    auto constants_index = llvm::dyn_cast<llvm::ConstantInt>(index_value);
 
     if (auto global_variable_array = llvm::dyn_cast<llvm::GlobalVariable>(llvm_array)) {
         auto initalizer = global_variable_array->getInitializer();
@@ -3206,8 +3331,7 @@ auto amun::LLVMBackend::resolve_constant_index_expression(Shared<IndexExpression
     internal_compiler_error("Invalid type in resolve_global_index_expression");
 }
 
-auto amun::LLVMBackend::resolve_constant_if_expression(Shared<IfExpression> expression)
-    -> llvm::Constant*
+auto amun::LLVMBackend::resolve_constant_if_expression(IfExpression* expression) -> llvm::Constant*
 {
     auto count = expression->tokens.size();
     for (size_t i = 0; i < count; i++) {
@@ -3221,7 +3345,7 @@ auto amun::LLVMBackend::resolve_constant_if_expression(Shared<IfExpression> expr
     return nullptr;
 }
 
-auto amun::LLVMBackend::resolve_constant_switch_expression(Shared<SwitchExpression> expression)
+auto amun::LLVMBackend::resolve_constant_switch_expression(SwitchExpression* expression)
     -> llvm::Constant*
 {
     auto op = expression->op;
@@ -3268,6 +3392,33 @@ auto amun::LLVMBackend::resolve_constant_switch_expression(Shared<SwitchExpressi
     return llvm::dyn_cast<llvm::Constant>(default_value);
 }
 
+auto amun::LLVMBackend::resolve_switch_integer_cases(Expression* argument,
+                                                    std::vector<Expression*>& cases,
+                                                    std::vector<llvm::ConstantInt*>& cases_values)
+    -> bool
+{
+    auto argument_type = argument->get_type_node();
+    if (!amun::is_integer_type(argument_type) && !amun::is_enum_element_type(argument_type)) {
+        return false;
+    }
+
+    for (const auto& switch_case : cases) {
+        if (!switch_case->is_constant()) {
+            return false;
+        }
+
+        auto* case_value = llvm_resolve_value(switch_case->accept(this));
+        auto* constant_case = llvm::dyn_cast<llvm::ConstantInt>(case_value);
+        if (constant_case == nullptr) {
+            return false;
+        }
+
+        cases_values.push_back(constant_case);
+    }
+
+    return true;
+}
+
 auto amun::LLVMBackend::resolve_constant_string_expression(const std::string& literal)
     -> llvm::Constant*
 {
@@ -3301,16 +3452,38 @@ auto amun::LLVMBackend::resolve_constant_string_expression(const std::string& li
     return string;
 }
 
-auto amun::LLVMBackend::resolve_generic_struct(Shared<amun::GenericStructType> generic)
+auto amun::LLVMBackend::resolve_generic_struct(amun::GenericStructType* generic)
     -> llvm::StructType*
 {
     const auto struct_type = generic->struct_type;
     const auto struct_name = struct_type->name;
-    const auto mangled_name = struct_name + mangle_types(generic->parameters);
+
+    // Resolve parameters that are generic parameters of the current function or structure
+    std::vector<amun::Type*> parameters;
+    parameters.reserve(generic->parameters.size());
+    for (const auto& parameter : generic->parameters) {
+        if (parameter->type_kind == amun::TypeKind::GENERIC_PARAMETER) {
+            auto generic_type = static_cast<amun::GenericParameterType*>(parameter);
+            if (generic_types.contains(generic_type->name)) {
+                parameters.push_back(generic_types[generic_type->name]);
+                continue;
+            }
+        }
+        parameters.push_back(parameter);
+    }
+
+    const auto mangled_name = struct_name + mangle_types(parameters);
     if (structures_types_map.contains(mangled_name)) {
         return llvm::dyn_cast<llvm::StructType>(structures_types_map[mangled_name]);
     }
 
+    // Bind the structure generic parameters while resolving the types of its fields
+    auto outer_generic_types = generic_types;
+    const auto parameters_count = parameters.size();
+    for (size_t i = 0; i < parameters_count; i++) {
+        generic_types[struct_type->generic_parameters[i]] = parameters[i];
+    }
+
     auto* struct_llvm_type = llvm::StructType::create(llvm_context);
     struct_llvm_type->setName(mangled_name);
 
@@ -3322,9 +3495,9 @@ auto amun::LLVMBackend::resolve_generic_struct(Shared<amun::GenericStructType> g
 
         // Handle case where field type is pointer to the current struct
         if (field->type_kind == amun::TypeKind::POINTER) {
-            auto pointer = std::static_pointer_cast<amun::PointerType>(field);
+            auto pointer = static_cast<amun::PointerType*>(field);
             if (pointer->base_type->type_kind == amun::TypeKind::STRUCT) {
-                auto struct_ty = std::static_pointer_cast<amun::StructType>(pointer->base_type);
+                auto struct_ty = static_cast<amun::StructType*>(pointer->base_type);
                 if (struct_ty->name == struct_name) {
                     struct_fields.push_back(struct_llvm_type->getPointerTo());
                     continue;
@@ -3334,11 +3507,11 @@ auto amun::LLVMBackend::resolve_generic_struct(Shared<amun::GenericStructType> g
 
         // Handle case where field type is array of pointers to the current struct
         if (field->type_kind == amun::TypeKind::STATIC_ARRAY) {
-            auto array = std::static_pointer_cast<amun::StaticArrayType>(field);
+            auto array = static_cast<amun::StaticArrayType*>(field);
             if (array->element_type->type_kind == amun::TypeKind::POINTER) {
-                auto pointer = std::static_pointer_cast<amun::PointerType>(array->element_type);
+                auto pointer = static_cast<amun::PointerType*>(array->element_type);
                 if (pointer->base_type->type_kind == amun::TypeKind::STRUCT) {
-                    auto struct_ty = std::static_pointer_cast<amun::StructType>(pointer->base_type);
+                    auto struct_ty = static_cast<amun::StructType*>(pointer->base_type);
                     if (struct_ty->name == struct_name) {
                         auto struct_ptr_ty = struct_llvm_type->getPointerTo();
                         auto array_type = create_llvm_array_type(struct_ptr_ty, array->size);
@@ -3350,15 +3523,17 @@ auto amun::LLVMBackend::resolve_generic_struct(Shared<amun::GenericStructType> g
         }
 
         if (field->type_kind == amun::TypeKind::GENERIC_PARAMETER) {
-            auto generic_type = std::static_pointer_cast<amun::GenericParameterType>(field);
+            auto generic_type = static_cast<amun::GenericParameterType*>(field);
             auto position = index_of(struct_type->generic_parameters, generic_type->name);
-            struct_fields.push_back(llvm_type_from_amun_type(generic->parameters[position]));
+            struct_fields.push_back(llvm_type_from_amun_type(parameters[position]));
             continue;
         }
 
         struct_fields.push_back(llvm_type_from_amun_type(field));
     }
 
+    generic_types = outer_generic_types;
+
     struct_llvm_type->setBody(struct_fields, struct_type->is_packed);
     structures_types_map[mangled_name] = struct_llvm_type;
     return struct_llvm_type;
@@ -3372,6 +3547,73 @@ inline auto amun::LLVMBackend::create_entry_block_alloca(llvm::Function* functio
     return builder_object.CreateAlloca(type, nullptr, var_name);
 }
 
+auto amun::LLVMBackend::is_aggregate_value(llvm::Value* value) -> bool
+{
+    // Loaded structs are accessed from the address they are loaded from
+    return value->getType()->isStructTy() && !llvm::isa<llvm::LoadInst>(value);
+}
+
+auto amun::LLVMBackend::create_temporary_alloca(llvm::Type* type) -> llvm::AllocaInst*
+{
+    // Global values are constants so temporaries are created only inside functions
+    return stack_slots_stack.top().allocate_temporary(Builder, type);
+}
+
+auto amun::LLVMBackend::set_loop_hints_metadata(const LoopHints& hints,
+                                                llvm::BasicBlock* header,
+                                                llvm::BasicBlock* preheader) -> void
+{
+    if (!hints.has_hints()) {
+        return;
+    }
+
+    auto hint = [&](llvm::StringRef name) -> llvm::Metadata* {
+        return llvm::MDNode::get(llvm_context, llvm::MDString::get(llvm_context, name));
+    };
+
+    auto hint_value = [&](llvm::StringRef name, llvm::Constant* value) -> llvm::Metadata* {
+        llvm::Metadata* operands[] = {llvm::MDString::get(llvm_context, name),
+                                      llvm::ConstantAsMetadata::get(value)};
+        return llvm::MDNode::get(llvm_context, operands);
+    };
+
+    // First operand is a self reference so the loop id is unique for every loop
+    auto temp_node = llvm::MDNode::getTemporary(llvm_context, llvm::None);
+    llvm::SmallVector<llvm::Metadata*, 4> operands = {temp_node.get()};
+
+    if (hints.unroll_full) {
+        operands.push_back(hint("llvm.loop.unroll.full"));
+    }
+    else if (hints.unroll_count != 0) {
+        operands.push_back(hint_value("llvm.loop.unroll.count",
+                                      Builder.getInt32(hints.unroll_count)));
+    }
+
+    if (hints.no_vectorize) {
+        operands.push_back(hint_value("llvm.loop.vectorize.width", Builder.getInt32(1)));
+    }
+    else if (hints.vectorize_width != 0) {
+        operands.push_back(hint_value("llvm.loop.vectorize.enable", Builder.getTrue()));
+        operands.push_back(hint_value("llvm.loop.vectorize.width",
+                                      Builder.getInt32(hints.vectorize_width)));
+    }
+
+    if (hints.interleave_count != 0) {
+        operands.push_back(hint_value("llvm.loop.interleave.count",
+                                      Builder.getInt32(hints.interleave_count)));
+    }
+
+    auto loop_id = llvm::MDNode::getDistinct(llvm_context, operands);
+    loop_id->replaceOperandWith(0, loop_id);
+
+    // The loop latches are all header predecessors except the preheader, for example continue
+    for (auto* predecessor : llvm::predecessors(header)) {
+        if (predecessor != preheader) {
+            predecessor->getTerminator()->setMetadata(llvm::LLVMContext::MD_loop, loop_id);
+        }
+    }
+}
+
 auto amun::LLVMBackend::lookup_function(std::string& name) -> llvm::Function*
 {
     if (auto* function = llvm_module->getFunction(name)) {
@@ -3380,7 +3622,7 @@ auto amun::LLVMBackend::lookup_function(std::string& name) -> llvm::Function*
 
     auto function_prototype = functions_table.find(name);
     if (function_prototype != functions_table.end()) {
-        return std::any_cast<llvm::Function*>(function_prototype->second->accept(this));
+        return llvm::cast<llvm::Function>(function_prototype->second->accept(this));
     }
 
     return llvm_functions[name];
@@ -3440,4 +3682,56 @@ inline auto amun::LLVMBackend::internal_compiler_error(const char* message) -> v
 {
     amun::loge << "Internal Compiler Error: " << message << '\n';
     exit(EXIT_FAILURE);
+}
+
+auto amun::LLVMBackend::create_llvm_int1(bool value) -> llvm::ConstantInt*
+{
+    return llvm::ConstantInt::get(llvm_int1_type, value);
+}
+
+auto amun::LLVMBackend::create_llvm_int8(int32 value, bool singed) -> llvm::ConstantInt*
+{
+    return llvm::ConstantInt::get(llvm_int8_type, value, singed);
+}
+
+auto amun::LLVMBackend::create_llvm_int16(int32 value, bool singed) -> llvm::ConstantInt*
+{
+    return llvm::ConstantInt::get(llvm_int16_type, value, singed);
+}
+
+auto amun::LLVMBackend::create_llvm_int32(int32 value, bool singed) -> llvm::ConstantInt*
+{
+    return llvm::ConstantInt::get(llvm_int32_type, value, singed);
+}
+
+auto amun::LLVMBackend::create_llvm_int64(int64 value, bool singed) -> llvm::ConstantInt*
+{
+    return llvm::ConstantInt::get(llvm_int64_type, value, singed);
+}
+
+auto amun::LLVMBackend::create_llvm_float32(float32 value) -> llvm::Constant*
+{
+    return llvm::ConstantFP::get(llvm_float32_type, value);
+}
+
+auto amun::LLVMBackend::create_llvm_float64(float64 value, bool singed) -> llvm::Constant*
+{
+    return llvm::ConstantFP::get(llvm_float64_type, value);
+}
+
+auto amun::LLVMBackend::create_llvm_null(llvm::Type* type) -> llvm::Constant*
+{
+    return llvm::Constant::getNullValue(type);
+}
+
+auto amun::LLVMBackend::create_llvm_array_type(llvm::Type* element, uint64 size) -> llvm::ArrayType*
+{
+    return llvm::ArrayType::get(element, size);
+}
+
+auto amun::LLVMBackend::derefernecs_llvm_pointer(llvm::Value* pointer) -> llvm::Value*
+{
+    assert(pointer->getType()->isPointerTy());
+    auto pointer_element_type = pointer->getType()->getPointerElementType();
+    return Builder.CreateLoad(pointer_element_type, pointer);
 }
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "../include/amun_llvm_optimizer.hpp"
+
+#include <llvm/Analysis/CGSCCPassManager.h>
+#include <llvm/Analysis/LoopAnalysisManager.h>
+#include <llvm/IR/PassManager.h>
+#include <llvm/Passes/OptimizationLevel.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Passes/StandardInstrumentations.h>
+
+auto amun::optimize_llvm_module(llvm::Module& module, llvm::TargetMachine* target_machine,
+                                OptimizationLevel level, OptimizationPipeline pipeline) -> void
+{
+    // No need to build the pipeline, the backend output is emitted as it is
+    if (level == OptimizationLevel::O0) {
+        return;
+    }
+
+    llvm::LoopAnalysisManager loop_analysis_manager;
+    llvm::FunctionAnalysisManager function_analysis_manager;
+    llvm::CGSCCAnalysisManager cgscc_analysis_manager;
+    llvm::ModuleAnalysisManager module_analysis_manager;
+
+    llvm::PipelineTuningOptions tuning_options;
+    tuning_options.LoopUnrolling = true;
+    tuning_options.LoopInterleaving = true;
+    tuning_options.LoopVectorization = level != OptimizationLevel::O1;
+    tuning_options.SLPVectorization = level != OptimizationLevel::O1;
+
+    // Standard instrumentations add each pass to the time trace if `-ftime-trace` is enabled
+    llvm::PassInstrumentationCallbacks instrumentation_callbacks;
+    llvm::StandardInstrumentations standard_instrumentations(false);
+    standard_instrumentations.registerCallbacks(instrumentation_callbacks);
+
+    llvm::PassBuilder pass_builder(target_machine, tuning_options, llvm::None,
+                                   &instrumentation_callbacks);
+
+    // Register all the analysis managers and cross register the proxies between them
+    pass_builder.registerModuleAnalyses(module_analysis_manager);
+    pass_builder.registerCGSCCAnalyses(cgscc_analysis_manager);
+    pass_builder.registerFunctionAnalyses(function_analysis_manager);
+    pass_builder.registerLoopAnalyses(loop_analysis_manager);
+    pass_builder.crossRegisterProxies(loop_analysis_manager, function_analysis_manager,
+                                      cgscc_analysis_manager, module_analysis_manager);
+
+    // Default pipeline contains mem2reg, SROA, inliner, GVN, loops optimizations and vectorizers
+    llvm::OptimizationLevel llvm_level;
+    switch (level) {
+    case OptimizationLevel::O1: llvm_level = llvm::OptimizationLevel::O1; break;
+    case OptimizationLevel::O2: llvm_level = llvm::OptimizationLevel::O2; break;
+    case OptimizationLevel::O3: llvm_level = llvm::OptimizationLevel::O3; break;
+    case OptimizationLevel::Os: llvm_level = llvm::OptimizationLevel::Os; break;
+    default: llvm_level = llvm::OptimizationLevel::O0; break;
+    }
+
+    llvm::ModulePassManager module_pass_manager;
+    switch (pipeline) {
+    case OptimizationPipeline::PER_MODULE:
+        module_pass_manager = pass_builder.buildPerModuleDefaultPipeline(llvm_level);
+        break;
+    case OptimizationPipeline::PRE_LINK:
+        module_pass_manager = pass_builder.buildLTOPreLinkDefaultPipeline(llvm_level);
+        break;
+    case OptimizationPipeline::LINK_TIME:
+        module_pass_manager = pass_builder.buildLTODefaultPipeline(llvm_level, nullptr);
+        break;
+    }
+
+    module_pass_manager.run(module, module_analysis_manager);
+}
+
+auto amun::llvm_codegen_optimization_level(OptimizationLevel level) -> llvm::CodeGenOpt::Level
+{
+    switch (level) {
+    // Code generator keeps its default level without optimizations as the compiler always did,
+    // it folds constant intrinsic calls such as llvm.cos that are not available without libm
+    case OptimizationLevel::O0: return llvm::CodeGenOpt::Default;
+    case OptimizationLevel::O1: return llvm::CodeGenOpt::Less;
+    case OptimizationLevel::O2: return llvm::CodeGenOpt::Default;
+    case OptimizationLevel::O3: return llvm::CodeGenOpt::Aggressive;
+    case OptimizationLevel::Os: return llvm::CodeGenOpt::Default;
+    }
+    return llvm::CodeGenOpt::Default;
+}
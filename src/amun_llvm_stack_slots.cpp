@@ -0,0 +1,61 @@
+#include "../include/amun_llvm_stack_slots.hpp"
+
+#include <algorithm>
+
+auto amun::StackSlots::allocate_temporary(llvm::IRBuilder<>& builder, llvm::Type* type)
+    -> llvm::AllocaInst*
+{
+    llvm::AllocaInst* slot;
+    auto& free_type_slots = free_slots[type];
+    if (!free_type_slots.empty()) {
+        slot = free_type_slots.back();
+        free_type_slots.pop_back();
+    }
+    else {
+        auto& entry_block = function->getEntryBlock();
+        llvm::IRBuilder<> entry_builder(&entry_block, entry_block.begin());
+        slot = entry_builder.CreateAlloca(type);
+    }
+
+    if (statements_temporaries.empty()) {
+        return slot;
+    }
+
+    const auto& data_layout = function->getParent()->getDataLayout();
+    auto size = data_layout.getTypeAllocSize(type).getFixedSize();
+    builder.CreateLifetimeStart(slot, builder.getInt64(size));
+    statements_temporaries.back().push_back(slot);
+    return slot;
+}
+
+auto amun::StackSlots::retain(llvm::Value* value) -> void
+{
+    // Slot is removed from the statement temporaries so its lifetime never ends
+    for (auto& temporaries : statements_temporaries) {
+        auto slot = std::find(temporaries.begin(), temporaries.end(), value);
+        if (slot != temporaries.end()) {
+            temporaries.erase(slot);
+            return;
+        }
+    }
+}
+
+auto amun::StackSlots::begin_statement() -> void { statements_temporaries.emplace_back(); }
+
+auto amun::StackSlots::end_statement(llvm::IRBuilder<>& builder) -> void
+{
+    // No need for lifetime end after return, break or continue because it's unreachable
+    auto* insert_block = builder.GetInsertBlock();
+    auto is_reachable = insert_block != nullptr && insert_block->getTerminator() == nullptr;
+
+    const auto& data_layout = function->getParent()->getDataLayout();
+    for (auto* slot : statements_temporaries.back()) {
+        if (is_reachable) {
+            auto size = data_layout.getTypeAllocSize(slot->getAllocatedType()).getFixedSize();
+            builder.CreateLifetimeEnd(slot, builder.getInt64(size));
+        }
+        free_slots[slot->getAllocatedType()].push_back(slot);
+    }
+
+    statements_temporaries.pop_back();
+}
@@ -0,0 +1,859 @@
+#include "../include/amun_module_reader.hpp"
+#include "../include/amun_primitives.hpp"
+
+#include <llvm/Support/xxhash.h>
+
+auto amun::ModuleReader::read_module_files(PrecompiledModule& module) -> bool
+{
+    if (decoder.read_unsigned() != MODULE_FORMAT_MAGIC ||
+        decoder.read_unsigned() != MODULE_FORMAT_VERSION ||
+        decoder.read_string() != AMUN_LANGUAGE_VERSION) {
+        return false;
+    }
+
+    auto payload_hash = decoder.read_unsigned();
+    auto payload = decoder.remaining_bytes();
+    if (decoder.has_failed() ||
+        llvm::xxHash64(llvm::StringRef(payload.data(), payload.size())) != payload_hash) {
+        return false;
+    }
+
+    module.environment_fingerprint = decoder.read_unsigned();
+
+    auto files_count = decoder.read_unsigned();
+    for (uint64 i = 0; i < files_count && !decoder.has_failed(); i++) {
+        auto path = std::string(decoder.read_string());
+        auto content_hash = decoder.read_unsigned();
+        module.files.push_back({path, content_hash, -1});
+    }
+
+    auto skipped_paths_count = decoder.read_unsigned();
+    for (uint64 i = 0; i < skipped_paths_count && !decoder.has_failed(); i++) {
+        module.skipped_paths.push_back(std::string(decoder.read_string()));
+    }
+
+    return !decoder.has_failed() && !module.files.empty();
+}
+
+auto amun::ModuleReader::read_module_declarations(PrecompiledModule& module,
+                                                  std::vector<int> files_ids) -> bool
+{
+    this->files_ids = std::move(files_ids);
+
+    auto types_entries_count = decoder.read_unsigned();
+    for (uint64 i = 0; i < types_entries_count && !decoder.has_failed(); i++) {
+        read_type_entry();
+    }
+
+    auto functions_count = decoder.read_unsigned();
+    for (uint64 i = 0; i < functions_count && !decoder.has_failed(); i++) {
+        auto name = std::string(decoder.read_string());
+        auto kind = decoder.read_unsigned();
+        if (kind > amun::FunctionKind::POSTFIX_FUNCTION) {
+            decoder.fail();
+        }
+        module.functions.emplace_back(name, static_cast<amun::FunctionKind>(kind));
+    }
+
+    auto aliases_count = decoder.read_unsigned();
+    for (uint64 i = 0; i < aliases_count && !decoder.has_failed(); i++) {
+        auto name = std::string(decoder.read_string());
+        module.aliases.emplace_back(name, read_type_index());
+    }
+
+    expressions.reserve(decoder.read_unsigned());
+    module.nodes = read_statements();
+    return !decoder.has_failed();
+}
+
+auto amun::ModuleReader::read_type_entry() -> void
+{
+    auto& type_context = context.type_context;
+    auto tag = static_cast<ModuleTypeTag>(decoder.read_unsigned());
+    switch (tag) {
+    case ModuleTypeTag::NUMBER: {
+        auto kind = decoder.read_unsigned();
+        if (kind > static_cast<uint64>(NumberKind::FLOAT_64)) {
+            decoder.fail();
+            return;
+        }
+        types.push_back(type_context.number_type(static_cast<NumberKind>(kind)));
+        return;
+    }
+    case ModuleTypeTag::POINTER: {
+        auto base_type = read_type_index();
+        if (base_type == nullptr) {
+            return;
+        }
+        types.push_back(type_context.pointer_type(base_type));
+        return;
+    }
+    case ModuleTypeTag::FUNCTION: {
+        auto parameters = read_types_indexes();
+        auto return_type = read_type();
+        auto has_varargs = decoder.read_bool();
+        auto varargs_type = read_type();
+        auto is_intrinsic = decoder.read_bool();
+        auto is_generic = decoder.read_bool();
+        auto generic_names = read_strings();
+        auto implicit_parameters_count = static_cast<int>(decoder.read_signed());
+        types.push_back(type_context.function_type(parameters, return_type, has_varargs,
+                                                   varargs_type, is_intrinsic, is_generic,
+                                                   generic_names, implicit_parameters_count));
+        return;
+    }
+    case ModuleTypeTag::STATIC_ARRAY: {
+        auto element_type = read_type_index();
+        auto size = decoder.read_unsigned();
+        if (element_type == nullptr) {
+            return;
+        }
+        types.push_back(type_context.static_array_type(element_type, size));
+        return;
+    }
+    case ModuleTypeTag::STATIC_VECTOR: {
+        auto array_type = read_type_index();
+        if (array_type == nullptr || !amun::is_array_type(array_type)) {
+            decoder.fail();
+            return;
+        }
+        auto static_array = static_cast<StaticArrayType*>(array_type);
+        types.push_back(type_context.static_vector_type(static_array));
+        return;
+    }
+    case ModuleTypeTag::STRUCT_DECLARATION: {
+        auto name = std::string(decoder.read_string());
+        auto generic_parameters = read_strings();
+        auto is_packed = decoder.read_bool();
+        auto is_generic = decoder.read_bool();
+        auto is_extern = decoder.read_bool();
+        types.push_back(type_context.create<StructType>(name, std::vector<std::string>{},
+                                                        std::vector<Type*>{}, generic_parameters,
+                                                        is_packed, is_generic, is_extern));
+        return;
+    }
+    case ModuleTypeTag::STRUCT_FIELDS: {
+        auto struct_type = read_type_index();
+        auto fields_names = read_strings();
+        auto fields_types = read_types_indexes();
+        auto generic_parameters_types = read_types_indexes();
+        if (struct_type == nullptr || !amun::is_struct_type(struct_type) ||
+            fields_names.size() != fields_types.size()) {
+            decoder.fail();
+            return;
+        }
+        auto declared_struct = static_cast<StructType*>(struct_type);
+        declared_struct->fields_names = std::move(fields_names);
+        declared_struct->fields_types = std::move(fields_types);
+        declared_struct->generic_parameters_types = std::move(generic_parameters_types);
+        return;
+    }
+    case ModuleTypeTag::STRUCT_REFERENCE: {
+        auto structure = context.structures.find(std::string(decoder.read_string()));
+        if (structure == context.structures.end()) {
+            decoder.fail();
+            return;
+        }
+        types.push_back(structure->second);
+        return;
+    }
+    case ModuleTypeTag::TUPLE: {
+        auto fields_types = read_types_indexes();
+        if (decoder.has_failed()) {
+            return;
+        }
+        types.push_back(type_context.tuple_type(fields_types));
+        return;
+    }
+    case ModuleTypeTag::ENUM_DECLARATION: {
+        auto name = read_token();
+        std::unordered_map<std::string, int> values;
+        auto values_count = decoder.read_unsigned();
+        for (uint64 i = 0; i < values_count && !decoder.has_failed(); i++) {
+            auto value_name = std::string(decoder.read_string());
+            values[value_name] = static_cast<int>(decoder.read_signed());
+        }
+        auto element_type = read_type_index();
+        if (element_type == nullptr) {
+            return;
+        }
+        types.push_back(type_context.create<EnumType>(name, values, element_type));
+        return;
+    }
+    case ModuleTypeTag::ENUM_REFERENCE: {
+        auto enumeration = context.enumerations.find(std::string(decoder.read_string()));
+        if (enumeration == context.enumerations.end()) {
+            decoder.fail();
+            return;
+        }
+        types.push_back(enumeration->second);
+        return;
+    }
+    case ModuleTypeTag::ENUM_ELEMENT: {
+        auto enum_name = std::string(decoder.read_string());
+        auto element_type = read_type_index();
+        if (element_type == nullptr) {
+            return;
+        }
+        types.push_back(type_context.enum_element_type(enum_name, element_type));
+        return;
+    }
+    case ModuleTypeTag::GENERIC_PARAMETER: {
+        auto name = std::string(decoder.read_string());
+        types.push_back(type_context.generic_parameter_type(name));
+        return;
+    }
+    case ModuleTypeTag::GENERIC_STRUCT: {
+        auto struct_type = read_type_index();
+        auto parameters = read_types_indexes();
+        if (struct_type == nullptr || !amun::is_struct_type(struct_type)) {
+            decoder.fail();
+            return;
+        }
+        auto generic_struct = static_cast<StructType*>(struct_type);
+        types.push_back(type_context.generic_struct_type(generic_struct, parameters));
+        return;
+    }
+    case ModuleTypeTag::NONE: {
+        types.push_back(amun::none_type);
+        return;
+    }
+    case ModuleTypeTag::VOID: {
+        types.push_back(amun::void_type);
+        return;
+    }
+    case ModuleTypeTag::NILL: {
+        types.push_back(amun::null_type);
+        return;
+    }
+    }
+    decoder.fail();
+}
+
+auto amun::ModuleReader::read_statement() -> Statement*
+{
+    auto tag = static_cast<ModuleNodeTag>(decoder.read_unsigned());
+    if (decoder.has_failed()) {
+        return nullptr;
+    }
+
+    switch (tag) {
+    case ModuleNodeTag::NONE: return nullptr;
+    case ModuleNodeTag::BLOCK: {
+        auto statements = read_statements();
+        return create_node<BlockStatement>(statements);
+    }
+    case ModuleNodeTag::FIELD_DECLARATION: {
+        auto name = read_token();
+        auto type = read_type();
+        auto value = read_expression();
+        auto is_global = decoder.read_bool();
+        auto has_explicit_type = decoder.read_bool();
+        if (decoder.has_failed() || type == nullptr) {
+            break;
+        }
+        auto node = create_node<FieldDeclaration>(name, type, value, is_global);
+        node->has_explicit_type = has_explicit_type;
+        return node;
+    }
+    case ModuleNodeTag::DESTRUCTURING_DECLARATION: {
+        auto names = read_tokens();
+        auto types = read_types();
+        auto value = read_expression();
+        auto equal_token = read_token();
+        auto is_global = decoder.read_bool();
+        return create_node<DestructuringDeclaraion>(names, types, value, equal_token, is_global);
+    }
+    case ModuleNodeTag::CONST_DECLARATION: {
+        auto name = read_token();
+        auto value = read_expression();
+        return create_node<ConstDeclaration>(name, value);
+    }
+    case ModuleNodeTag::FUNCTION_PROTOTYPE: {
+        auto name = read_token();
+        auto parameters = read_parameters();
+        auto return_type = read_type();
+        auto is_external = decoder.read_bool();
+        auto has_varargs = decoder.read_bool();
+        auto varargs_type = read_type();
+        auto is_generic = decoder.read_bool();
+        auto generic_parameters = read_strings();
+        return create_node<FunctionPrototype>(name, parameters, return_type, is_external,
+                                              has_varargs, varargs_type, is_generic,
+                                              generic_parameters);
+    }
+    case ModuleNodeTag::INTRINSIC_PROTOTYPE: {
+        auto name = read_token();
+        auto native_name = std::string(decoder.read_string());
+        auto parameters = read_parameters();
+        auto return_type = read_type();
+        auto varargs = decoder.read_bool();
+        auto varargs_type = read_type();
+        return create_node<IntrinsicPrototype>(name, native_name, parameters, return_type,
+                                               varargs, varargs_type);
+    }
+    case ModuleNodeTag::FUNCTION_DECLARATION: {
+        auto prototype = read_node_of<FunctionPrototype>();
+        auto body = read_statement();
+        if (prototype == nullptr) {
+            break;
+        }
+        return create_node<FunctionDeclaration>(prototype, body);
+    }
+    case ModuleNodeTag::OPERATOR_FUNCTION_DECLARATION: {
+        auto op = read_token();
+        auto function = read_node_of<FunctionDeclaration>();
+        if (function == nullptr) {
+            break;
+        }
+        return create_node<OperatorFunctionDeclaraion>(op, function);
+    }
+    case ModuleNodeTag::STRUCT_DECLARATION: {
+        auto struct_type = read_type();
+        if (struct_type == nullptr || !amun::is_struct_type(struct_type)) {
+            break;
+        }
+        return create_node<StructDeclaration>(static_cast<StructType*>(struct_type));
+    }
+    case ModuleNodeTag::ENUM_DECLARATION: {
+        auto name = read_token();
+        auto enum_type = read_type();
+        if (enum_type == nullptr || !amun::is_enum_type(enum_type)) {
+            break;
+        }
+        return create_node<EnumDeclaration>(name, static_cast<EnumType*>(enum_type));
+    }
+    case ModuleNodeTag::IF_STATEMENT: {
+        std::vector<ConditionalBlock*> conditional_blocks;
+        auto blocks_count = decoder.read_unsigned();
+        for (uint64 i = 0; i < blocks_count && !decoder.has_failed(); i++) {
+            auto position = read_token();
+            auto condition = read_expression();
+            auto body = read_statement();
+            conditional_blocks.push_back(create_node<ConditionalBlock>(position, condition, body));
+        }
+        auto has_else = decoder.read_bool();
+        return create_node<IfStatement>(conditional_blocks, has_else);
+    }
+    case ModuleNodeTag::FOR_RANGE: {
+        auto position = read_token();
+        auto element_name = std::string(decoder.read_string());
+        auto range_start = read_expression();
+        auto range_end = read_expression();
+        auto step = read_expression();
+        auto body = read_statement();
+        auto node = create_node<ForRangeStatement>(position, element_name, range_start,
+                                                   range_end, step, body);
+        read_loop_hints(node->hints);
+        return node;
+    }
+    case ModuleNodeTag::FOR_EACH: {
+        auto position = read_token();
+        auto element_name = std::string(decoder.read_string());
+        auto index_name = std::string(decoder.read_string());
+        auto collection = read_expression();
+        auto body = read_statement();
+        auto node = create_node<ForEachStatement>(position, element_name, index_name,
+                                                  collection, body);
+        read_loop_hints(node->hints);
+        return node;
+    }
+    case ModuleNodeTag::FOR_EVER: {
+        auto position = read_token();
+        auto body = read_statement();
+        auto node = create_node<ForeverStatement>(position, body);
+        read_loop_hints(node->hints);
+        return node;
+    }
+    case ModuleNodeTag::WHILE: {
+        auto keyword = read_token();
+        auto condition = read_expression();
+        auto body = read_statement();
+        auto node = create_node<WhileStatement>(keyword, condition, body);
+        read_loop_hints(node->hints);
+        return node;
+    }
+    case ModuleNodeTag::SWITCH_STATEMENT: {
+        auto keyword = read_token();
+        auto argument = read_expression();
+        std::vector<SwitchCase*> cases;
+        auto cases_count = decoder.read_unsigned();
+        for (uint64 i = 0; i < cases_count && !decoder.has_failed(); i++) {
+            auto position = read_token();
+            auto values = read_expressions();
+            auto body = read_statement();
+            cases.push_back(create_node<SwitchCase>(position, values, body));
+        }
+        auto op = static_cast<TokenKind>(decoder.read_unsigned());
+        auto has_default_case = decoder.read_bool();
+        auto should_perform_complete_check = decoder.read_bool();
+        auto node = create_node<SwitchStatement>(keyword, argument, cases, op, has_default_case);
+        node->should_perform_complete_check = should_perform_complete_check;
+        return node;
+    }
+    case ModuleNodeTag::RETURN: {
+        auto keyword = read_token();
+        auto value = read_expression();
+        auto has_value = decoder.read_bool();
+        return create_node<ReturnStatement>(keyword, value, has_value);
+    }
+    case ModuleNodeTag::DEFER: {
+        auto call = read_node_of<CallExpression>();
+        if (call == nullptr) {
+            break;
+        }
+        return create_node<DeferStatement>(call);
+    }
+    case ModuleNodeTag::BREAK: {
+        auto keyword = read_token();
+        auto has_times = decoder.read_bool();
+        auto times = static_cast<int>(decoder.read_signed());
+        return create_node<BreakStatement>(keyword, has_times, times);
+    }
+    case ModuleNodeTag::CONTINUE: {
+        auto keyword = read_token();
+        auto has_times = decoder.read_bool();
+        auto times = static_cast<int>(decoder.read_signed());
+        return create_node<ContinueStatement>(keyword, has_times, times);
+    }
+    case ModuleNodeTag::EXPRESSION_STATEMENT: {
+        auto expression = read_expression();
+        return create_node<ExpressionStatement>(expression);
+    }
+    default: break;
+    }
+
+    decoder.fail();
+    return nullptr;
+}
+
+auto amun::ModuleReader::read_statements() -> std::vector<Statement*>
+{
+    std::vector<Statement*> statements;
+    auto count = decoder.read_unsigned();
+    for (uint64 i = 0; i < count && !decoder.has_failed(); i++) {
+        statements.push_back(read_statement());
+    }
+    return statements;
+}
+
+auto amun::ModuleReader::read_expression() -> Expression*
+{
+    auto tag = static_cast<ModuleNodeTag>(decoder.read_unsigned());
+    if (decoder.has_failed()) {
+        return nullptr;
+    }
+
+    Expression* expression = nullptr;
+    switch (tag) {
+    case ModuleNodeTag::NONE: return nullptr;
+    case ModuleNodeTag::EXPRESSION_REFERENCE: {
+        auto index = decoder.read_unsigned();
+        if (index < expressions.size()) {
+            return expressions[index];
+        }
+        break;
+    }
+    case ModuleNodeTag::CONSTANT_REFERENCE: {
+        auto name = std::string(decoder.read_string());
+        if (context.constants_table_map.is_defined(name)) {
+            return context.constants_table_map.lookup(name);
+        }
+        break;
+    }
+    case ModuleNodeTag::IF_EXPRESSION: {
+        auto tokens = read_tokens();
+        auto conditions = read_expressions();
+        auto values = read_expressions();
+        auto type = read_type();
+        auto node = create_node<IfExpression>(tokens, conditions, values);
+        node->type = type;
+        expression = node;
+        break;
+    }
+    case ModuleNodeTag::SWITCH_EXPRESSION: {
+        auto keyword = read_token();
+        auto argument = read_expression();
+        auto switch_cases = read_expressions();
+        auto switch_cases_values = read_expressions();
+        auto default_value = read_expression();
+        auto op = static_cast<TokenKind>(decoder.read_unsigned());
+        auto type = read_type();
+        if (decoder.has_failed() || switch_cases_values.empty()) {
+            break;
+        }
+        auto node = create_node<SwitchExpression>(keyword, argument, switch_cases,
+                                                  switch_cases_values, default_value, op);
+        node->type = type;
+        expression = node;
+        break;
+    }
+    case ModuleNodeTag::TUPLE: {
+        auto position = read_token();
+        auto values = read_expressions();
+        auto type = read_type();
+        auto node = create_node<TupleExpression>(position, values);
+        node->type = type;
+        expression = node;
+        break;
+    }
+    case ModuleNodeTag::ASSIGN:
+    case ModuleNodeTag::BINARY:
+    case ModuleNodeTag::BITWISE:
+    case ModuleNodeTag::COMPARISON:
+    case ModuleNodeTag::LOGICAL: {
+        auto left = read_expression();
+        auto operator_token = read_token();
+        auto right = read_expression();
+        auto type = read_type();
+        if (decoder.has_failed() || right == nullptr) {
+            break;
+        }
+
+        if (tag == ModuleNodeTag::ASSIGN) {
+            expression = create_node<AssignExpression>(left, operator_token, right);
+        }
+        else if (tag == ModuleNodeTag::BINARY) {
+            expression = create_node<BinaryExpression>(left, operator_token, right);
+        }
+        else if (tag == ModuleNodeTag::BITWISE) {
+            expression = create_node<BitwiseExpression>(left, operator_token, right);
+        }
+        else if (tag == ModuleNodeTag::COMPARISON) {
+            expression = create_node<ComparisonExpression>(left, operator_token, right);
+        }
+        else {
+            expression = create_node<LogicalExpression>(left, operator_token, right);
+        }
+        expression->set_type_node(type);
+        break;
+    }
+    case ModuleNodeTag::PREFIX_UNARY:
+    case ModuleNodeTag::POSTFIX_UNARY: {
+        auto operator_token = read_token();
+        auto right = read_expression();
+        auto type = read_type();
+        if (decoder.has_failed() || right == nullptr) {
+            break;
+        }
+
+        if (tag == ModuleNodeTag::PREFIX_UNARY) {
+            expression = create_node<PrefixUnaryExpression>(operator_token, right);
+        }
+        else {
+            expression = create_node<PostfixUnaryExpression>(operator_token, right);
+        }
+        expression->set_type_node(type);
+        break;
+    }
+    case ModuleNodeTag::CALL: {
+        auto position = read_token();
+        auto callee = read_expression();
+        auto arguments = read_expressions();
+        auto generic_arguments = read_types();
+        auto type = read_type();
+        if (decoder.has_failed() || callee == nullptr) {
+            break;
+        }
+        auto node = create_node<CallExpression>(position, callee, arguments, generic_arguments);
+        node->type = type;
+        expression = node;
+        break;
+    }
+    case ModuleNodeTag::INITIALIZE: {
+        auto position = read_token();
+        auto type = read_type();
+        auto arguments = read_expressions();
+        expression = create_node<InitializeExpression>(position, type, arguments);
+        break;
+    }
+    case ModuleNodeTag::LAMBDA: {
+        auto position = read_token();
+        auto parameters = read_parameters();
+        auto return_type = read_type();
+        auto body = read_node_of<BlockStatement>();
+        auto lambda_type = read_type();
+        auto implict_parameters_names = read_strings();
+        auto implict_parameters_types = read_types();
+        auto node =
+            create_node<LambdaExpression>(position, parameters, return_type, body, lambda_type);
+        node->implict_parameters_names = std::move(implict_parameters_names);
+        node->implict_parameters_types = std::move(implict_parameters_types);
+        expression = node;
+        break;
+    }
+    case ModuleNodeTag::DOT: {
+        auto dot_token = read_token();
+        auto callee = read_expression();
+        auto field_name = read_token();
+        auto field_index = static_cast<int>(decoder.read_signed());
+        auto is_constants = decoder.read_bool();
+        auto type = read_type();
+        auto node = create_node<DotExpression>(dot_token, callee, field_name);
+        node->field_index = field_index;
+        node->is_constants_ = is_constants;
+        node->type = type;
+        expression = node;
+        break;
+    }
+    case ModuleNodeTag::CAST: {
+        auto position = read_token();
+        auto type = read_type();
+        auto value = read_expression();
+        expression = create_node<CastExpression>(position, type, value);
+        break;
+    }
+    case ModuleNodeTag::TYPE_SIZE: {
+        auto type = read_type();
+        expression = create_node<TypeSizeExpression>(type);
+        break;
+    }
+    case ModuleNodeTag::TYPE_ALIGN: {
+        auto type = read_type();
+        expression = create_node<TypeAlignExpression>(type);
+        break;
+    }
+    case ModuleNodeTag::VALUE_SIZE: {
+        auto value = read_expression();
+        expression = create_node<ValueSizeExpression>(value);
+        break;
+    }
+    case ModuleNodeTag::INDEX: {
+        auto position = read_token();
+        auto value = read_expression();
+        auto index = read_expression();
+        auto type = read_type();
+        auto node = create_node<IndexExpression>(position, value, index);
+        node->type = type;
+        expression = node;
+        break;
+    }
+    case ModuleNodeTag::ENUM_ACCESS: {
+        auto enum_name = read_token();
+        auto element_name = read_token();
+        auto index = static_cast<int>(decoder.read_signed());
+        auto element_type = read_type();
+        expression = create_node<EnumAccessExpression>(enum_name, element_name, index,
+                                                       element_type);
+        break;
+    }
+    case ModuleNodeTag::LITERAL: {
+        auto name = read_token();
+        auto type = read_type();
+        auto is_constants = decoder.read_bool();
+        auto node = create_node<LiteralExpression>(name);
+        node->type = type;
+        node->constants = is_constants;
+        expression = node;
+        break;
+    }
+    case ModuleNodeTag::NUMBER: {
+        auto value = read_token();
+        auto type = read_type();
+        expression = create_node<NumberExpression>(value, type);
+        break;
+    }
+    case ModuleNodeTag::STRING: {
+        auto value = read_token();
+        auto type = read_type();
+        auto node = create_node<StringExpression>(value);
+        node->type = type;
+        expression = node;
+        break;
+    }
+    case ModuleNodeTag::ARRAY: {
+        auto position = read_token();
+        auto values = read_expressions();
+        auto type = read_type();
+        auto is_constants_array = decoder.read_bool();
+        if (decoder.has_failed()) {
+            break;
+        }
+        auto node = create_node<ArrayExpression>(position, values, type);
+        node->is_constants_array = is_constants_array;
+        expression = node;
+        break;
+    }
+    case ModuleNodeTag::VECTOR: {
+        auto array = read_node_of<ArrayExpression>();
+        auto type = read_type();
+        expression = create_node<VectorExpression>(array, type);
+        break;
+    }
+    case ModuleNodeTag::CHARACTER: {
+        auto value = read_token();
+        auto type = read_type();
+        auto node = create_node<CharacterExpression>(value);
+        node->type = type;
+        expression = node;
+        break;
+    }
+    case ModuleNodeTag::BOOLEAN: {
+        auto value = read_token();
+        auto type = read_type();
+        auto node = create_node<BooleanExpression>(value);
+        node->type = type;
+        expression = node;
+        break;
+    }
+    case ModuleNodeTag::NULL_VALUE: {
+        auto value = read_token();
+        auto type = read_type();
+        auto null_base_type = read_type();
+        auto node = create_node<NullExpression>(value);
+        node->type = type;
+        node->null_base_type = null_base_type;
+        expression = node;
+        break;
+    }
+    case ModuleNodeTag::UNDEFINED: {
+        auto keyword = read_token();
+        auto base_type = read_type();
+        auto node = create_node<UndefinedExpression>(keyword);
+        node->base_type = base_type;
+        expression = node;
+        break;
+    }
+    case ModuleNodeTag::INFINITY_VALUE: {
+        auto type = read_type();
+        expression = create_node<InfinityExpression>(type);
+        break;
+    }
+    default: break;
+    }
+
+    if (expression == nullptr) {
+        decoder.fail();
+        return nullptr;
+    }
+
+    expressions.push_back(expression);
+    return expression;
+}
+
+auto amun::ModuleReader::read_expressions() -> std::vector<Expression*>
+{
+    std::vector<Expression*> expressions;
+    auto count = decoder.read_unsigned();
+    for (uint64 i = 0; i < count && !decoder.has_failed(); i++) {
+        auto expression = read_expression();
+        if (expression == nullptr) {
+            decoder.fail();
+            break;
+        }
+        expressions.push_back(expression);
+    }
+    return expressions;
+}
+
+auto amun::ModuleReader::read_parameters() -> std::vector<Parameter*>
+{
+    std::vector<Parameter*> parameters;
+    auto count = decoder.read_unsigned();
+    for (uint64 i = 0; i < count && !decoder.has_failed(); i++) {
+        auto name = read_token();
+        auto type = read_type();
+        parameters.push_back(create_node<Parameter>(name, type));
+    }
+    return parameters;
+}
+
+auto amun::ModuleReader::read_token() -> Token
+{
+    Token token;
+    token.kind = static_cast<TokenKind>(decoder.read_unsigned());
+
+    auto file_index = decoder.read_unsigned();
+    if (file_index == 0) {
+        token.position.file_id = static_cast<int>(decoder.read_signed());
+    }
+    else if (file_index <= files_ids.size()) {
+        token.position.file_id = files_ids[file_index - 1];
+    }
+    else {
+        decoder.fail();
+    }
+
+    token.position.line_number = static_cast<int>(decoder.read_signed());
+    token.position.column_start = static_cast<int>(decoder.read_signed());
+    token.position.column_end = static_cast<int>(decoder.read_signed());
+
+    auto literal = decoder.read_string();
+    if (!literal.empty()) {
+        token.literal = context.source_manager.save_literal(literal);
+    }
+    return token;
+}
+
+auto amun::ModuleReader::read_tokens() -> std::vector<Token>
+{
+    std::vector<Token> tokens;
+    auto count = decoder.read_unsigned();
+    for (uint64 i = 0; i < count && !decoder.has_failed(); i++) {
+        tokens.push_back(read_token());
+    }
+    return tokens;
+}
+
+auto amun::ModuleReader::read_loop_hints(LoopHints& hints) -> void
+{
+    hints.unroll_count = static_cast<uint32>(decoder.read_unsigned());
+    hints.unroll_full = decoder.read_bool();
+    hints.vectorize_width = static_cast<uint32>(decoder.read_unsigned());
+    hints.interleave_count = static_cast<uint32>(decoder.read_unsigned());
+    hints.no_vectorize = decoder.read_bool();
+}
+
+auto amun::ModuleReader::read_strings() -> std::vector<std::string>
+{
+    std::vector<std::string> strings;
+    auto count = decoder.read_unsigned();
+    for (uint64 i = 0; i < count && !decoder.has_failed(); i++) {
+        strings.push_back(std::string(decoder.read_string()));
+    }
+    return strings;
+}
+
+auto amun::ModuleReader::read_type() -> Type*
+{
+    auto index = decoder.read_unsigned();
+    if (index == 0) {
+        return nullptr;
+    }
+
+    if (index > types.size()) {
+        decoder.fail();
+        return nullptr;
+    }
+    return types[index - 1];
+}
+
+auto amun::ModuleReader::read_types() -> std::vector<Type*>
+{
+    std::vector<Type*> types;
+    auto count = decoder.read_unsigned();
+    for (uint64 i = 0; i < count && !decoder.has_failed(); i++) {
+        types.push_back(read_type());
+    }
+    return types;
+}
+
+auto amun::ModuleReader::read_type_index() -> Type*
+{
+    auto index = decoder.read_unsigned();
+    if (index >= types.size()) {
+        decoder.fail();
+        return nullptr;
+    }
+    return types[index];
+}
+
+auto amun::ModuleReader::read_types_indexes() -> std::vector<Type*>
+{
+    std::vector<Type*> types;
+    auto count = decoder.read_unsigned();
+    for (uint64 i = 0; i < count && !decoder.has_failed(); i++) {
+        types.push_back(read_type_index());
+    }
+    return types;
+}
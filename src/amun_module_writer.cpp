@@ -0,0 +1,794 @@
+#include "../include/amun_module_writer.hpp"
+
+#include <llvm/Support/xxhash.h>
+
+auto amun::ModuleWriter::write_module(const PrecompiledModule& module) -> std::string
+{
+    for (size_t index = 0; index < module.files.size(); index++) {
+        files_indexes[module.files[index].source_file_id] = index;
+    }
+
+    // Structures and enumerations declared in this module are written fully in the types table
+    for (auto* node : module.nodes) {
+        if (auto* struct_declaration = dynamic_cast<StructDeclaration*>(node)) {
+            declared_types.insert(struct_declaration->struct_type);
+        }
+        else if (auto* enum_declaration = dynamic_cast<EnumDeclaration*>(node)) {
+            declared_types.insert(enum_declaration->enum_type);
+        }
+    }
+
+    write_statements(module.nodes);
+
+    ModuleEncoder declarations_encoder;
+    declarations_encoder.write_unsigned(module.functions.size());
+    for (const auto& [name, kind] : module.functions) {
+        declarations_encoder.write_string(name);
+        declarations_encoder.write_unsigned(kind);
+    }
+
+    declarations_encoder.write_unsigned(module.aliases.size());
+    for (const auto& [name, type] : module.aliases) {
+        declarations_encoder.write_string(name);
+        declarations_encoder.write_unsigned(resolve_type_index(type));
+    }
+
+    ModuleEncoder payload_encoder;
+    payload_encoder.write_unsigned(module.environment_fingerprint);
+    payload_encoder.write_unsigned(module.files.size());
+    for (const auto& file : module.files) {
+        payload_encoder.write_string(file.path);
+        payload_encoder.write_unsigned(file.content_hash);
+    }
+
+    payload_encoder.write_unsigned(module.skipped_paths.size());
+    for (const auto& path : module.skipped_paths) {
+        payload_encoder.write_string(path);
+    }
+
+    payload_encoder.write_unsigned(types_entries_count);
+    payload_encoder.write_bytes(types_encoder.bytes());
+    payload_encoder.write_bytes(declarations_encoder.bytes());
+    payload_encoder.write_unsigned(expressions_count);
+    payload_encoder.write_bytes(nodes_encoder.bytes());
+
+    auto payload = payload_encoder.bytes();
+    ModuleEncoder module_encoder;
+    module_encoder.write_unsigned(MODULE_FORMAT_MAGIC);
+    module_encoder.write_unsigned(MODULE_FORMAT_VERSION);
+    module_encoder.write_string(AMUN_LANGUAGE_VERSION);
+    module_encoder.write_unsigned(llvm::xxHash64(llvm::StringRef(payload.data(), payload.size())));
+    module_encoder.write_bytes(payload);
+    return std::string(module_encoder.bytes());
+}
+
+auto amun::ModuleWriter::visit(BlockStatement* node) -> void
+{
+    write_tag(ModuleNodeTag::BLOCK);
+    write_statements(node->statements);
+}
+
+auto amun::ModuleWriter::visit(FieldDeclaration* node) -> void
+{
+    write_tag(ModuleNodeTag::FIELD_DECLARATION);
+    write_token(node->name);
+    write_type(node->type);
+    write_expression(node->value);
+    nodes_encoder.write_bool(node->is_global);
+    nodes_encoder.write_bool(node->has_explicit_type);
+}
+
+auto amun::ModuleWriter::visit(DestructuringDeclaraion* node) -> void
+{
+    write_tag(ModuleNodeTag::DESTRUCTURING_DECLARATION);
+    nodes_encoder.write_unsigned(node->names.size());
+    for (const auto& name : node->names) {
+        write_token(name);
+    }
+    write_types(node->types);
+    write_expression(node->value);
+    write_token(node->equal_token);
+    nodes_encoder.write_bool(node->is_global);
+}
+
+auto amun::ModuleWriter::visit(ConstDeclaration* node) -> void
+{
+    write_tag(ModuleNodeTag::CONST_DECLARATION);
+    write_token(node->name);
+    write_expression(node->value);
+}
+
+auto amun::ModuleWriter::visit(FunctionPrototype* node) -> void
+{
+    write_tag(ModuleNodeTag::FUNCTION_PROTOTYPE);
+    write_token(node->name);
+    write_parameters(node->parameters);
+    write_type(node->return_type);
+    nodes_encoder.write_bool(node->is_external);
+    nodes_encoder.write_bool(node->has_varargs);
+    write_type(node->varargs_type);
+    nodes_encoder.write_bool(node->is_generic);
+    write_strings(node->generic_parameters);
+}
+
+auto amun::ModuleWriter::visit(OperatorFunctionDeclaraion* node) -> void
+{
+    write_tag(ModuleNodeTag::OPERATOR_FUNCTION_DECLARATION);
+    write_token(node->op);
+    write_statement(node->function);
+}
+
+auto amun::ModuleWriter::visit(IntrinsicPrototype* node) -> void
+{
+    write_tag(ModuleNodeTag::INTRINSIC_PROTOTYPE);
+    write_token(node->name);
+    nodes_encoder.write_string(node->native_name);
+    write_parameters(node->parameters);
+    write_type(node->return_type);
+    nodes_encoder.write_bool(node->varargs);
+    write_type(node->varargs_type);
+}
+
+auto amun::ModuleWriter::visit(FunctionDeclaration* node) -> void
+{
+    write_tag(ModuleNodeTag::FUNCTION_DECLARATION);
+    write_statement(node->prototype);
+    write_statement(node->body);
+}
+
+auto amun::ModuleWriter::visit(StructDeclaration* node) -> void
+{
+    write_tag(ModuleNodeTag::STRUCT_DECLARATION);
+    write_type(node->struct_type);
+}
+
+auto amun::ModuleWriter::visit(EnumDeclaration* node) -> void
+{
+    write_tag(ModuleNodeTag::ENUM_DECLARATION);
+    write_token(node->name);
+    write_type(node->enum_type);
+}
+
+auto amun::ModuleWriter::visit(IfStatement* node) -> void
+{
+    write_tag(ModuleNodeTag::IF_STATEMENT);
+    nodes_encoder.write_unsigned(node->conditional_blocks.size());
+    for (auto* conditional_block : node->conditional_blocks) {
+        write_token(conditional_block->position);
+        write_expression(conditional_block->condition);
+        write_statement(conditional_block->body);
+    }
+    nodes_encoder.write_bool(node->has_else);
+}
+
+auto amun::ModuleWriter::visit(ForRangeStatement* node) -> void
+{
+    write_tag(ModuleNodeTag::FOR_RANGE);
+    write_token(node->position);
+    nodes_encoder.write_string(node->element_name);
+    write_expression(node->range_start);
+    write_expression(node->range_end);
+    write_expression(node->step);
+    write_statement(node->body);
+    write_loop_hints(node->hints);
+}
+
+auto amun::ModuleWriter::visit(ForEachStatement* node) -> void
+{
+    write_tag(ModuleNodeTag::FOR_EACH);
+    write_token(node->position);
+    nodes_encoder.write_string(node->element_name);
+    nodes_encoder.write_string(node->index_name);
+    write_expression(node->collection);
+    write_statement(node->body);
+    write_loop_hints(node->hints);
+}
+
+auto amun::ModuleWriter::visit(ForeverStatement* node) -> void
+{
+    write_tag(ModuleNodeTag::FOR_EVER);
+    write_token(node->position);
+    write_statement(node->body);
+    write_loop_hints(node->hints);
+}
+
+auto amun::ModuleWriter::visit(WhileStatement* node) -> void
+{
+    write_tag(ModuleNodeTag::WHILE);
+    write_token(node->keyword);
+    write_expression(node->condition);
+    write_statement(node->body);
+    write_loop_hints(node->hints);
+}
+
+auto amun::ModuleWriter::visit(SwitchStatement* node) -> void
+{
+    write_tag(ModuleNodeTag::SWITCH_STATEMENT);
+    write_token(node->keyword);
+    write_expression(node->argument);
+    nodes_encoder.write_unsigned(node->cases.size());
+    for (auto* switch_case : node->cases) {
+        write_token(switch_case->position);
+        write_expressions(switch_case->values);
+        write_statement(switch_case->body);
+    }
+    nodes_encoder.write_unsigned(static_cast<uint64>(node->op));
+    nodes_encoder.write_bool(node->has_default_case);
+    nodes_encoder.write_bool(node->should_perform_complete_check);
+}
+
+auto amun::ModuleWriter::visit(ReturnStatement* node) -> void
+{
+    write_tag(ModuleNodeTag::RETURN);
+    write_token(node->keyword);
+    write_expression(node->value);
+    nodes_encoder.write_bool(node->has_value);
+}
+
+auto amun::ModuleWriter::visit(DeferStatement* node) -> void
+{
+    write_tag(ModuleNodeTag::DEFER);
+    write_expression(node->call_expression);
+}
+
+auto amun::ModuleWriter::visit(BreakStatement* node) -> void
+{
+    write_tag(ModuleNodeTag::BREAK);
+    write_token(node->keyword);
+    nodes_encoder.write_bool(node->has_times);
+    nodes_encoder.write_signed(node->times);
+}
+
+auto amun::ModuleWriter::visit(ContinueStatement* node) -> void
+{
+    write_tag(ModuleNodeTag::CONTINUE);
+    write_token(node->keyword);
+    nodes_encoder.write_bool(node->has_times);
+    nodes_encoder.write_signed(node->times);
+}
+
+auto amun::ModuleWriter::visit(ExpressionStatement* node) -> void
+{
+    write_tag(ModuleNodeTag::EXPRESSION_STATEMENT);
+    write_expression(node->expression);
+}
+
+auto amun::ModuleWriter::visit(IfExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::IF_EXPRESSION);
+    nodes_encoder.write_unsigned(node->tokens.size());
+    for (const auto& token : node->tokens) {
+        write_token(token);
+    }
+    write_expressions(node->conditions);
+    write_expressions(node->values);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(SwitchExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::SWITCH_EXPRESSION);
+    write_token(node->keyword);
+    write_expression(node->argument);
+    write_expressions(node->switch_cases);
+    write_expressions(node->switch_cases_values);
+    write_expression(node->default_value);
+    nodes_encoder.write_unsigned(static_cast<uint64>(node->op));
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(TupleExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::TUPLE);
+    write_token(node->position);
+    write_expressions(node->values);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(AssignExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::ASSIGN);
+    write_expression(node->left);
+    write_token(node->operator_token);
+    write_expression(node->right);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(BinaryExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::BINARY);
+    write_expression(node->left);
+    write_token(node->operator_token);
+    write_expression(node->right);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(BitwiseExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::BITWISE);
+    write_expression(node->left);
+    write_token(node->operator_token);
+    write_expression(node->right);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(ComparisonExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::COMPARISON);
+    write_expression(node->left);
+    write_token(node->operator_token);
+    write_expression(node->right);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(LogicalExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::LOGICAL);
+    write_expression(node->left);
+    write_token(node->operator_token);
+    write_expression(node->right);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(PrefixUnaryExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::PREFIX_UNARY);
+    write_token(node->operator_token);
+    write_expression(node->right);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(PostfixUnaryExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::POSTFIX_UNARY);
+    write_token(node->operator_token);
+    write_expression(node->right);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(CallExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::CALL);
+    write_token(node->position);
+    write_expression(node->callee);
+    write_expressions(node->arguments);
+    write_types(node->generic_arguments);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(InitializeExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::INITIALIZE);
+    write_token(node->position);
+    write_type(node->type);
+    write_expressions(node->arguments);
+}
+
+auto amun::ModuleWriter::visit(LambdaExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::LAMBDA);
+    write_token(node->position);
+    write_parameters(node->explicit_parameters);
+    write_type(node->return_type);
+    write_statement(node->body);
+    write_type(node->lambda_type);
+    write_strings(node->implict_parameters_names);
+    write_types(node->implict_parameters_types);
+}
+
+auto amun::ModuleWriter::visit(DotExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::DOT);
+    write_token(node->dot_token);
+    write_expression(node->callee);
+    write_token(node->field_name);
+    nodes_encoder.write_signed(node->field_index);
+    nodes_encoder.write_bool(node->is_constants_);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(CastExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::CAST);
+    write_token(node->position);
+    write_type(node->type);
+    write_expression(node->value);
+}
+
+auto amun::ModuleWriter::visit(TypeSizeExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::TYPE_SIZE);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(TypeAlignExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::TYPE_ALIGN);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(ValueSizeExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::VALUE_SIZE);
+    write_expression(node->value);
+}
+
+auto amun::ModuleWriter::visit(IndexExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::INDEX);
+    write_token(node->position);
+    write_expression(node->value);
+    write_expression(node->index);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(EnumAccessExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::ENUM_ACCESS);
+    write_token(node->enum_name);
+    write_token(node->element_name);
+    nodes_encoder.write_signed(node->enum_element_index);
+    write_type(node->element_type);
+}
+
+auto amun::ModuleWriter::visit(LiteralExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::LITERAL);
+    write_token(node->name);
+    write_type(node->type);
+    nodes_encoder.write_bool(node->constants);
+}
+
+auto amun::ModuleWriter::visit(NumberExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::NUMBER);
+    write_token(node->value);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(StringExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::STRING);
+    write_token(node->value);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(ArrayExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::ARRAY);
+    write_token(node->position);
+    write_expressions(node->values);
+    write_type(node->type);
+    nodes_encoder.write_bool(node->is_constants_array);
+}
+
+auto amun::ModuleWriter::visit(VectorExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::VECTOR);
+    write_expression(node->array);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(CharacterExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::CHARACTER);
+    write_token(node->value);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(BooleanExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::BOOLEAN);
+    write_token(node->value);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::visit(NullExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::NULL_VALUE);
+    write_token(node->value);
+    write_type(node->type);
+    write_type(node->null_base_type);
+}
+
+auto amun::ModuleWriter::visit(UndefinedExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::UNDEFINED);
+    write_token(node->keyword);
+    write_type(node->base_type);
+}
+
+auto amun::ModuleWriter::visit(InfinityExpression* node) -> void
+{
+    write_tag(ModuleNodeTag::INFINITY_VALUE);
+    write_type(node->type);
+}
+
+auto amun::ModuleWriter::write_tag(ModuleNodeTag tag) -> void
+{
+    nodes_encoder.write_unsigned(static_cast<uint64>(tag));
+}
+
+auto amun::ModuleWriter::write_statement(Statement* statement) -> void
+{
+    if (statement == nullptr) {
+        write_tag(ModuleNodeTag::NONE);
+        return;
+    }
+    statement->accept(this);
+}
+
+auto amun::ModuleWriter::write_statements(const std::vector<Statement*>& statements) -> void
+{
+    nodes_encoder.write_unsigned(statements.size());
+    for (auto* statement : statements) {
+        write_statement(statement);
+    }
+}
+
+auto amun::ModuleWriter::write_expression(Expression* expression) -> void
+{
+    if (expression == nullptr) {
+        write_tag(ModuleNodeTag::NONE);
+        return;
+    }
+
+    // Constants declared before this module are referenced by name
+    auto constant = constants.find(expression);
+    if (constant != constants.end()) {
+        write_tag(ModuleNodeTag::CONSTANT_REFERENCE);
+        nodes_encoder.write_string(constant->second);
+        return;
+    }
+
+    // Constants values and chained comparisons operands are shared between many nodes
+    auto expression_index = expressions_indexes.find(expression);
+    if (expression_index != expressions_indexes.end()) {
+        write_tag(ModuleNodeTag::EXPRESSION_REFERENCE);
+        nodes_encoder.write_unsigned(expression_index->second);
+        return;
+    }
+
+    expression->accept(this);
+    expressions_indexes[expression] = expressions_count++;
+}
+
+auto amun::ModuleWriter::write_expressions(const std::vector<Expression*>& expressions) -> void
+{
+    nodes_encoder.write_unsigned(expressions.size());
+    for (auto* expression : expressions) {
+        write_expression(expression);
+    }
+}
+
+auto amun::ModuleWriter::write_parameters(const std::vector<Parameter*>& parameters) -> void
+{
+    nodes_encoder.write_unsigned(parameters.size());
+    for (auto* parameter : parameters) {
+        write_token(parameter->name);
+        write_type(parameter->type);
+    }
+}
+
+auto amun::ModuleWriter::write_token(const Token& token) -> void
+{
+    encode_token(nodes_encoder, token);
+}
+
+auto amun::ModuleWriter::write_loop_hints(const LoopHints& hints) -> void
+{
+    nodes_encoder.write_unsigned(hints.unroll_count);
+    nodes_encoder.write_bool(hints.unroll_full);
+    nodes_encoder.write_unsigned(hints.vectorize_width);
+    nodes_encoder.write_unsigned(hints.interleave_count);
+    nodes_encoder.write_bool(hints.no_vectorize);
+}
+
+auto amun::ModuleWriter::encode_token(ModuleEncoder& encoder, const Token& token) -> void
+{
+    encoder.write_unsigned(static_cast<uint64>(token.kind));
+
+    // Tokens created by the parser may have position outside the module files
+    auto file_index = files_indexes.find(token.position.file_id);
+    if (file_index != files_indexes.end()) {
+        encoder.write_unsigned(file_index->second + 1);
+    }
+    else {
+        encoder.write_unsigned(0);
+        encoder.write_signed(token.position.file_id);
+    }
+
+    encoder.write_signed(token.position.line_number);
+    encoder.write_signed(token.position.column_start);
+    encoder.write_signed(token.position.column_end);
+    encoder.write_string(token.literal);
+}
+
+auto amun::ModuleWriter::write_strings(const std::vector<std::string>& strings) -> void
+{
+    nodes_encoder.write_unsigned(strings.size());
+    for (const auto& string : strings) {
+        nodes_encoder.write_string(string);
+    }
+}
+
+auto amun::ModuleWriter::write_type(Type* type) -> void
+{
+    nodes_encoder.write_unsigned(type == nullptr ? 0 : resolve_type_index(type) + 1);
+}
+
+auto amun::ModuleWriter::write_types(const std::vector<Type*>& types) -> void
+{
+    nodes_encoder.write_unsigned(types.size());
+    for (auto* type : types) {
+        write_type(type);
+    }
+}
+
+auto amun::ModuleWriter::resolve_type_index(Type* type) -> uint64
+{
+    auto type_index = types_indexes.find(type);
+    if (type_index != types_indexes.end()) {
+        return type_index->second;
+    }
+
+    // Write the type entry after the entries of the types it depends on except structure fields
+    // that are written after the structure so they can refer to the structure itself
+    auto define_type = [this, type](ModuleTypeTag tag) {
+        types_encoder.write_unsigned(static_cast<uint64>(tag));
+        types_entries_count++;
+        auto index = static_cast<uint64>(types_indexes.size());
+        types_indexes[type] = index;
+        return index;
+    };
+
+    auto optional_type_index = [this](Type* type) -> uint64 {
+        return type == nullptr ? 0 : resolve_type_index(type) + 1;
+    };
+
+    auto write_indexes = [this](const std::vector<uint64>& indexes) {
+        types_encoder.write_unsigned(indexes.size());
+        for (auto index : indexes) {
+            types_encoder.write_unsigned(index);
+        }
+    };
+
+    auto write_names = [this](const std::vector<std::string>& names) {
+        types_encoder.write_unsigned(names.size());
+        for (const auto& name : names) {
+            types_encoder.write_string(name);
+        }
+    };
+
+    switch (type->type_kind) {
+    case TypeKind::NUMBER: {
+        auto number_type = static_cast<NumberType*>(type);
+        auto index = define_type(ModuleTypeTag::NUMBER);
+        types_encoder.write_unsigned(static_cast<uint64>(number_type->number_kind));
+        return index;
+    }
+    case TypeKind::POINTER: {
+        auto base_index = resolve_type_index(static_cast<PointerType*>(type)->base_type);
+        auto index = define_type(ModuleTypeTag::POINTER);
+        types_encoder.write_unsigned(base_index);
+        return index;
+    }
+    case TypeKind::FUNCTION: {
+        auto function_type = static_cast<FunctionType*>(type);
+        auto parameters_indexes = resolve_types_indexes(function_type->parameters);
+        auto return_index = optional_type_index(function_type->return_type);
+        auto varargs_index = optional_type_index(function_type->varargs_type);
+        auto index = define_type(ModuleTypeTag::FUNCTION);
+        write_indexes(parameters_indexes);
+        types_encoder.write_unsigned(return_index);
+        types_encoder.write_bool(function_type->has_varargs);
+        types_encoder.write_unsigned(varargs_index);
+        types_encoder.write_bool(function_type->is_intrinsic);
+        types_encoder.write_bool(function_type->is_generic);
+        write_names(function_type->generic_names);
+        types_encoder.write_signed(function_type->implicit_parameters_count);
+        return index;
+    }
+    case TypeKind::STATIC_ARRAY: {
+        auto array_type = static_cast<StaticArrayType*>(type);
+        auto element_index = resolve_type_index(array_type->element_type);
+        auto index = define_type(ModuleTypeTag::STATIC_ARRAY);
+        types_encoder.write_unsigned(element_index);
+        types_encoder.write_unsigned(array_type->size);
+        return index;
+    }
+    case TypeKind::STATIC_VECTOR: {
+        auto array_index = resolve_type_index(static_cast<StaticVectorType*>(type)->array);
+        auto index = define_type(ModuleTypeTag::STATIC_VECTOR);
+        types_encoder.write_unsigned(array_index);
+        return index;
+    }
+    case TypeKind::STRUCT: {
+        auto struct_type = static_cast<StructType*>(type);
+        if (!declared_types.contains(type)) {
+            auto index = define_type(ModuleTypeTag::STRUCT_REFERENCE);
+            types_encoder.write_string(struct_type->name);
+            return index;
+        }
+
+        auto index = define_type(ModuleTypeTag::STRUCT_DECLARATION);
+        types_encoder.write_string(struct_type->name);
+        write_names(struct_type->generic_parameters);
+        types_encoder.write_bool(struct_type->is_packed);
+        types_encoder.write_bool(struct_type->is_generic);
+        types_encoder.write_bool(struct_type->is_extern);
+
+        auto fields_indexes = resolve_types_indexes(struct_type->fields_types);
+        auto generic_types_indexes = resolve_types_indexes(struct_type->generic_parameters_types);
+        types_encoder.write_unsigned(static_cast<uint64>(ModuleTypeTag::STRUCT_FIELDS));
+        types_entries_count++;
+        types_encoder.write_unsigned(index);
+        write_names(struct_type->fields_names);
+        write_indexes(fields_indexes);
+        write_indexes(generic_types_indexes);
+        return index;
+    }
+    case TypeKind::TUPLE: {
+        auto fields_indexes = resolve_types_indexes(static_cast<TupleType*>(type)->fields_types);
+        auto index = define_type(ModuleTypeTag::TUPLE);
+        write_indexes(fields_indexes);
+        return index;
+    }
+    case TypeKind::ENUM: {
+        auto enum_type = static_cast<EnumType*>(type);
+        if (!declared_types.contains(type)) {
+            auto index = define_type(ModuleTypeTag::ENUM_REFERENCE);
+            types_encoder.write_string(enum_type->name.literal);
+            return index;
+        }
+
+        auto element_index = resolve_type_index(enum_type->element_type);
+        auto index = define_type(ModuleTypeTag::ENUM_DECLARATION);
+        encode_token(types_encoder, enum_type->name);
+        types_encoder.write_unsigned(enum_type->values.size());
+        for (const auto& [name, value] : enum_type->values) {
+            types_encoder.write_string(name);
+            types_encoder.write_signed(value);
+        }
+        types_encoder.write_unsigned(element_index);
+        return index;
+    }
+    case TypeKind::ENUM_ELEMENT: {
+        auto element_type = static_cast<EnumElementType*>(type);
+        auto element_index = resolve_type_index(element_type->element_type);
+        auto index = define_type(ModuleTypeTag::ENUM_ELEMENT);
+        types_encoder.write_string(element_type->enum_name);
+        types_encoder.write_unsigned(element_index);
+        return index;
+    }
+    case TypeKind::GENERIC_PARAMETER: {
+        auto index = define_type(ModuleTypeTag::GENERIC_PARAMETER);
+        types_encoder.write_string(static_cast<GenericParameterType*>(type)->name);
+        return index;
+    }
+    case TypeKind::GENERIC_STRUCT: {
+        auto generic_struct = static_cast<GenericStructType*>(type);
+        auto struct_index = resolve_type_index(generic_struct->struct_type);
+        auto parameters_indexes = resolve_types_indexes(generic_struct->parameters);
+        auto index = define_type(ModuleTypeTag::GENERIC_STRUCT);
+        types_encoder.write_unsigned(struct_index);
+        write_indexes(parameters_indexes);
+        return index;
+    }
+    case TypeKind::NONE: return define_type(ModuleTypeTag::NONE);
+    case TypeKind::VOID: return define_type(ModuleTypeTag::VOID);
+    case TypeKind::NILL: return define_type(ModuleTypeTag::NILL);
+    }
+    return define_type(ModuleTypeTag::NONE);
+}
+
+auto amun::ModuleWriter::resolve_types_indexes(const std::vector<Type*>& types)
+    -> std::vector<uint64>
+{
+    std::vector<uint64> indexes;
+    indexes.reserve(types.size());
+    for (auto* type : types) {
+        indexes.push_back(resolve_type_index(type));
+    }
+    return indexes;
+}
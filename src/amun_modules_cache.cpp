@@ -0,0 +1,280 @@
+#include "../include/amun_modules_cache.hpp"
+#include "../include/amun_files.hpp"
+#include "../include/amun_module_format.hpp"
+#include "../include/amun_module_reader.hpp"
+#include "../include/amun_module_writer.hpp"
+
+#include <llvm/Support/FileUtilities.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/xxhash.h>
+
+#include <algorithm>
+
+auto amun::module_file_path(const std::string& source_path) -> std::string
+{
+    llvm::SmallString<128> module_path(source_path);
+    llvm::sys::path::replace_extension(module_path, AMUN_MODULE_EXTENSION);
+    return std::string(module_path);
+}
+
+static auto content_hash(std::string_view content) -> uint64
+{
+    return llvm::xxHash64(llvm::StringRef(content.data(), content.size()));
+}
+
+auto amun::ModulesCache::begin_module(amun::Context& context, const std::string& path,
+                                      int source_file_id) -> ModuleEnvironment
+{
+    ModuleEnvironment environment;
+    environment.fingerprint = fingerprint_environment(context, environment);
+    environment.parsed_files_count = parsed_files.size();
+    environment.skipped_paths_count = skipped_paths.size();
+    environment.aliases_count = context.type_alias_table.defined_aliases().size();
+    environment.warnings_count = context.diagnostics.level_count(DiagnosticLevel::WARNING);
+
+    auto& source_buffer = context.source_manager.load_source_buffer(source_file_id);
+    parsed_files.push_back({path, content_hash(source_buffer.content()), source_file_id});
+    return environment;
+}
+
+auto amun::ModulesCache::load_module(amun::Context& context, const std::string& path,
+                                     const ModuleEnvironment& environment)
+    -> std::optional<std::vector<Statement*>>
+{
+    auto module_buffer = llvm::MemoryBuffer::getFile(module_file_path(path));
+    if (!module_buffer) {
+        return std::nullopt;
+    }
+
+    auto module_bytes = (*module_buffer)->getBuffer();
+    ModuleReader reader(context, std::string_view(module_bytes.data(), module_bytes.size()));
+    PrecompiledModule module;
+    if (!reader.read_module_files(module) ||
+        module.environment_fingerprint != environment.fingerprint) {
+        return std::nullopt;
+    }
+
+    const auto& source_file = parsed_files[environment.parsed_files_count];
+    if (module.files[0].path != path || module.files[0].content_hash != source_file.content_hash) {
+        return std::nullopt;
+    }
+
+    // Files loaded from this source must be parsed again if they are changed or already parsed
+    auto& source_manager = context.source_manager;
+    for (size_t i = 1; i < module.files.size(); i++) {
+        const auto& file = module.files[i];
+        if (source_manager.is_path_registered(file.path) || !amun::is_file_exists(file.path)) {
+            return std::nullopt;
+        }
+
+        auto file_buffer = llvm::MemoryBuffer::getFile(file.path);
+        if (!file_buffer) {
+            return std::nullopt;
+        }
+
+        auto content = (*file_buffer)->getBuffer();
+        if (content_hash(std::string_view(content.data(), content.size())) != file.content_hash) {
+            return std::nullopt;
+        }
+    }
+
+    // Files that was skipped must be still skipped, otherwise they will be loaded by this source
+    for (const auto& skipped_path : module.skipped_paths) {
+        auto is_module_file = [&](const auto& file) { return file.path == skipped_path; };
+        if (!std::any_of(module.files.begin(), module.files.end(), is_module_file) &&
+            !source_manager.is_path_registered(skipped_path)) {
+            return std::nullopt;
+        }
+    }
+
+    std::vector<int> files_ids;
+    files_ids.push_back(source_file.source_file_id);
+    for (size_t i = 1; i < module.files.size(); i++) {
+        files_ids.push_back(source_manager.reserve_source_id(module.files[i].path));
+    }
+
+    if (!reader.read_module_declarations(module, files_ids)) {
+        return std::nullopt;
+    }
+
+    for (size_t i = 1; i < module.files.size(); i++) {
+        auto& file = module.files[i];
+        file.source_file_id = source_manager.register_source_path(file.path);
+        parsed_files.push_back(file);
+    }
+
+    skipped_paths.insert(skipped_paths.end(), module.skipped_paths.begin(),
+                         module.skipped_paths.end());
+
+    // Declare what the parser declares while parsing the source file
+    for (auto* node : module.nodes) {
+        if (auto* const_declaration = dynamic_cast<ConstDeclaration*>(node)) {
+            auto name = std::string(const_declaration->name.literal);
+            context.constants_table_map.define(name, const_declaration->value);
+        }
+        else if (auto* struct_declaration = dynamic_cast<StructDeclaration*>(node)) {
+            auto struct_type = struct_declaration->struct_type;
+            context.structures[struct_type->name] = struct_type;
+        }
+        else if (auto* enum_declaration = dynamic_cast<EnumDeclaration*>(node)) {
+            auto name = std::string(enum_declaration->name.literal);
+            context.enumerations[name] = static_cast<EnumType*>(enum_declaration->enum_type);
+        }
+    }
+
+    for (const auto& [name, kind] : module.functions) {
+        context.functions[name] = kind;
+    }
+
+    for (const auto& [name, type] : module.aliases) {
+        context.type_alias_table.define_alias(name, type);
+    }
+
+    return module.nodes;
+}
+
+auto amun::ModulesCache::save_module(amun::Context& context, const std::string& path,
+                                     const ModuleEnvironment& environment,
+                                     const std::vector<Statement*>& nodes) -> void
+{
+    // Warnings are reported only while parsing so the module can't replace parsing
+    if (context.diagnostics.level_count(DiagnosticLevel::WARNING) != environment.warnings_count) {
+        return;
+    }
+
+    PrecompiledModule module;
+    module.environment_fingerprint = environment.fingerprint;
+    module.files.assign(parsed_files.begin() + environment.parsed_files_count,
+                        parsed_files.end());
+    module.skipped_paths.assign(skipped_paths.begin() + environment.skipped_paths_count,
+                                skipped_paths.end());
+    module.nodes = nodes;
+
+    const auto& aliases = context.type_alias_table.defined_aliases();
+    for (size_t i = environment.aliases_count; i < aliases.size(); i++) {
+        module.aliases.emplace_back(aliases[i], context.type_alias_table.resolve_alias(aliases[i]));
+    }
+
+    for (auto* node : nodes) {
+        std::string function_name;
+        if (auto* function = dynamic_cast<FunctionDeclaration*>(node)) {
+            function_name = function->prototype->name.literal;
+        }
+        else if (auto* prototype = dynamic_cast<FunctionPrototype*>(node)) {
+            function_name = prototype->name.literal;
+        }
+        else if (auto* intrinsic = dynamic_cast<IntrinsicPrototype*>(node)) {
+            function_name = intrinsic->name.literal;
+        }
+        else {
+            continue;
+        }
+
+        auto function_kind = context.functions.find(function_name);
+        if (function_kind != context.functions.end()) {
+            module.functions.emplace_back(function_name, function_kind->second);
+        }
+    }
+
+    ModuleWriter writer(environment.constants);
+    auto module_bytes = writer.write_module(module);
+
+    // Module is written to temporary file then renamed so other compilers never read part of it
+    auto module_path = module_file_path(path);
+    auto error = llvm::writeFileAtomically(module_path + "-%%%%%%.tmp", module_path, module_bytes);
+    llvm::consumeError(std::move(error));
+}
+
+auto amun::ModulesCache::record_skipped_path(const std::string& path) -> void
+{
+    skipped_paths.push_back(path);
+}
+
+auto amun::ModulesCache::fingerprint_environment(amun::Context& context,
+                                                 ModuleEnvironment& environment) -> uint64
+{
+    // Declarations are stored in unordered containers so the hashes of them are combined
+    // with addition to be independent of the iteration order
+    uint64 fingerprint = 0;
+    ModuleEncoder encoder;
+    auto combine = [&]() {
+        fingerprint += content_hash(encoder.bytes());
+        encoder.clear();
+    };
+
+    encoder.write_string(AMUN_LANGUAGE_VERSION);
+    encoder.write_bool(context.options.should_report_warns);
+    combine();
+
+    for (const auto& [name, kind] : context.functions) {
+        encoder.write_unsigned(0);
+        encoder.write_string(name);
+        encoder.write_unsigned(kind);
+        combine();
+    }
+
+    for (const auto& [name, struct_type] : context.structures) {
+        encoder.write_unsigned(1);
+        encoder.write_string(name);
+        encoder.write_bool(struct_type->is_generic);
+        encoder.write_unsigned(struct_type->generic_parameters.size());
+        combine();
+    }
+
+    for (const auto& [name, enum_type] : context.enumerations) {
+        encoder.write_unsigned(2);
+        encoder.write_string(name);
+        encoder.write_string(amun::get_type_literal(enum_type->element_type));
+        combine();
+
+        for (const auto& [element_name, value] : enum_type->values) {
+            encoder.write_unsigned(3);
+            encoder.write_string(name);
+            encoder.write_string(element_name);
+            encoder.write_signed(value);
+            combine();
+        }
+    }
+
+    for (const auto& alias : context.type_alias_table.defined_aliases()) {
+        encoder.write_unsigned(4);
+        encoder.write_string(alias);
+        encoder.write_string(amun::get_type_literal(context.type_alias_table.resolve_alias(alias)));
+        combine();
+    }
+
+    // Compile time constants are only primitive values or negative numbers
+    for (const auto& [name, value] : context.constants_table_map.scope(0)) {
+        environment.constants[value] = name.str();
+        encoder.write_unsigned(5);
+        encoder.write_string(name);
+        encoder.write_unsigned(static_cast<uint64>(value->get_ast_node_type()));
+
+        auto constant = value;
+        if (auto* prefix_unary = dynamic_cast<PrefixUnaryExpression*>(value)) {
+            encoder.write_unsigned(static_cast<uint64>(prefix_unary->operator_token.kind));
+            constant = prefix_unary->right;
+        }
+
+        if (auto* number = dynamic_cast<NumberExpression*>(constant)) {
+            encoder.write_unsigned(static_cast<uint64>(number->value.kind));
+            encoder.write_string(number->value.literal);
+        }
+        else if (auto* string = dynamic_cast<StringExpression*>(constant)) {
+            encoder.write_string(string->value.literal);
+        }
+        else if (auto* character = dynamic_cast<CharacterExpression*>(constant)) {
+            encoder.write_string(character->value.literal);
+        }
+        else if (auto* boolean = dynamic_cast<BooleanExpression*>(constant)) {
+            encoder.write_unsigned(static_cast<uint64>(boolean->value.kind));
+        }
+
+        auto constant_type = value->get_type_node();
+        encoder.write_string(constant_type ? amun::get_type_literal(constant_type) : "");
+        combine();
+    }
+
+    return fingerprint;
+}
@@ -15,49 +15,48 @@ static std::unordered_map<amun::NumberKind, std::string> number_type_managler =
     {amun::NumberKind::FLOAT_32, "f32"},     {amun::NumberKind::FLOAT_64, "f64"},
 };
 
-auto mangle_type(Shared<amun::Type> type) -> std::string
+auto mangle_type(amun::Type* type) -> std::string
 {
     auto kind = type->type_kind;
     if (kind == amun::TypeKind::NUMBER) {
-        auto number_type = std::static_pointer_cast<amun::NumberType>(type);
+        auto number_type = static_cast<amun::NumberType*>(type);
         return number_type_managler[number_type->number_kind];
     }
 
     if (kind == amun::TypeKind::POINTER) {
-        auto pointer_type = std::static_pointer_cast<amun::PointerType>(type);
+        auto pointer_type = static_cast<amun::PointerType*>(type);
         return "p" + mangle_type(pointer_type->base_type);
     }
 
     if (kind == amun::TypeKind::STATIC_ARRAY) {
-        auto array_type = std::static_pointer_cast<amun::StaticArrayType>(type);
+        auto array_type = static_cast<amun::StaticArrayType*>(type);
         return "_a" + std::to_string(array_type->size) + mangle_type(array_type->element_type);
     }
 
     if (kind == amun::TypeKind::ENUM_ELEMENT) {
-        auto enum_element_type = std::static_pointer_cast<amun::EnumElementType>(type);
+        auto enum_element_type = static_cast<amun::EnumElementType*>(type);
         return enum_element_type->enum_name;
     }
 
     if (kind == amun::TypeKind::STRUCT) {
-        auto struct_type = std::static_pointer_cast<amun::StructType>(type);
+        auto struct_type = static_cast<amun::StructType*>(type);
         return struct_type->name;
     }
 
     if (kind == amun::TypeKind::TUPLE) {
-        auto tuple_type = std::static_pointer_cast<amun::TupleType>(type);
+        auto tuple_type = static_cast<amun::TupleType*>(type);
         return mangle_tuple_type(tuple_type);
     }
 
     return "";
 }
 
-auto mangle_tuple_type(Shared<amun::TupleType> type) -> std::string
+auto mangle_tuple_type(amun::TupleType* type) -> std::string
 {
     return "_tuple_" + mangle_types(type->fields_types);
 }
 
-auto mangle_operator_function(TokenKind kind, std::vector<Shared<amun::Type>> parameters)
-    -> std::string
+auto mangle_operator_function(TokenKind kind, std::vector<amun::Type*> parameters) -> std::string
 {
     auto operator_literal = overloading_operator_literal[kind];
     std::string operator_function_name = "_operator_" + operator_literal;
@@ -67,7 +66,7 @@ auto mangle_operator_function(TokenKind kind, std::vector<Shared<amun::Type>> pa
     return operator_function_name;
 }
 
-auto mangle_types(std::vector<Shared<amun::Type>> types) -> std::string
+auto mangle_types(std::vector<amun::Type*> types) -> std::string
 {
     std::string result;
     for (auto& type : types) {
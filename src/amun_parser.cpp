@@ -4,6 +4,8 @@
 #include "../include/amun_name_mangle.hpp"
 #include "../include/amun_type.hpp"
 
+#include <llvm/Support/TimeProfiler.h>
+
 #include <algorithm>
 #include <cassert>
 #include <memory>
@@ -12,9 +14,9 @@
 #include <unordered_map>
 #include <vector>
 
-auto amun::Parser::parse_compilation_unit() -> Shared<CompilationUnit>
+auto amun::Parser::parse_compilation_unit() -> CompilationUnit*
 {
-    std::vector<Shared<Statement>> tree_nodes;
+    std::vector<Statement*> tree_nodes;
     try {
         // Init current and next token inside try catch
         // to handle case if first two token are invalid
@@ -48,29 +50,31 @@ auto amun::Parser::parse_compilation_unit() -> Shared<CompilationUnit>
     catch (const char* message) {
         // Stop parsing at this position and return to the compiler class to report errors and stop
     }
-    return std::make_shared<CompilationUnit>(tree_nodes);
+    return create_node<CompilationUnit>(tree_nodes);
 }
 
-auto amun::Parser::parse_import_declaration() -> std::vector<Shared<Statement>>
+auto amun::Parser::parse_import_declaration() -> std::vector<Statement*>
 {
     advanced_token();
     if (is_current_kind(TokenKind::TOKEN_OPEN_BRACE)) {
         // import { <string> <string> }
         advanced_token();
-        std::vector<Shared<Statement>> tree_nodes;
+        std::vector<Statement*> tree_nodes;
         while (is_source_available() && not is_current_kind(TokenKind::TOKEN_CLOSE_BRACE)) {
             auto library_name = consume_kind(
                 TokenKind::TOKEN_STRING, "Expect string as library name after import statement");
             std::string library_path =
-                AMUN_LIBRARIES_PREFIX + library_name.literal + AMUN_LANGUAGE_EXTENSION;
+                AMUN_LIBRARIES_PREFIX + std::string(library_name.literal) + AMUN_LANGUAGE_EXTENSION;
 
             if (context->source_manager.is_path_registered(library_path)) {
+                context->modules_cache.record_skipped_path(library_path);
                 continue;
             }
 
             if (!amun::is_file_exists(library_path)) {
-                context->diagnostics.report_error(
-                    library_name.position, "No standard library with name " + library_name.literal);
+                context->diagnostics.report_error(library_name.position,
+                                                  "No standard library with name " +
+                                                      std::string(library_name.literal));
                 throw "Stop";
             }
 
@@ -90,36 +94,39 @@ auto amun::Parser::parse_import_declaration() -> std::vector<Shared<Statement>>
     check_unnecessary_semicolon_warning();
 
     std::string library_path =
-        AMUN_LIBRARIES_PREFIX + library_name.literal + AMUN_LANGUAGE_EXTENSION;
+        AMUN_LIBRARIES_PREFIX + std::string(library_name.literal) + AMUN_LANGUAGE_EXTENSION;
 
     if (context->source_manager.is_path_registered(library_path)) {
-        return std::vector<Shared<Statement>>();
+        context->modules_cache.record_skipped_path(library_path);
+        return std::vector<Statement*>();
     }
 
     if (!amun::is_file_exists(library_path)) {
         context->diagnostics.report_error(library_name.position,
-                                          "No standard library with name " + library_name.literal);
+                                          "No standard library with name " +
+                                              std::string(library_name.literal));
         throw "Stop";
     }
 
     return parse_single_source_file(library_path);
 }
 
-auto amun::Parser::parse_load_declaration() -> std::vector<Shared<Statement>>
+auto amun::Parser::parse_load_declaration() -> std::vector<Statement*>
 {
     advanced_token();
     if (is_current_kind(TokenKind::TOKEN_OPEN_BRACE)) {
         // load { <string> <string> }
         advanced_token();
-        std::vector<Shared<Statement>> tree_nodes;
+        std::vector<Statement*> tree_nodes;
         while (is_source_available() && not is_current_kind(TokenKind::TOKEN_CLOSE_BRACE)) {
             auto library_name = consume_kind(TokenKind::TOKEN_STRING,
                                              "Expect string as file name after load statement");
 
             std::string library_path =
-                file_parent_path + library_name.literal + AMUN_LANGUAGE_EXTENSION;
+                file_parent_path + std::string(library_name.literal) + AMUN_LANGUAGE_EXTENSION;
 
             if (context->source_manager.is_path_registered(library_path)) {
+                context->modules_cache.record_skipped_path(library_path);
                 continue;
             }
 
@@ -144,10 +151,12 @@ auto amun::Parser::parse_load_declaration() -> std::vector<Shared<Statement>>
 
     check_unnecessary_semicolon_warning();
 
-    std::string library_path = file_parent_path + library_name.literal + AMUN_LANGUAGE_EXTENSION;
+    std::string library_path =
+        file_parent_path + std::string(library_name.literal) + AMUN_LANGUAGE_EXTENSION;
 
     if (context->source_manager.is_path_registered(library_path)) {
-        return std::vector<Shared<Statement>>();
+        context->modules_cache.record_skipped_path(library_path);
+        return std::vector<Statement*>();
     }
 
     if (!amun::is_file_exists(library_path)) {
@@ -158,28 +167,29 @@ auto amun::Parser::parse_load_declaration() -> std::vector<Shared<Statement>>
     return parse_single_source_file(library_path);
 }
 
-auto amun::Parser::parse_compiletime_constants_declaraion() -> Shared<ConstDeclaration>
+auto amun::Parser::parse_compiletime_constants_declaraion() -> ConstDeclaration*
 {
-    auto const_token = peek_and_advance_token();
+    advanced_token();
     auto name = consume_kind(TokenKind::TOKEN_IDENTIFIER, "Expect const declaraion name");
     assert_kind(TokenKind::TOKEN_EQUAL, "Expect = after const variable name");
     auto expression = parse_expression();
     check_compiletime_constants_expression(expression, name.position);
     assert_kind(TokenKind::TOKEN_SEMICOLON, "Expect ; after const declaraion");
-    context->constants_table_map.define(name.literal, expression);
-    return std::make_shared<ConstDeclaration>(name, expression);
+    context->constants_table_map.define(std::string(name.literal), expression);
+    return create_node<ConstDeclaration>(name, expression);
 }
 
 auto amun::Parser::parse_type_alias_declaration() -> void
 {
-    auto type_token = consume_kind(TokenKind::TOKEN_TYPE, "Expect type keyword");
+    assert_kind(TokenKind::TOKEN_TYPE, "Expect type keyword");
     auto alias_token =
         consume_kind(TokenKind::TOKEN_IDENTIFIER, "Expect identifier for type alias");
 
     // Make sure alias name is unique
-    if (context->type_alias_table.contains(alias_token.literal)) {
+    if (context->type_alias_table.contains(std::string(alias_token.literal))) {
         context->diagnostics.report_error(alias_token.position,
-                                          "There already a type with name " + alias_token.literal);
+                                          "There already a type with name " +
+                                              std::string(alias_token.literal));
         throw "Stop";
     }
 
@@ -199,26 +209,38 @@ auto amun::Parser::parse_type_alias_declaration() -> void
     }
 
     assert_kind(TokenKind::TOKEN_SEMICOLON, "Expect ; after actual type");
-    context->type_alias_table.define_alias(alias_token.literal, actual_type);
+    context->type_alias_table.define_alias(std::string(alias_token.literal), actual_type);
 }
 
-auto amun::Parser::parse_single_source_file(std::string& path) -> std::vector<Shared<Statement>>
+auto amun::Parser::parse_single_source_file(std::string& path) -> std::vector<Statement*>
 {
-    const char* file_name = path.c_str();
-    std::string source_content = amun::read_file_content(file_name);
+    llvm::TimeTraceScope trace_scope("Parse file", path);
     int file_id = context->source_manager.register_source_path(path);
-    amun::Tokenizer tokenizer(file_id, source_content);
-    amun::Parser parser(context, tokenizer);
+    auto use_modules = context->options.use_precompiled_modules;
+    auto& modules_cache = context->modules_cache;
+    amun::ModuleEnvironment environment;
+    if (use_modules) {
+        environment = modules_cache.begin_module(*context, path, file_id);
+        if (auto module_nodes = modules_cache.load_module(*context, path, environment)) {
+            return *module_nodes;
+        }
+    }
+
+    amun::Parser parser(context, context->sources_scanner.take_tokens(file_id));
     auto compilation_unit = parser.parse_compilation_unit();
     if (context->diagnostics.level_count(amun::DiagnosticLevel::ERROR) > 0) {
         throw "Stop";
     }
+
+    if (use_modules) {
+        modules_cache.save_module(*context, path, environment, compilation_unit->tree_nodes);
+    }
     return compilation_unit->tree_nodes;
 }
 
-auto amun::Parser::parse_declaration_statement() -> Shared<Statement>
+auto amun::Parser::parse_declaration_statement() -> Statement*
 {
-    switch (peek_current().kind) {
+    switch (tokens.kind(current_token_index)) {
     case TokenKind::TOKEN_FUN: {
         return parse_function_declaration(amun::FunctionKind::NORMAL_FUNCTION);
     }
@@ -251,9 +273,9 @@ auto amun::Parser::parse_declaration_statement() -> Shared<Statement>
     }
 }
 
-auto amun::Parser::parse_statement() -> Shared<Statement>
+auto amun::Parser::parse_statement() -> Statement*
 {
-    switch (peek_current().kind) {
+    switch (tokens.kind(current_token_index)) {
     case TokenKind::TOKEN_VAR: {
         if (is_next_kind(TokenKind::TOKEN_OPEN_PAREN)) {
             return parse_destructuring_field_declaration(false);
@@ -299,7 +321,7 @@ auto amun::Parser::parse_statement() -> Shared<Statement>
     }
 }
 
-auto amun::Parser::parse_field_declaration(bool is_global) -> Shared<FieldDeclaration>
+auto amun::Parser::parse_field_declaration(bool is_global) -> FieldDeclaration*
 {
     assert_kind(TokenKind::TOKEN_VAR, "Expect var keyword.");
     auto name = consume_kind(TokenKind::TOKEN_IDENTIFIER, "Expect identifier as variable name.");
@@ -307,37 +329,36 @@ auto amun::Parser::parse_field_declaration(bool is_global) -> Shared<FieldDeclar
     if (is_current_kind(TokenKind::TOKEN_COLON)) {
         advanced_token();
         auto type = parse_type();
-        Shared<Expression> initalizer;
+        Expression* initalizer = nullptr;
         if (is_current_kind(TokenKind::TOKEN_EQUAL)) {
             assert_kind(TokenKind::TOKEN_EQUAL, "Expect `=` after field declaraion name.");
 
             // Parse value or undefined expression
             if (is_current_kind(TokenKind::TOKEN_UNDEFINED)) {
                 auto keyword = peek_and_advance_token();
-                initalizer = std::make_shared<UndefinedExpression>(keyword);
+                initalizer = create_node<UndefinedExpression>(keyword);
             }
             else {
                 initalizer = parse_expression();
             }
         }
         assert_kind(TokenKind::TOKEN_SEMICOLON, "Expect semicolon `;` after field declaration");
-        return std::make_shared<FieldDeclaration>(name, type, initalizer, is_global);
+        return create_node<FieldDeclaration>(name, type, initalizer, is_global);
     }
 
     assert_kind(TokenKind::TOKEN_EQUAL, "Expect `=` or `:` after field declaraion name.");
     auto init_value = parse_expression();
     assert_kind(TokenKind::TOKEN_SEMICOLON, "Expect semicolon `;` after field declaration");
-    return std::make_shared<FieldDeclaration>(name, amun::none_type, init_value, is_global);
+    return create_node<FieldDeclaration>(name, amun::none_type, init_value, is_global);
 }
 
-auto amun::Parser::parse_destructuring_field_declaration(bool is_global)
-    -> Shared<DestructuringDeclaraion>
+auto amun::Parser::parse_destructuring_field_declaration(bool is_global) -> DestructuringDeclaraion*
 {
     assert_kind(TokenKind::TOKEN_VAR, "Expect var keyword.");
     assert_kind(TokenKind::TOKEN_OPEN_PAREN, "Expect ( after var keyword.");
 
     std::vector<Token> names;
-    std::vector<Shared<amun::Type>> types;
+    std::vector<amun::Type*> types;
 
     while (!is_current_kind(TokenKind::TOKEN_CLOSE_PAREN)) {
         auto name =
@@ -364,12 +385,12 @@ auto amun::Parser::parse_destructuring_field_declaration(bool is_global)
     auto equal_token = consume_kind(TokenKind::TOKEN_EQUAL, "Expect = after var keyword.");
     auto value = parse_expression();
     assert_kind(TokenKind::TOKEN_SEMICOLON, "Expect semicolon `;` after field declaration");
-    return std::make_shared<DestructuringDeclaraion>(names, types, value, equal_token, is_global);
+    return create_node<DestructuringDeclaraion>(names, types, value, equal_token, is_global);
 }
 
-auto amun::Parser::parse_intrinsic_prototype() -> Shared<IntrinsicPrototype>
+auto amun::Parser::parse_intrinsic_prototype() -> IntrinsicPrototype*
 {
-    auto intrinsic_keyword = consume_kind(TokenKind::TOKEN_IDENTIFIER, "Expect intrinsic keyword");
+    assert_kind(TokenKind::TOKEN_IDENTIFIER, "Expect intrinsic keyword");
 
     std::string intrinsic_name;
     if (is_current_kind(TokenKind::TOKEN_OPEN_PAREN)) {
@@ -400,21 +421,21 @@ auto amun::Parser::parse_intrinsic_prototype() -> Shared<IntrinsicPrototype>
     }
 
     bool has_varargs = false;
-    Shared<amun::Type> varargs_type = nullptr;
-    std::vector<Shared<Parameter>> parameters;
+    amun::Type* varargs_type = nullptr;
+    std::vector<Parameter*> parameters;
     if (is_current_kind(TokenKind::TOKEN_OPEN_PAREN)) {
         advanced_token();
         while (is_source_available() && not is_current_kind(TokenKind::TOKEN_CLOSE_PAREN)) {
             if (has_varargs) {
                 context->diagnostics.report_error(
-                    previous_token->position, "Varargs must be the last parameter in the function");
+                    peek_previous().position, "Varargs must be the last parameter in the function");
                 throw "Stop";
             }
 
             if (is_current_kind(TokenKind::TOKEN_VARARGS)) {
                 advanced_token();
                 if (is_current_kind(TokenKind::TOKEN_IDENTIFIER) &&
-                    current_token->literal == "Any") {
+                    tokens.literal(current_token_index) == "Any") {
                     advanced_token();
                 }
                 else {
@@ -433,11 +454,11 @@ auto amun::Parser::parse_intrinsic_prototype() -> Shared<IntrinsicPrototype>
     }
 
     // Register current function declaration kind
-    context->functions[name.literal] = amun::FunctionKind::NORMAL_FUNCTION;
+    context->functions[std::string(name.literal)] = amun::FunctionKind::NORMAL_FUNCTION;
 
     // If function prototype has no explicit return type,
     // make return type to be void
-    Shared<amun::Type> return_type;
+    amun::Type* return_type;
     if (is_current_kind(TokenKind::TOKEN_SEMICOLON) ||
         is_current_kind(TokenKind::TOKEN_OPEN_BRACE)) {
         return_type = amun::void_type;
@@ -455,12 +476,12 @@ auto amun::Parser::parse_intrinsic_prototype() -> Shared<IntrinsicPrototype>
 
     assert_kind(TokenKind::TOKEN_SEMICOLON, "Expect ; after external function declaration");
 
-    return std::make_shared<IntrinsicPrototype>(name, intrinsic_name, parameters, return_type,
-                                                has_varargs, varargs_type);
+    return create_node<IntrinsicPrototype>(name, intrinsic_name, parameters, return_type,
+                                           has_varargs, varargs_type);
 }
 
 auto amun::Parser::parse_function_prototype(amun::FunctionKind kind, bool is_external)
-    -> Shared<FunctionPrototype>
+    -> FunctionPrototype*
 {
     if (is_external) {
         assert_kind(TokenKind::TOKEN_IDENTIFIER, "Expect external keyword");
@@ -483,7 +504,7 @@ auto amun::Parser::parse_function_prototype(amun::FunctionKind kind, bool is_ext
         while (is_source_available() && !is_current_kind(TokenKind::TOKEN_GREATER)) {
             auto parameter = consume_kind(TokenKind::TOKEN_IDENTIFIER, "Expect parameter name");
             check_generic_parameter_name(parameter);
-            generics_parameters.push_back(parameter.literal);
+            generics_parameters.push_back(std::string(parameter.literal));
             if (is_current_kind(TokenKind::TOKEN_COMMA)) {
                 advanced_token();
             }
@@ -496,21 +517,21 @@ auto amun::Parser::parse_function_prototype(amun::FunctionKind kind, bool is_ext
     }
 
     bool has_varargs = false;
-    Shared<amun::Type> varargs_type = nullptr;
-    std::vector<Shared<Parameter>> parameters;
+    amun::Type* varargs_type = nullptr;
+    std::vector<Parameter*> parameters;
     if (is_current_kind(TokenKind::TOKEN_OPEN_PAREN)) {
         advanced_token();
         while (is_source_available() && not is_current_kind(TokenKind::TOKEN_CLOSE_PAREN)) {
             if (has_varargs) {
                 context->diagnostics.report_error(
-                    previous_token->position, "Varargs must be the last parameter in the function");
+                    peek_previous().position, "Varargs must be the last parameter in the function");
                 throw "Stop";
             }
 
             if (is_current_kind(TokenKind::TOKEN_VARARGS)) {
                 advanced_token();
                 if (is_current_kind(TokenKind::TOKEN_IDENTIFIER) &&
-                    current_token->literal == "Any") {
+                    tokens.literal(current_token_index) == "Any") {
                     advanced_token();
                 }
                 else {
@@ -535,11 +556,11 @@ auto amun::Parser::parse_function_prototype(amun::FunctionKind kind, bool is_ext
     check_function_kind_paramters_count(kind, parameters_size, name.position);
 
     // Register current function declaration kind
-    context->functions[name.literal] = kind;
+    context->functions[std::string(name.literal)] = kind;
 
     // If function prototype has no explicit return type,
     // make return type to be void
-    Shared<amun::Type> return_type;
+    amun::Type* return_type;
     if (is_current_kind(TokenKind::TOKEN_SEMICOLON) ||
         is_current_kind(TokenKind::TOKEN_OPEN_BRACE)) {
         return_type = amun::void_type;
@@ -577,13 +598,12 @@ auto amun::Parser::parse_function_prototype(amun::FunctionKind kind, bool is_ext
         }
     }
 
-    return std::make_shared<FunctionPrototype>(name, parameters, return_type, is_external,
-                                               has_varargs, varargs_type, is_generic_function,
-                                               generics_parameters);
+    return create_node<FunctionPrototype>(name, parameters, return_type, is_external,
+                                          has_varargs, varargs_type, is_generic_function,
+                                          generics_parameters);
 }
 
-auto amun::Parser::parse_function_declaration(amun::FunctionKind kind)
-    -> Shared<FunctionDeclaration>
+auto amun::Parser::parse_function_declaration(amun::FunctionKind kind) -> FunctionDeclaration*
 {
     auto parent_node_scope = current_ast_scope;
     current_ast_scope = amun::AstNodeScope::FUNCTION_SCOPE;
@@ -594,12 +614,12 @@ auto amun::Parser::parse_function_declaration(amun::FunctionKind kind)
     if (is_current_kind(TokenKind::TOKEN_EQUAL)) {
         auto equal_token = peek_and_advance_token();
         auto value = parse_expression();
-        auto return_statement = std::make_shared<ReturnStatement>(equal_token, value, true);
+        auto return_statement = create_node<ReturnStatement>(equal_token, value, true);
         assert_kind(TokenKind::TOKEN_SEMICOLON, "Expect ; after function value");
         current_ast_scope = parent_node_scope;
         context->constants_table_map.pop_current_scope();
         generic_parameters_names.clear();
-        return std::make_shared<FunctionDeclaration>(prototype, return_statement);
+        return create_node<FunctionDeclaration>(prototype, return_statement);
     }
 
     if (is_current_kind(TokenKind::TOKEN_OPEN_BRACE)) {
@@ -615,14 +635,14 @@ auto amun::Parser::parse_function_declaration(amun::FunctionKind kind)
         if (amun::is_void_type(prototype->return_type) &&
             (block->statements.empty() ||
              block->statements.back()->get_ast_node_type() != AstNodeType::AST_RETURN)) {
-            auto void_return = std::make_shared<ReturnStatement>(close_brace, nullptr, false);
+            auto void_return = create_node<ReturnStatement>(close_brace, nullptr, false);
             block->statements.push_back(void_return);
         }
 
         current_ast_scope = parent_node_scope;
         context->constants_table_map.pop_current_scope();
         generic_parameters_names.clear();
-        return std::make_shared<FunctionDeclaration>(prototype, block);
+        return create_node<FunctionDeclaration>(prototype, block);
     }
 
     auto posiiton = peek_previous().position;
@@ -632,7 +652,7 @@ auto amun::Parser::parse_function_declaration(amun::FunctionKind kind)
 }
 
 auto amun::Parser::parse_operator_function_declaraion(amun::FunctionKind kind)
-    -> Shared<OperatorFunctionDeclaraion>
+    -> OperatorFunctionDeclaraion*
 {
     auto parent_node_scope = current_ast_scope;
     current_ast_scope = amun::AstNodeScope::FUNCTION_SCOPE;
@@ -642,8 +662,8 @@ auto amun::Parser::parse_operator_function_declaraion(amun::FunctionKind kind)
     auto position = operator_keyword.position;
     auto operator_token = parse_operator_function_operator(kind);
 
-    std::vector<Shared<Parameter>> parameters;
-    std::vector<Shared<amun::Type>> parameters_types;
+    std::vector<Parameter*> parameters;
+    std::vector<amun::Type*> parameters_types;
     if (is_current_kind(TokenKind::TOKEN_OPEN_PAREN)) {
         advanced_token();
         while (is_source_available() && not is_current_kind(TokenKind::TOKEN_CLOSE_PAREN)) {
@@ -671,9 +691,10 @@ auto amun::Parser::parse_operator_function_declaraion(amun::FunctionKind kind)
     }
 
     auto mangled_name = prefix + mangle_operator_function(operator_token.kind, parameters_types);
-    Token name = {TokenKind::TOKEN_IDENTIFIER, operator_token.position, mangled_name};
+    Token name = {TokenKind::TOKEN_IDENTIFIER, operator_token.position,
+                  context->source_manager.save_literal(mangled_name)};
 
-    Shared<amun::Type> return_type;
+    amun::Type* return_type;
     if (is_current_kind(TokenKind::TOKEN_SEMICOLON) ||
         is_current_kind(TokenKind::TOKEN_OPEN_BRACE)) {
         return_type = amun::void_type;
@@ -682,17 +703,17 @@ auto amun::Parser::parse_operator_function_declaraion(amun::FunctionKind kind)
         return_type = parse_type();
     }
 
-    auto prototype = std::make_shared<FunctionPrototype>(name, parameters, return_type);
+    auto prototype = create_node<FunctionPrototype>(name, parameters, return_type);
 
     if (is_current_kind(TokenKind::TOKEN_EQUAL)) {
         auto equal_token = peek_and_advance_token();
         auto value = parse_expression();
-        auto return_statement = std::make_shared<ReturnStatement>(equal_token, value, true);
+        auto return_statement = create_node<ReturnStatement>(equal_token, value, true);
         assert_kind(TokenKind::TOKEN_SEMICOLON, "Expect ; after function value");
         current_ast_scope = parent_node_scope;
         context->constants_table_map.pop_current_scope();
-        auto declaration = std::make_shared<FunctionDeclaration>(prototype, return_statement);
-        return std::make_shared<OperatorFunctionDeclaraion>(operator_token, declaration);
+        auto declaration = create_node<FunctionDeclaration>(prototype, return_statement);
+        return create_node<OperatorFunctionDeclaraion>(operator_token, declaration);
     }
 
     if (is_current_kind(TokenKind::TOKEN_OPEN_BRACE)) {
@@ -702,21 +723,20 @@ auto amun::Parser::parse_operator_function_declaraion(amun::FunctionKind kind)
         check_unnecessary_semicolon_warning();
 
         loop_levels_stack.pop();
-        auto close_brace = previous_token;
+        auto close_brace = peek_previous();
 
         // If function return type is void and has no return at the end, emit one
         if (amun::is_void_type(prototype->return_type) &&
             (block->statements.empty() ||
              block->statements.back()->get_ast_node_type() != AstNodeType::AST_RETURN)) {
-            auto void_return =
-                std::make_shared<ReturnStatement>(close_brace.value(), nullptr, false);
+            auto void_return = create_node<ReturnStatement>(close_brace, nullptr, false);
             block->statements.push_back(void_return);
         }
 
         current_ast_scope = parent_node_scope;
         context->constants_table_map.pop_current_scope();
-        auto declaration = std::make_shared<FunctionDeclaration>(prototype, block);
-        return std::make_shared<OperatorFunctionDeclaraion>(operator_token, declaration);
+        auto declaration = create_node<FunctionDeclaration>(prototype, block);
+        return create_node<OperatorFunctionDeclaraion>(operator_token, declaration);
     }
 
     context->diagnostics.report_error(
@@ -763,12 +783,11 @@ auto amun::Parser::parse_operator_function_operator(amun::FunctionKind kind) ->
     return op;
 }
 
-auto amun::Parser::parse_structure_declaration(bool is_packed, bool is_extern)
-    -> Shared<StructDeclaration>
+auto amun::Parser::parse_structure_declaration(bool is_packed, bool is_extern) -> StructDeclaration*
 {
-    auto struct_token = consume_kind(TokenKind::TOKEN_STRUCT, "Expect struct keyword");
+    assert_kind(TokenKind::TOKEN_STRUCT, "Expect struct keyword");
     auto struct_name = consume_kind(TokenKind::TOKEN_IDENTIFIER, "Expect Symbol as struct name");
-    auto struct_name_str = struct_name.literal;
+    auto struct_name_str = std::string(struct_name.literal);
 
     // Make sure this name is unique
     if (context->structures.contains(struct_name_str)) {
@@ -787,20 +806,20 @@ auto amun::Parser::parse_structure_declaration(bool is_packed, bool is_extern)
     current_struct_name = struct_name.literal;
 
     std::vector<std::string> fields_names;
-    std::vector<Shared<amun::Type>> fields_types;
+    std::vector<amun::Type*> fields_types;
 
     if (is_extern) {
         assert_kind(TokenKind::TOKEN_SEMICOLON, "Expect `;` at the end of external struct");
 
-        auto structure_type =
-            std::make_shared<amun::StructType>(struct_name_str, fields_names, fields_types);
+        auto structure_type = context->type_context.create<amun::StructType>(
+            struct_name_str, fields_names, fields_types);
         structure_type->is_extern = true;
 
         context->structures[struct_name_str] = structure_type;
         context->type_alias_table.define_alias(struct_name_str, structure_type);
         current_struct_name = "";
         generic_parameters_names.clear();
-        return std::make_shared<StructDeclaration>(structure_type);
+        return create_node<StructDeclaration>(structure_type);
     }
 
     std::vector<std::string> generics_parameters;
@@ -812,7 +831,7 @@ auto amun::Parser::parse_structure_declaration(bool is_packed, bool is_extern)
         while (is_source_available() && !is_current_kind(TokenKind::TOKEN_GREATER)) {
             auto parameter = consume_kind(TokenKind::TOKEN_IDENTIFIER, "Expect parameter name");
             check_generic_parameter_name(parameter);
-            generics_parameters.push_back(parameter.literal);
+            generics_parameters.push_back(std::string(parameter.literal));
             if (is_current_kind(TokenKind::TOKEN_COMMA)) {
                 advanced_token();
             }
@@ -827,14 +846,14 @@ auto amun::Parser::parse_structure_declaration(bool is_packed, bool is_extern)
     while (is_source_available() && !is_current_kind(TokenKind::TOKEN_CLOSE_BRACE)) {
         auto field_name = consume_kind(TokenKind::TOKEN_IDENTIFIER, "Expect Symbol as struct name");
 
-        if (is_contains(fields_names, field_name.literal)) {
+        if (is_contains(fields_names, std::string(field_name.literal))) {
             context->diagnostics.report_error(field_name.position,
                                               "There is already struct member with name " +
-                                                  field_name.literal);
+                                                  std::string(field_name.literal));
             throw "Stop";
         }
 
-        fields_names.push_back(field_name.literal);
+        fields_names.push_back(std::string(field_name.literal));
         auto field_type = parse_type();
 
         // Handle Incomplete field type case
@@ -854,9 +873,9 @@ auto amun::Parser::parse_structure_declaration(bool is_packed, bool is_extern)
 
     check_unnecessary_semicolon_warning();
 
-    auto structure_type =
-        std::make_shared<amun::StructType>(struct_name_str, fields_names, fields_types,
-                                           generics_parameters, is_packed, is_generic_struct);
+    auto structure_type = context->type_context.create<amun::StructType>(
+        struct_name_str, fields_names, fields_types, generics_parameters, is_packed,
+        is_generic_struct);
 
     // Resolve un solved types
     // This code will executed only if there are field with type of pointer to the current struct
@@ -864,7 +883,7 @@ auto amun::Parser::parse_structure_declaration(bool is_packed, bool is_extern)
     // Now we replace it with pointer to current struct type after it created
     if (current_struct_unknown_fields > 0) {
         // Pointer to current struct type
-        auto struct_pointer_ty = std::make_shared<amun::PointerType>(structure_type);
+        auto struct_pointer_ty = context->type_context.pointer_type(structure_type);
 
         const auto fields_size = fields_types.size();
         for (size_t i = 0; i < fields_size; i++) {
@@ -879,15 +898,15 @@ auto amun::Parser::parse_structure_declaration(bool is_packed, bool is_extern)
     context->type_alias_table.define_alias(struct_name_str, structure_type);
     current_struct_name = "";
     generic_parameters_names.clear();
-    return std::make_shared<StructDeclaration>(structure_type);
+    return create_node<StructDeclaration>(structure_type);
 }
 
-auto amun::Parser::parse_enum_declaration() -> Shared<EnumDeclaration>
+auto amun::Parser::parse_enum_declaration() -> EnumDeclaration*
 {
-    auto enum_token = consume_kind(TokenKind::TOKEN_ENUM, "Expect enum keyword");
+    assert_kind(TokenKind::TOKEN_ENUM, "Expect enum keyword");
     auto enum_name = consume_kind(TokenKind::TOKEN_IDENTIFIER, "Expect Symbol as enum name");
 
-    Shared<amun::Type> element_type = nullptr;
+    amun::Type* element_type = nullptr;
 
     if (is_current_kind(TokenKind::TOKEN_COLON)) {
         advanced_token();
@@ -908,7 +927,7 @@ auto amun::Parser::parse_enum_declaration() -> Shared<EnumDeclaration>
     while (is_source_available() && !is_current_kind(TokenKind::TOKEN_CLOSE_BRACE)) {
         auto enum_value = consume_kind(TokenKind::TOKEN_IDENTIFIER, "Expect Symbol as enum value");
         enum_values.push_back(enum_value);
-        auto enum_field_literal = enum_value.literal;
+        auto enum_field_literal = std::string(enum_value.literal);
 
         if (enum_values_indexes.contains(enum_field_literal)) {
             context->diagnostics.report_error(enum_value.position,
@@ -925,7 +944,7 @@ auto amun::Parser::parse_enum_declaration() -> Shared<EnumDeclaration>
                 throw "Stop";
             }
 
-            auto number_expr = std::dynamic_pointer_cast<NumberExpression>(field_value);
+            auto number_expr = dynamic_cast<NumberExpression*>(field_value);
             auto number_value_token = number_expr->value;
             if (is_float_number_token(number_value_token)) {
                 context->diagnostics.report_error(
@@ -934,7 +953,7 @@ auto amun::Parser::parse_enum_declaration() -> Shared<EnumDeclaration>
                 throw "Stop";
             }
 
-            auto explicit_value = std::stoi(number_value_token.literal);
+            auto explicit_value = std::stoi(std::string(number_value_token.literal));
             if (explicit_values.contains(explicit_value)) {
                 context->diagnostics.report_error(
                     enum_value.position, "There is also one enum field with explicit value " +
@@ -965,55 +984,56 @@ auto amun::Parser::parse_enum_declaration() -> Shared<EnumDeclaration>
 
     check_unnecessary_semicolon_warning();
 
-    auto enum_type = std::make_shared<amun::EnumType>(enum_name, enum_values_indexes, element_type);
-    context->enumerations[enum_name.literal] = enum_type;
-    return std::make_shared<EnumDeclaration>(enum_name, enum_type);
+    auto enum_type = context->type_context.create<amun::EnumType>(enum_name, enum_values_indexes,
+                                                                  element_type);
+    context->enumerations[std::string(enum_name.literal)] = enum_type;
+    return create_node<EnumDeclaration>(enum_name, enum_type);
 }
 
-auto amun::Parser::parse_parameter() -> Shared<Parameter>
+auto amun::Parser::parse_parameter() -> Parameter*
 {
     Token name = consume_kind(TokenKind::TOKEN_IDENTIFIER, "Expect identifier as parameter name.");
     auto type = parse_type();
-    return std::make_shared<Parameter>(name, type);
+    return create_node<Parameter>(name, type);
 }
 
-auto amun::Parser::parse_block_statement() -> Shared<BlockStatement>
+auto amun::Parser::parse_block_statement() -> BlockStatement*
 {
     consume_kind(TokenKind::TOKEN_OPEN_BRACE, "Expect { on the start of block.");
-    std::vector<Shared<Statement>> statements;
+    std::vector<Statement*> statements;
     while (is_source_available() && !is_current_kind(TokenKind::TOKEN_CLOSE_BRACE)) {
         statements.push_back(parse_statement());
     }
     consume_kind(TokenKind::TOKEN_CLOSE_BRACE, "Expect } on the end of block.");
-    return std::make_shared<BlockStatement>(statements);
+    return create_node<BlockStatement>(statements);
 }
 
-auto amun::Parser::parse_return_statement() -> Shared<ReturnStatement>
+auto amun::Parser::parse_return_statement() -> ReturnStatement*
 {
     auto keyword = consume_kind(TokenKind::TOKEN_RETURN, "Expect return keyword.");
     if (is_current_kind(TokenKind::TOKEN_SEMICOLON)) {
         assert_kind(TokenKind::TOKEN_SEMICOLON, "Expect semicolon `;` after return keyword");
-        return std::make_shared<ReturnStatement>(keyword, nullptr, false);
+        return create_node<ReturnStatement>(keyword, nullptr, false);
     }
     auto value = parse_expression();
     assert_kind(TokenKind::TOKEN_SEMICOLON, "Expect semicolon `;` after return statement");
-    return std::make_shared<ReturnStatement>(keyword, value, true);
+    return create_node<ReturnStatement>(keyword, value, true);
 }
 
-auto amun::Parser::parse_defer_statement() -> Shared<DeferStatement>
+auto amun::Parser::parse_defer_statement() -> DeferStatement*
 {
     auto defer_token = consume_kind(TokenKind::TOKEN_DEFER, "Expect Defer keyword.");
     auto expression = parse_expression();
-    if (auto call_expression = std::dynamic_pointer_cast<CallExpression>(expression)) {
+    if (auto call_expression = dynamic_cast<CallExpression*>(expression)) {
         assert_kind(TokenKind::TOKEN_SEMICOLON, "Expect semicolon `;` after defer call statement");
-        return std::make_shared<DeferStatement>(call_expression);
+        return create_node<DeferStatement>(call_expression);
     }
 
     context->diagnostics.report_error(defer_token.position, "defer keyword expect call expression");
     throw "Stop";
 }
 
-auto amun::Parser::parse_break_statement() -> Shared<BreakStatement>
+auto amun::Parser::parse_break_statement() -> BreakStatement*
 {
     auto break_token = consume_kind(TokenKind::TOKEN_BREAK, "Expect break keyword.");
 
@@ -1025,11 +1045,11 @@ auto amun::Parser::parse_break_statement() -> Shared<BreakStatement>
 
     if (is_current_kind(TokenKind::TOKEN_SEMICOLON)) {
         assert_kind(TokenKind::TOKEN_SEMICOLON, "Expect semicolon `;` after break call statement");
-        return std::make_shared<BreakStatement>(break_token, false, 1);
+        return create_node<BreakStatement>(break_token, false, 1);
     }
 
     auto break_times = parse_expression();
-    if (auto number_expr = std::dynamic_pointer_cast<NumberExpression>(break_times)) {
+    if (auto number_expr = dynamic_cast<NumberExpression*>(break_times)) {
         auto number_value = number_expr->value;
         if (is_float_number_token(number_value)) {
             context->diagnostics.report_error(
@@ -1038,7 +1058,7 @@ auto amun::Parser::parse_break_statement() -> Shared<BreakStatement>
             throw "Stop";
         }
 
-        int times_int = std::stoi(number_value.literal);
+        int times_int = std::stoi(std::string(number_value.literal));
         if (times_int < 1) {
             context->diagnostics.report_error(
                 break_token.position, "expect break times must be positive value and at last 1");
@@ -1054,14 +1074,14 @@ auto amun::Parser::parse_break_statement() -> Shared<BreakStatement>
         }
 
         assert_kind(TokenKind::TOKEN_SEMICOLON, "Expect semicolon `;` after brea statement");
-        return std::make_shared<BreakStatement>(break_token, true, times_int);
+        return create_node<BreakStatement>(break_token, true, times_int);
     }
 
     context->diagnostics.report_error(break_token.position, "break keyword times must be a number");
     throw "Stop";
 }
 
-auto amun::Parser::parse_continue_statement() -> Shared<ContinueStatement>
+auto amun::Parser::parse_continue_statement() -> ContinueStatement*
 {
     auto continue_token = consume_kind(TokenKind::TOKEN_CONTINUE, "Expect continue keyword.");
 
@@ -1074,11 +1094,11 @@ auto amun::Parser::parse_continue_statement() -> Shared<ContinueStatement>
 
     if (is_current_kind(TokenKind::TOKEN_SEMICOLON)) {
         assert_kind(TokenKind::TOKEN_SEMICOLON, "Expect semicolon `;` after defer call statement");
-        return std::make_shared<ContinueStatement>(continue_token, false, 1);
+        return create_node<ContinueStatement>(continue_token, false, 1);
     }
 
     auto continue_times = parse_expression();
-    if (auto number_expr = std::dynamic_pointer_cast<NumberExpression>(continue_times)) {
+    if (auto number_expr = dynamic_cast<NumberExpression*>(continue_times)) {
         auto number_value = number_expr->value;
         auto number_kind = number_value.kind;
         if (number_kind == TokenKind::TOKEN_FLOAT or number_kind == TokenKind::TOKEN_FLOAT32 or
@@ -1090,7 +1110,7 @@ auto amun::Parser::parse_continue_statement() -> Shared<ContinueStatement>
             throw "Stop";
         }
 
-        int times_int = std::stoi(number_value.literal);
+        int times_int = std::stoi(std::string(number_value.literal));
         if (times_int < 1) {
             context->diagnostics.report_error(
                 continue_token.position,
@@ -1108,7 +1128,7 @@ auto amun::Parser::parse_continue_statement() -> Shared<ContinueStatement>
         }
 
         assert_kind(TokenKind::TOKEN_SEMICOLON, "Expect semicolon `;` after brea statement");
-        return std::make_shared<ContinueStatement>(continue_token, true, times_int);
+        return create_node<ContinueStatement>(continue_token, true, times_int);
     }
 
     context->diagnostics.report_error(continue_token.position,
@@ -1116,7 +1136,7 @@ auto amun::Parser::parse_continue_statement() -> Shared<ContinueStatement>
     throw "Stop";
 }
 
-auto amun::Parser::parse_if_statement() -> Shared<IfStatement>
+auto amun::Parser::parse_if_statement() -> IfStatement*
 {
     auto parent_node_scope = current_ast_scope;
     current_ast_scope = amun::AstNodeScope::CONDITION_SCOPE;
@@ -1126,8 +1146,8 @@ auto amun::Parser::parse_if_statement() -> Shared<IfStatement>
     auto condition = parse_expression();
     assert_kind(TokenKind::TOKEN_CLOSE_PAREN, "Expect ) after if condition");
     auto then_block = parse_statement();
-    auto conditional_block = std::make_shared<ConditionalBlock>(if_token, condition, then_block);
-    std::vector<Shared<ConditionalBlock>> conditional_blocks;
+    auto conditional_block = create_node<ConditionalBlock>(if_token, condition, then_block);
+    std::vector<ConditionalBlock*> conditional_blocks;
     conditional_blocks.push_back(conditional_block);
 
     bool has_else_branch = false;
@@ -1138,7 +1158,7 @@ auto amun::Parser::parse_if_statement() -> Shared<IfStatement>
             auto elif_condition = parse_expression();
             auto elif_block = parse_statement();
             auto elif_condition_block =
-                std::make_shared<ConditionalBlock>(else_token, elif_condition, elif_block);
+                create_node<ConditionalBlock>(else_token, elif_condition, elif_block);
             conditional_blocks.push_back(elif_condition_block);
             continue;
         }
@@ -1151,18 +1171,18 @@ auto amun::Parser::parse_if_statement() -> Shared<IfStatement>
 
         auto true_value_token = else_token;
         true_value_token.kind = TokenKind::TOKEN_TRUE;
-        auto true_expression = std::make_shared<BooleanExpression>(true_value_token);
+        auto true_expression = create_node<BooleanExpression>(true_value_token);
         auto else_block = parse_statement();
         auto else_condition_block =
-            std::make_shared<ConditionalBlock>(else_token, true_expression, else_block);
+            create_node<ConditionalBlock>(else_token, true_expression, else_block);
         conditional_blocks.push_back(else_condition_block);
         has_else_branch = true;
     }
     current_ast_scope = parent_node_scope;
-    return std::make_shared<IfStatement>(conditional_blocks, has_else_branch);
+    return create_node<IfStatement>(conditional_blocks, has_else_branch);
 }
 
-auto amun::Parser::parse_for_statement() -> Shared<Statement>
+auto amun::Parser::parse_for_statement() -> Statement*
 {
     auto parent_node_scope = current_ast_scope;
     current_ast_scope = amun::AstNodeScope::CONDITION_SCOPE;
@@ -1175,7 +1195,7 @@ auto amun::Parser::parse_for_statement() -> Shared<Statement>
         auto body = parse_statement();
         loop_levels_stack.top() -= 1;
         current_ast_scope = parent_node_scope;
-        return std::make_shared<ForeverStatement>(keyword, body);
+        return create_node<ForeverStatement>(keyword, body);
     }
 
     assert_kind(TokenKind::TOKEN_OPEN_PAREN, "Expect ( before for names and collection");
@@ -1194,7 +1214,7 @@ auto amun::Parser::parse_for_statement() -> Shared<Statement>
         }
 
         if (is_current_kind(TokenKind::TOKEN_COMMA)) {
-            index_name = previous_token->literal;
+            index_name = tokens.literal(previous_token_index);
             has_custom_index_name = true;
 
             // Consume the comma
@@ -1203,7 +1223,7 @@ auto amun::Parser::parse_for_statement() -> Shared<Statement>
         }
         else {
             // Previous token is the LiteralExpression that contains variable name
-            element_name = previous_token->literal;
+            element_name = tokens.literal(previous_token_index);
         }
 
         assert_kind(TokenKind::TOKEN_COLON, "Expect `:` after element name in foreach");
@@ -1225,7 +1245,7 @@ auto amun::Parser::parse_for_statement() -> Shared<Statement>
 
         // If there is : after range the mean we have custom step expression
         // If not use nullptr as default value for step (Handled in the Backend)
-        Shared<Expression> step = nullptr;
+        Expression* step = nullptr;
         if (is_current_kind(TokenKind::TOKEN_COLON)) {
             advanced_token();
             step = parse_expression();
@@ -1239,8 +1259,7 @@ auto amun::Parser::parse_for_statement() -> Shared<Statement>
 
         current_ast_scope = parent_node_scope;
 
-        return std::make_shared<ForRangeStatement>(keyword, element_name, expr, range_end, step,
-                                                   body);
+        return create_node<ForRangeStatement>(keyword, element_name, expr, range_end, step, body);
     }
 
     assert_kind(TokenKind::TOKEN_CLOSE_PAREN, "Expect ) after for names and collection");
@@ -1252,10 +1271,10 @@ auto amun::Parser::parse_for_statement() -> Shared<Statement>
 
     current_ast_scope = parent_node_scope;
 
-    return std::make_shared<ForEachStatement>(keyword, element_name, index_name, expr, body);
+    return create_node<ForEachStatement>(keyword, element_name, index_name, expr, body);
 }
 
-auto amun::Parser::parse_while_statement() -> Shared<WhileStatement>
+auto amun::Parser::parse_while_statement() -> WhileStatement*
 {
     auto parent_node_scope = current_ast_scope;
     current_ast_scope = amun::AstNodeScope::CONDITION_SCOPE;
@@ -1271,10 +1290,10 @@ auto amun::Parser::parse_while_statement() -> Shared<WhileStatement>
     loop_levels_stack.top() -= 1;
 
     current_ast_scope = parent_node_scope;
-    return std::make_shared<WhileStatement>(keyword, condition, body);
+    return create_node<WhileStatement>(keyword, condition, body);
 }
 
-auto amun::Parser::parse_switch_statement() -> Shared<SwitchStatement>
+auto amun::Parser::parse_switch_statement() -> SwitchStatement*
 {
     auto keyword = consume_kind(TokenKind::TOKEN_SWITCH, "Expect `switch` keyword.");
 
@@ -1284,11 +1303,11 @@ auto amun::Parser::parse_switch_statement() -> Shared<SwitchStatement>
     assert_kind(TokenKind::TOKEN_CLOSE_PAREN, "Expect ) after switch argument");
     assert_kind(TokenKind::TOKEN_OPEN_BRACE, "Expect { after switch value");
 
-    std::vector<Shared<SwitchCase>> switch_cases;
-    Shared<SwitchCase> default_branch = nullptr;
+    std::vector<SwitchCase*> switch_cases;
+    SwitchCase* default_branch = nullptr;
     bool has_default_case = false;
     while (is_source_available() and !is_current_kind(TokenKind::TOKEN_CLOSE_BRACE)) {
-        std::vector<Shared<Expression>> values;
+        std::vector<Expression*> values;
         if (is_current_kind(TokenKind::TOKEN_ELSE)) {
             if (has_default_case) {
                 context->diagnostics.report_error(
@@ -1301,7 +1320,7 @@ auto amun::Parser::parse_switch_statement() -> Shared<SwitchStatement>
                          "Expect -> after else keyword in switch default branch");
             auto default_body = parse_statement();
             values.push_back(argument);
-            default_branch = std::make_shared<SwitchCase>(else_keyword, values, default_body);
+            default_branch = create_node<SwitchCase>(else_keyword, values, default_body);
             has_default_case = true;
             continue;
         }
@@ -1317,7 +1336,7 @@ auto amun::Parser::parse_switch_statement() -> Shared<SwitchStatement>
         auto right_arrow =
             consume_kind(TokenKind::TOKEN_RIGHT_ARROW, "Expect -> after branch value");
         auto branch = parse_statement();
-        auto switch_case = std::make_shared<SwitchCase>(right_arrow, values, branch);
+        auto switch_case = create_node<SwitchCase>(right_arrow, values, branch);
         switch_cases.push_back(switch_case);
     }
 
@@ -1327,24 +1346,24 @@ auto amun::Parser::parse_switch_statement() -> Shared<SwitchStatement>
         switch_cases.push_back(default_branch);
     }
 
-    return std::make_shared<SwitchStatement>(keyword, argument, switch_cases, op, has_default_case);
+    return create_node<SwitchStatement>(keyword, argument, switch_cases, op, has_default_case);
 }
 
-auto amun::Parser::parse_expression_statement() -> Shared<ExpressionStatement>
+auto amun::Parser::parse_expression_statement() -> ExpressionStatement*
 {
     auto expression = parse_expression();
     assert_kind(TokenKind::TOKEN_SEMICOLON, "Expect semicolon `;` after field declaration");
-    return std::make_shared<ExpressionStatement>(expression);
+    return create_node<ExpressionStatement>(expression);
 }
 
-auto amun::Parser::parse_expression() -> Shared<Expression>
+auto amun::Parser::parse_expression() -> Expression*
 {
     return parse_assignment_expression();
 }
 
-auto amun::Parser::parse_assignment_expression() -> Shared<Expression>
+auto amun::Parser::parse_assignment_expression() -> Expression*
 {
-    auto expression = parse_logical_or_expression();
+    auto expression = parse_binary_expression(OperatorPrecedence::LOGICAL_OR);
     if (is_assignments_operator_token(peek_current())) {
         auto assignments_token = peek_and_advance_token();
 
@@ -1354,201 +1373,123 @@ auto amun::Parser::parse_assignment_expression() -> Shared<Expression>
         if (assignments_binary_operators.contains(assignments_token_kind)) {
             auto op_kind = assignments_binary_operators[assignments_token_kind];
             assignments_token.kind = op_kind;
-            auto binary = std::make_shared<BinaryExpression>(expression, assignments_token, rhs);
-            return std::make_shared<AssignExpression>(expression, assignments_token, binary);
+            auto binary = create_node<BinaryExpression>(expression, assignments_token, rhs);
+            return create_node<AssignExpression>(expression, assignments_token, binary);
         }
 
         if (assignments_bitwise_operators.contains(assignments_token_kind)) {
             auto op_kind = assignments_bitwise_operators[assignments_token_kind];
             assignments_token.kind = op_kind;
-            auto bitwise = std::make_shared<BitwiseExpression>(expression, assignments_token, rhs);
-            return std::make_shared<AssignExpression>(expression, assignments_token, bitwise);
+            auto bitwise = create_node<BitwiseExpression>(expression, assignments_token, rhs);
+            return create_node<AssignExpression>(expression, assignments_token, bitwise);
         }
 
         // Operator is equal `=`
-        return std::make_shared<AssignExpression>(expression, assignments_token, rhs);
-    }
-    return expression;
-}
-
-auto amun::Parser::parse_logical_or_expression() -> Shared<Expression>
-{
-    auto expression = parse_logical_and_expression();
-    while (is_current_kind(TokenKind::TOKEN_OR_OR)) {
-        auto or_token = peek_and_advance_token();
-        auto right = parse_logical_and_expression();
-        expression = std::make_shared<LogicalExpression>(expression, or_token, right);
-    }
-    return expression;
-}
-
-auto amun::Parser::parse_logical_and_expression() -> Shared<Expression>
-{
-    auto expression = parse_bitwise_and_expression();
-    while (is_current_kind(TokenKind::TOKEN_AND_AND)) {
-        auto and_token = peek_and_advance_token();
-        auto right = parse_bitwise_and_expression();
-        expression = std::make_shared<LogicalExpression>(expression, and_token, right);
+        return create_node<AssignExpression>(expression, assignments_token, rhs);
     }
     return expression;
 }
 
-auto amun::Parser::parse_bitwise_and_expression() -> Shared<Expression>
+auto amun::Parser::parse_binary_expression(OperatorPrecedence min_precedence) -> Expression*
 {
-    auto expression = parse_bitwise_xor_expression();
-    while (is_current_kind(TokenKind::TOKEN_AND)) {
-        auto and_token = peek_and_advance_token();
-        auto right = parse_bitwise_xor_expression();
-        expression = std::make_shared<BitwiseExpression>(expression, and_token, right);
-    }
-    return expression;
-}
-
-auto amun::Parser::parse_bitwise_xor_expression() -> Shared<Expression>
-{
-    auto expression = parse_bitwise_or_expression();
-    while (is_current_kind(TokenKind::TOKEN_XOR)) {
-        auto and_token = peek_and_advance_token();
-        auto right = parse_bitwise_or_expression();
-        expression = std::make_shared<BitwiseExpression>(expression, and_token, right);
-    }
-    return expression;
-}
-
-auto amun::Parser::parse_bitwise_or_expression() -> Shared<Expression>
-{
-    auto expression = parse_equality_expression();
-    while (is_current_kind(TokenKind::TOKEN_OR)) {
-        auto and_token = peek_and_advance_token();
-        auto right = parse_equality_expression();
-        expression = std::make_shared<BitwiseExpression>(expression, and_token, right);
-    }
-    return expression;
-}
-
-auto amun::Parser::parse_equality_expression() -> Shared<Expression>
-{
-    auto expression = parse_comparison_expression();
-    while (is_current_kind(TokenKind::TOKEN_EQUAL_EQUAL) ||
-           is_current_kind(TokenKind::TOKEN_BANG_EQUAL)) {
-        Token op = peek_and_advance_token();
-        auto right = parse_comparison_expression();
-        expression = std::make_shared<ComparisonExpression>(expression, op, right);
-    }
-    return expression;
-}
-
-auto amun::Parser::parse_comparison_expression() -> Shared<Expression>
-{
-    auto expression = parse_bitwise_shift_expression();
-    while (is_current_kind(TokenKind::TOKEN_GREATER) ||
-           is_current_kind(TokenKind::TOKEN_GREATER_EQUAL) ||
-           is_current_kind(TokenKind::TOKEN_SMALLER) ||
-           is_current_kind(TokenKind::TOKEN_SMALLER_EQUAL)) {
-
-        Token op = peek_and_advance_token();
-        auto right = parse_bitwise_shift_expression();
-
-        // If lhs is a comparison expression we can perform concatnation expression
-        // example: a < b < c
-        // Will be parsed as (a < b) logical and (b < c)
-        if (expression->get_ast_node_type() == AstNodeType::AST_COMPARISON) {
-            auto left_comprison = std::dynamic_pointer_cast<ComparisonExpression>(expression);
-            auto new_left = left_comprison->right;
-            auto comparison = std::make_shared<ComparisonExpression>(new_left, op, right);
-            Token logical_op = {
-                .kind = TokenKind::TOKEN_AND_AND,
-                .position = op.position,
-            };
-            expression = std::make_shared<LogicalExpression>(expression, logical_op, comparison);
-            continue;
-        }
-
-        expression = std::make_shared<ComparisonExpression>(expression, op, right);
-    }
-
-    return expression;
-}
-
-auto amun::Parser::parse_bitwise_shift_expression() -> Shared<Expression>
-{
-    auto expression = parse_term_expression();
+    auto expression = parse_enum_access_expression();
     while (true) {
-        if (is_current_kind(TokenKind::TOKEN_LEFT_SHIFT)) {
-            auto operator_token = peek_and_advance_token();
-            auto right = parse_term_expression();
-            expression = std::make_shared<BitwiseExpression>(expression, operator_token, right);
-            continue;
+        auto precedence = current_operator_precedence();
+        if (precedence == OperatorPrecedence::NONE || precedence < min_precedence) {
+            break;
         }
 
-        if (is_right_shift_operator(peek_current(), peek_next())) {
-            advanced_token();
-            auto operator_token = peek_and_advance_token();
+        auto operator_token = peek_and_advance_token();
+
+        // Right shift is two adjacent `>` tokens and the second token is the operator position
+        if (precedence == OperatorPrecedence::SHIFT &&
+            operator_token.kind == TokenKind::TOKEN_GREATER) {
+            operator_token = peek_and_advance_token();
             operator_token.kind = TokenKind::TOKEN_RIGHT_SHIFT;
-            auto right = parse_term_expression();
-            expression = std::make_shared<BitwiseExpression>(expression, operator_token, right);
-            continue;
         }
 
-        break;
-    }
-
-    return expression;
-}
-
-auto amun::Parser::parse_term_expression() -> Shared<Expression>
-{
-    auto expression = parse_factor_expression();
-    while (is_current_kind(TokenKind::TOKEN_PLUS) || is_current_kind(TokenKind::TOKEN_MINUS)) {
-        Token operator_token = peek_and_advance_token();
-        auto right = parse_factor_expression();
-        expression = std::make_shared<BinaryExpression>(expression, operator_token, right);
-    }
-    return expression;
-}
+        // All binary operators are left associative so the right side has higher precedence
+        auto higher_precedence = static_cast<OperatorPrecedence>(static_cast<int>(precedence) + 1);
+        auto right = parse_binary_expression(higher_precedence);
 
-auto amun::Parser::parse_factor_expression() -> Shared<Expression>
-{
-    auto expression = parse_enum_access_expression();
-    while (is_current_kind(TokenKind::TOKEN_STAR) || is_current_kind(TokenKind::TOKEN_SLASH) ||
-           is_current_kind(TokenKind::TOKEN_PERCENT)) {
-        Token operator_token = peek_and_advance_token();
-        auto right = parse_enum_access_expression();
-        expression = std::make_shared<BinaryExpression>(expression, operator_token, right);
+        switch (precedence) {
+        case OperatorPrecedence::LOGICAL_OR:
+        case OperatorPrecedence::LOGICAL_AND: {
+            expression = create_node<LogicalExpression>(expression, operator_token, right);
+            break;
+        }
+        case OperatorPrecedence::BITWISE_AND:
+        case OperatorPrecedence::BITWISE_XOR:
+        case OperatorPrecedence::BITWISE_OR:
+        case OperatorPrecedence::SHIFT: {
+            expression = create_node<BitwiseExpression>(expression, operator_token, right);
+            break;
+        }
+        case OperatorPrecedence::COMPARISON: {
+            // If lhs is a comparison expression we can perform concatnation expression
+            // example: a < b < c
+            // Will be parsed as (a < b) logical and (b < c)
+            if (expression->get_ast_node_type() == AstNodeType::AST_COMPARISON) {
+                auto left_comprison = dynamic_cast<ComparisonExpression*>(expression);
+                auto new_left = left_comprison->right;
+                auto comparison =
+                    create_node<ComparisonExpression>(new_left, operator_token, right);
+                Token logical_op = {
+                    .kind = TokenKind::TOKEN_AND_AND,
+                    .position = operator_token.position,
+                };
+                expression = create_node<LogicalExpression>(expression, logical_op, comparison);
+                break;
+            }
+            expression = create_node<ComparisonExpression>(expression, operator_token, right);
+            break;
+        }
+        case OperatorPrecedence::EQUALITY: {
+            expression = create_node<ComparisonExpression>(expression, operator_token, right);
+            break;
+        }
+        case OperatorPrecedence::TERM:
+        case OperatorPrecedence::FACTOR: {
+            expression = create_node<BinaryExpression>(expression, operator_token, right);
+            break;
+        }
+        case OperatorPrecedence::NONE: break;
+        }
     }
     return expression;
 }
 
-auto amun::Parser::parse_enum_access_expression() -> Shared<Expression>
+auto amun::Parser::parse_enum_access_expression() -> Expression*
 {
     auto expression = parse_infix_call_expression();
     if (is_current_kind(TokenKind::TOKEN_COLON_COLON)) {
         auto colons_token = peek_and_advance_token();
-        if (auto literal = std::dynamic_pointer_cast<LiteralExpression>(expression)) {
+        if (auto literal = dynamic_cast<LiteralExpression*>(expression)) {
             auto enum_name = literal->name;
-            if (context->enumerations.contains(enum_name.literal)) {
-                auto enum_type = context->enumerations[enum_name.literal];
+            if (context->enumerations.contains(std::string(enum_name.literal))) {
+                auto enum_type = context->enumerations[std::string(enum_name.literal)];
                 auto element = consume_kind(TokenKind::TOKEN_IDENTIFIER,
                                             "Expect identifier as enum field name");
 
                 auto enum_values = enum_type->values;
-                if (not enum_values.contains(element.literal)) {
+                if (not enum_values.contains(std::string(element.literal))) {
                     context->diagnostics.report_error(
-                        element.position, "Can't find element with name " + element.literal +
-                                              " in enum " + enum_name.literal);
+                        element.position, "Can't find element with name " +
+                                              std::string(element.literal) + " in enum " +
+                                              std::string(enum_name.literal));
                     throw "Stop";
                 }
 
-                int index = enum_values[element.literal];
-                auto enum_element_type = std::make_shared<amun::EnumElementType>(
-                    enum_name.literal, enum_type->element_type);
-                return std::make_shared<EnumAccessExpression>(enum_name, element, index,
-                                                              enum_element_type);
+                int index = enum_values[std::string(element.literal)];
+                auto enum_element_type = context->type_context.enum_element_type(
+                    std::string(enum_name.literal), enum_type->element_type);
+                return create_node<EnumAccessExpression>(enum_name, element, index,
+                                                         enum_element_type);
             }
             else {
                 context->diagnostics.report_error(enum_name.position,
                                                   "Can't find enum declaration with name " +
-                                                      enum_name.literal);
+                                                      std::string(enum_name.literal));
                 throw "Stop";
             }
         }
@@ -1561,70 +1502,60 @@ auto amun::Parser::parse_enum_access_expression() -> Shared<Expression>
     return expression;
 }
 
-auto amun::Parser::parse_infix_call_expression() -> Shared<Expression>
+auto amun::Parser::parse_infix_call_expression() -> Expression*
 {
     auto expression = parse_prefix_expression();
-    auto current_token_literal = peek_current().literal;
-
     // Parse Infix function call as a call expression
     if (is_current_kind(TokenKind::TOKEN_IDENTIFIER) and
-        is_function_declaration_kind(current_token_literal, amun::FunctionKind::INFIX_FUNCTION)) {
+        is_function_declaration_kind(tokens.literal(current_token_index),
+                                     amun::FunctionKind::INFIX_FUNCTION)) {
         auto name_token = peek_current();
         auto function_name = parse_literal_expression();
         auto generic_arguments = parse_generic_arguments_if_exists();
         auto arguments = {expression, parse_infix_call_expression()};
-        return std::make_shared<CallExpression>(name_token, function_name, arguments);
+        return create_node<CallExpression>(name_token, function_name, arguments);
     }
 
     return expression;
 }
 
-auto amun::Parser::parse_prefix_expression() -> Shared<Expression>
+auto amun::Parser::parse_prefix_expression() -> Expression*
 {
-    if (is_unary_operator_token(peek_current())) {
-        auto token = peek_and_advance_token();
-        auto right = parse_prefix_expression();
-        return std::make_shared<PrefixUnaryExpression>(token, right);
-    }
-
-    if (is_current_kind(TokenKind::TOKEN_PLUS_PLUS) or
+    if (is_unary_operator_token(peek_current()) || is_current_kind(TokenKind::TOKEN_PLUS_PLUS) ||
         is_current_kind(TokenKind::TOKEN_MINUS_MINUS)) {
         auto token = peek_and_advance_token();
         auto right = parse_prefix_expression();
-        return std::make_shared<PrefixUnaryExpression>(token, right);
+        return create_node<PrefixUnaryExpression>(token, right);
     }
 
-    return parse_prefix_call_expression();
-}
-
-auto amun::Parser::parse_prefix_call_expression() -> Shared<Expression>
-{
-    auto current_token_literal = peek_current().literal;
+    // Parse Prefix function call as a call expression
     if (is_current_kind(TokenKind::TOKEN_IDENTIFIER) and
-        is_function_declaration_kind(current_token_literal, amun::FunctionKind::PREFIX_FUNCTION)) {
+        is_function_declaration_kind(tokens.literal(current_token_index),
+                                     amun::FunctionKind::PREFIX_FUNCTION)) {
         auto token = peek_current();
         auto name = parse_literal_expression();
         auto generic_arguments = parse_generic_arguments_if_exists();
         auto arguments = {parse_prefix_expression()};
-        return std::make_shared<CallExpression>(token, name, arguments, generic_arguments);
+        return create_node<CallExpression>(token, name, arguments, generic_arguments);
     }
+
     return parse_postfix_increment_or_decrement();
 }
 
-auto amun::Parser::parse_postfix_increment_or_decrement() -> Shared<Expression>
+auto amun::Parser::parse_postfix_increment_or_decrement() -> Expression*
 {
     auto expression = parse_call_or_access_expression();
 
     if (is_current_kind(TokenKind::TOKEN_PLUS_PLUS) or
         is_current_kind(TokenKind::TOKEN_MINUS_MINUS)) {
         auto token = peek_and_advance_token();
-        return std::make_shared<PostfixUnaryExpression>(token, expression);
+        return create_node<PostfixUnaryExpression>(token, expression);
     }
 
     return expression;
 }
 
-auto amun::Parser::parse_call_or_access_expression() -> Shared<Expression>
+auto amun::Parser::parse_call_or_access_expression() -> Expression*
 {
     auto expression = parse_enumeration_attribute_expression();
     while (is_current_kind(TokenKind::TOKEN_DOT) || is_current_kind(TokenKind::TOKEN_OPEN_PAREN) ||
@@ -1640,7 +1571,7 @@ auto amun::Parser::parse_call_or_access_expression() -> Shared<Expression>
             if (is_current_kind(TokenKind::TOKEN_IDENTIFIER)) {
                 auto field_name =
                     consume_kind(TokenKind::TOKEN_IDENTIFIER, "Expect literal as field name");
-                expression = std::make_shared<DotExpression>(dot_token, expression, field_name);
+                expression = create_node<DotExpression>(dot_token, expression, field_name);
                 continue;
             }
 
@@ -1648,8 +1579,8 @@ auto amun::Parser::parse_call_or_access_expression() -> Shared<Expression>
             if (is_current_kind(TokenKind::TOKEN_INT)) {
                 auto field_name =
                     consume_kind(TokenKind::TOKEN_INT, "Expect literal as field name");
-                auto access = std::make_shared<DotExpression>(dot_token, expression, field_name);
-                access->field_index = str_to_int(field_name.literal.c_str());
+                auto access = create_node<DotExpression>(dot_token, expression, field_name);
+                access->field_index = str_to_int(std::string(field_name.literal).c_str());
                 expression = access;
                 continue;
             }
@@ -1662,9 +1593,9 @@ auto amun::Parser::parse_call_or_access_expression() -> Shared<Expression>
 
         // Parse function call expression with generic parameters
         if (is_current_kind(TokenKind::TOKEN_SMALLER)) {
-            auto literal = std::dynamic_pointer_cast<LiteralExpression>(expression);
+            auto literal = dynamic_cast<LiteralExpression*>(expression);
 
-            if (!context->functions.contains(literal->name.literal)) {
+            if (!context->functions.contains(std::string(literal->name.literal))) {
                 return expression;
             }
 
@@ -1673,7 +1604,7 @@ auto amun::Parser::parse_call_or_access_expression() -> Shared<Expression>
 
             assert_kind(TokenKind::TOKEN_OPEN_PAREN, "Expect ( after in the end of function call");
 
-            std::vector<Shared<Expression>> arguments;
+            std::vector<Expression*> arguments;
             while (not is_current_kind(TokenKind::TOKEN_CLOSE_PAREN)) {
                 arguments.push_back(parse_expression());
                 if (is_current_kind(TokenKind::TOKEN_COMMA)) {
@@ -1688,15 +1619,15 @@ auto amun::Parser::parse_call_or_access_expression() -> Shared<Expression>
                 arguments.push_back(parse_lambda_expression());
             }
 
-            expression = std::make_shared<CallExpression>(position, expression, arguments,
-                                                          generic_arguments);
+            expression = create_node<CallExpression>(position, expression, arguments,
+                                                     generic_arguments);
             continue;
         }
 
         // Parse function call expression
         if (is_current_kind(TokenKind::TOKEN_OPEN_PAREN)) {
             auto position = peek_and_advance_token();
-            std::vector<Shared<Expression>> arguments;
+            std::vector<Expression*> arguments;
             while (not is_current_kind(TokenKind::TOKEN_CLOSE_PAREN)) {
                 arguments.push_back(parse_expression());
                 if (is_current_kind(TokenKind::TOKEN_COMMA)) {
@@ -1712,7 +1643,7 @@ auto amun::Parser::parse_call_or_access_expression() -> Shared<Expression>
                 arguments.push_back(parse_lambda_expression());
             }
 
-            expression = std::make_shared<CallExpression>(position, expression, arguments);
+            expression = create_node<CallExpression>(position, expression, arguments);
             continue;
         }
 
@@ -1721,7 +1652,7 @@ auto amun::Parser::parse_call_or_access_expression() -> Shared<Expression>
             auto position = peek_and_advance_token();
             auto index = parse_expression();
             assert_kind(TokenKind::TOKEN_CLOSE_BRACKET, "Expect ] after index value");
-            expression = std::make_shared<IndexExpression>(position, expression, index);
+            expression = create_node<IndexExpression>(position, expression, index);
             continue;
         }
     }
@@ -1729,24 +1660,25 @@ auto amun::Parser::parse_call_or_access_expression() -> Shared<Expression>
     return expression;
 }
 
-auto amun::Parser::parse_enumeration_attribute_expression() -> Shared<Expression>
+auto amun::Parser::parse_enumeration_attribute_expression() -> Expression*
 {
     auto expression = parse_postfix_call_expression();
     if (is_current_kind(TokenKind::TOKEN_DOT) and
         expression->get_ast_node_type() == AstNodeType::AST_LITERAL) {
-        auto literal = std::dynamic_pointer_cast<LiteralExpression>(expression);
-        auto literal_str = literal->name.literal;
+        auto literal = dynamic_cast<LiteralExpression*>(expression);
+        auto literal_str = std::string(literal->name.literal);
         if (context->enumerations.contains(literal_str)) {
-            auto dot_token = peek_and_advance_token();
+            advanced_token();
             auto attribute =
                 consume_kind(TokenKind::TOKEN_IDENTIFIER, "Expect attribute name for enum");
             auto attribute_str = attribute.literal;
             if (attribute_str == "count") {
                 auto count = context->enumerations[literal_str]->values.size();
-                Token number_token = {TokenKind::TOKEN_INT, attribute.position,
-                                      std::to_string(count)};
+                Token number_token = {
+                    TokenKind::TOKEN_INT, attribute.position,
+                    context->source_manager.save_literal(std::to_string(count))};
                 auto number_type = amun::i64_type;
-                return std::make_shared<NumberExpression>(number_token, number_type);
+                return create_node<NumberExpression>(number_token, number_type);
             }
 
             context->diagnostics.report_error(attribute.position,
@@ -1757,28 +1689,28 @@ auto amun::Parser::parse_enumeration_attribute_expression() -> Shared<Expression
     return expression;
 }
 
-auto amun::Parser::parse_postfix_call_expression() -> Shared<Expression>
+auto amun::Parser::parse_postfix_call_expression() -> Expression*
 {
     auto expression = parse_initializer_expression();
-    auto current_token_literal = peek_current().literal;
-
     if (is_current_kind(TokenKind::TOKEN_IDENTIFIER) and
-        is_function_declaration_kind(current_token_literal, amun::FunctionKind::POSTFIX_FUNCTION)) {
+        is_function_declaration_kind(tokens.literal(current_token_index),
+                                     amun::FunctionKind::POSTFIX_FUNCTION)) {
         auto token = peek_current();
         auto name = parse_literal_expression();
         auto generic_arguments = parse_generic_arguments_if_exists();
         auto arguments = {expression};
-        return std::make_shared<CallExpression>(token, name, arguments, generic_arguments);
+        return create_node<CallExpression>(token, name, arguments, generic_arguments);
     }
 
     return expression;
 }
 
-auto amun::Parser::parse_initializer_expression() -> Shared<Expression>
+auto amun::Parser::parse_initializer_expression() -> Expression*
 {
     if (is_current_kind(TokenKind::TOKEN_IDENTIFIER) &&
-        context->type_alias_table.contains(current_token->literal)) {
-        auto resolved_type = context->type_alias_table.resolve_alias(current_token->literal);
+        context->type_alias_table.contains(std::string(tokens.literal(current_token_index)))) {
+        auto alias_name = std::string(tokens.literal(current_token_index));
+        auto resolved_type = context->type_alias_table.resolve_alias(alias_name);
         if (amun::is_struct_type(resolved_type) || amun::is_generic_struct_type(resolved_type)) {
             if (is_next_kind(TokenKind::TOKEN_OPEN_PAREN) ||
                 is_next_kind(TokenKind::TOKEN_OPEN_BRACE) ||
@@ -1786,7 +1718,7 @@ auto amun::Parser::parse_initializer_expression() -> Shared<Expression>
                 auto type = parse_type();
                 auto token = peek_current();
 
-                std::vector<std::shared_ptr<Expression>> arguments;
+                std::vector<Expression*> arguments;
 
                 // Check if this constructor has arguments
                 if (is_current_kind(TokenKind::TOKEN_OPEN_PAREN)) {
@@ -1810,7 +1742,7 @@ auto amun::Parser::parse_initializer_expression() -> Shared<Expression>
                     arguments.push_back(lambda_argument);
                 }
 
-                return std::make_shared<InitializeExpression>(token, type, arguments);
+                return create_node<InitializeExpression>(token, type, arguments);
             }
         }
     }
@@ -1818,24 +1750,25 @@ auto amun::Parser::parse_initializer_expression() -> Shared<Expression>
     return parse_function_call_with_lambda_argument();
 }
 
-auto amun::Parser::parse_function_call_with_lambda_argument() -> Shared<Expression>
+auto amun::Parser::parse_function_call_with_lambda_argument() -> Expression*
 {
     if (is_current_kind(TokenKind::TOKEN_IDENTIFIER) and
         is_next_kind(TokenKind::TOKEN_OPEN_BRACE) and
-        is_function_declaration_kind(current_token->literal, amun::FunctionKind::NORMAL_FUNCTION)) {
+        is_function_declaration_kind(tokens.literal(current_token_index),
+                                     amun::FunctionKind::NORMAL_FUNCTION)) {
         auto symbol_token = peek_current();
         auto literal = parse_literal_expression();
 
-        std::vector<Shared<Expression>> arguments;
+        std::vector<Expression*> arguments;
         arguments.push_back(parse_lambda_expression());
-        return std::make_shared<CallExpression>(symbol_token, literal, arguments);
+        return create_node<CallExpression>(symbol_token, literal, arguments);
     }
     return parse_primary_expression();
 }
 
-auto amun::Parser::parse_primary_expression() -> Shared<Expression>
+auto amun::Parser::parse_primary_expression() -> Expression*
 {
-    auto current_token_kind = peek_current().kind;
+    auto current_token_kind = tokens.kind(current_token_index);
     switch (current_token_kind) {
     case TokenKind::TOKEN_INT:
     case TokenKind::TOKEN_INT1:
@@ -1854,27 +1787,27 @@ auto amun::Parser::parse_primary_expression() -> Shared<Expression>
     }
     case TokenKind::TOKEN_CHARACTER: {
         advanced_token();
-        return std::make_shared<CharacterExpression>(peek_previous());
+        return create_node<CharacterExpression>(peek_previous());
     }
     case TokenKind::TOKEN_STRING: {
         advanced_token();
-        return std::make_shared<StringExpression>(peek_previous());
+        return create_node<StringExpression>(peek_previous());
     }
     case TokenKind::TOKEN_TRUE:
     case TokenKind::TOKEN_FALSE: {
         advanced_token();
-        return std::make_shared<BooleanExpression>(peek_previous());
+        return create_node<BooleanExpression>(peek_previous());
     }
     case TokenKind::TOKEN_NULL: {
         advanced_token();
-        return std::make_shared<NullExpression>(peek_previous());
+        return create_node<NullExpression>(peek_previous());
     }
     case TokenKind::TOKEN_IDENTIFIER: {
         // Resolve const or non const variable
         auto name = peek_current();
-        if (context->constants_table_map.is_defined(name.literal)) {
+        if (context->constants_table_map.is_defined(std::string(name.literal))) {
             advanced_token();
-            return context->constants_table_map.lookup(name.literal);
+            return context->constants_table_map.lookup(std::string(name.literal));
         }
         return parse_literal_expression();
     }
@@ -1914,13 +1847,13 @@ auto amun::Parser::parse_primary_expression() -> Shared<Expression>
     }
 }
 
-auto amun::Parser::parse_lambda_expression() -> Shared<LambdaExpression>
+auto amun::Parser::parse_lambda_expression() -> LambdaExpression*
 {
     auto open_paren =
         consume_kind(TokenKind::TOKEN_OPEN_BRACE, "Expect { at the start of lambda expression");
 
-    std::vector<Shared<Parameter>> parameters;
-    Shared<amun::Type> return_type;
+    std::vector<Parameter*> parameters;
+    amun::Type* return_type;
 
     if (is_current_kind(TokenKind::TOKEN_OPEN_PAREN)) {
         advanced_token();
@@ -1955,14 +1888,14 @@ auto amun::Parser::parse_lambda_expression() -> Shared<LambdaExpression>
     loop_levels_stack.push(0);
 
     // Parse lambda expression body
-    std::vector<Shared<Statement>> body;
+    std::vector<Statement*> body;
     while (not is_current_kind(TokenKind::TOKEN_CLOSE_BRACE)) {
         body.push_back(parse_statement());
     }
 
     loop_levels_stack.pop();
 
-    auto lambda_body = std::make_shared<BlockStatement>(body);
+    auto lambda_body = create_node<BlockStatement>(body);
 
     auto close_brace =
         consume_kind(TokenKind::TOKEN_CLOSE_BRACE, "Expect } at the end of lambda expression");
@@ -1971,31 +1904,35 @@ auto amun::Parser::parse_lambda_expression() -> Shared<LambdaExpression>
     // we can implicity insert return statement without value
     if (amun::is_void_type(return_type) &&
         (body.empty() || body.back()->get_ast_node_type() != AstNodeType::AST_RETURN)) {
-        auto void_return = std::make_shared<ReturnStatement>(close_brace, nullptr, false);
+        auto void_return = create_node<ReturnStatement>(close_brace, nullptr, false);
         lambda_body->statements.push_back(void_return);
     }
 
-    return std::make_shared<LambdaExpression>(open_paren, parameters, return_type, lambda_body);
+    // Lambda function type is completed by the type checker after resolving implicit parameters
+    auto function_type = context->type_context.function_type({}, return_type);
+    auto lambda_type = context->type_context.pointer_type(function_type);
+    return create_node<LambdaExpression>(open_paren, parameters, return_type, lambda_body,
+                                         lambda_type);
 }
 
-auto amun::Parser::parse_number_expression() -> Shared<NumberExpression>
+auto amun::Parser::parse_number_expression() -> NumberExpression*
 {
     auto number_token = peek_and_advance_token();
     auto number_kind = get_number_kind(number_token.kind);
-    auto number_type = std::make_shared<amun::NumberType>(number_kind);
-    return std::make_shared<NumberExpression>(number_token, number_type);
+    auto number_type = context->type_context.number_type(number_kind);
+    return create_node<NumberExpression>(number_token, number_type);
 }
 
-auto amun::Parser::parse_literal_expression() -> Shared<LiteralExpression>
+auto amun::Parser::parse_literal_expression() -> LiteralExpression*
 {
-    return std::make_shared<LiteralExpression>(peek_and_advance_token());
+    return create_node<LiteralExpression>(peek_and_advance_token());
 }
 
-auto amun::Parser::parse_if_expression() -> Shared<IfExpression>
+auto amun::Parser::parse_if_expression() -> IfExpression*
 {
     std::vector<Token> tokens;
-    std::vector<Shared<Expression>> conditions;
-    std::vector<Shared<Expression>> values;
+    std::vector<Expression*> conditions;
+    std::vector<Expression*> values;
     bool has_else_branch = false;
 
     tokens.push_back(peek_and_advance_token());
@@ -2037,7 +1974,7 @@ auto amun::Parser::parse_if_expression() -> Shared<IfExpression>
             .kind = TokenKind::TOKEN_TRUE,
             .position = peek_current().position,
         };
-        conditions.push_back(std::make_shared<BooleanExpression>(true_token));
+        conditions.push_back(create_node<BooleanExpression>(true_token));
         assert_kind(TokenKind::TOKEN_OPEN_BRACE,
                     "Expect { at the start of `else` expression value");
         values.push_back(parse_expression());
@@ -2045,10 +1982,10 @@ auto amun::Parser::parse_if_expression() -> Shared<IfExpression>
         has_else_branch = true;
     }
 
-    return std::make_shared<IfExpression>(tokens, conditions, values);
+    return create_node<IfExpression>(tokens, conditions, values);
 }
 
-auto amun::Parser::parse_switch_expression() -> Shared<SwitchExpression>
+auto amun::Parser::parse_switch_expression() -> SwitchExpression*
 {
     auto keyword = consume_kind(TokenKind::TOKEN_SWITCH, "Expect switch keyword.");
     assert_kind(TokenKind::TOKEN_OPEN_PAREN, "Expect ( before swich argument");
@@ -2056,9 +1993,9 @@ auto amun::Parser::parse_switch_expression() -> Shared<SwitchExpression>
     auto op = parse_switch_operator();
     assert_kind(TokenKind::TOKEN_CLOSE_PAREN, "Expect ) after swich argument");
     assert_kind(TokenKind::TOKEN_OPEN_BRACE, "Expect { after switch value");
-    std::vector<Shared<Expression>> cases;
-    std::vector<Shared<Expression>> values;
-    Shared<Expression> default_value;
+    std::vector<Expression*> cases;
+    std::vector<Expression*> values;
+    Expression* default_value = nullptr;
     bool has_default_branch = false;
     while (is_source_available() && !is_current_kind(TokenKind::TOKEN_CLOSE_BRACE)) {
         if (is_current_kind(TokenKind::TOKEN_ELSE)) {
@@ -2123,10 +2060,10 @@ auto amun::Parser::parse_switch_expression() -> Shared<SwitchExpression>
     }
 
     assert_kind(TokenKind::TOKEN_CLOSE_BRACE, "Expect } after switch Statement last branch");
-    return std::make_shared<SwitchExpression>(keyword, argument, cases, values, default_value, op);
+    return create_node<SwitchExpression>(keyword, argument, cases, values, default_value, op);
 }
 
-auto amun::Parser::parse_group_or_tuple_expression() -> Shared<Expression>
+auto amun::Parser::parse_group_or_tuple_expression() -> Expression*
 {
     assert_kind(TokenKind::TOKEN_OPEN_PAREN, "Expect ( at the start of group or tuple expression");
     auto expression = parse_expression();
@@ -2134,7 +2071,7 @@ auto amun::Parser::parse_group_or_tuple_expression() -> Shared<Expression>
     // Parse Tuple values expression
     if (is_current_kind(TokenKind::TOKEN_COMMA)) {
         auto token = peek_and_advance_token();
-        std::vector<Shared<Expression>> values;
+        std::vector<Expression*> values;
         values.push_back(expression);
 
         while (!is_current_kind(TokenKind::TOKEN_CLOSE_PAREN)) {
@@ -2145,17 +2082,17 @@ auto amun::Parser::parse_group_or_tuple_expression() -> Shared<Expression>
         }
 
         assert_kind(TokenKind::TOKEN_CLOSE_PAREN, "Expect ) at the end of tuple values expression");
-        return std::make_shared<TupleExpression>(token, values);
+        return create_node<TupleExpression>(token, values);
     }
 
     assert_kind(TokenKind::TOKEN_CLOSE_PAREN, "Expect ) at the end of group expression");
     return expression;
 }
 
-auto amun::Parser::parse_array_expression() -> Shared<ArrayExpression>
+auto amun::Parser::parse_array_expression() -> ArrayExpression*
 {
     Token position = peek_and_advance_token();
-    std::vector<Shared<Expression>> values;
+    std::vector<Expression*> values;
     while (is_source_available() && not is_current_kind(TOKEN_CLOSE_BRACKET)) {
         values.push_back(parse_expression());
         if (is_current_kind(TokenKind::TOKEN_COMMA)) {
@@ -2163,10 +2100,14 @@ auto amun::Parser::parse_array_expression() -> Shared<ArrayExpression>
         }
     }
     assert_kind(TokenKind::TOKEN_CLOSE_BRACKET, "Expect ] at the end of array values");
-    return std::make_shared<ArrayExpression>(position, values);
+
+    auto size = values.size();
+    auto element_type = size == 0 ? amun::none_type : values[0]->get_type_node();
+    auto array_type = context->type_context.static_array_type(element_type, size);
+    return create_node<ArrayExpression>(position, values, array_type);
 }
 
-auto amun::Parser::parse_cast_expression() -> Shared<CastExpression>
+auto amun::Parser::parse_cast_expression() -> CastExpression*
 {
     auto cast_keyword = consume_kind(TokenKind::TOKEN_CAST, "Expect cast keyword");
     assert_kind(TokenKind::TOKEN_OPEN_PAREN, "Expect `(` after cast keyword");
@@ -2177,44 +2118,44 @@ auto amun::Parser::parse_cast_expression() -> Shared<CastExpression>
         advanced_token();
         auto expression = parse_expression();
         assert_kind(TokenKind::TOKEN_CLOSE_PAREN, "Expect `)` after cast type");
-        return std::make_shared<CastExpression>(cast_keyword, target_type, expression);
+        return create_node<CastExpression>(cast_keyword, target_type, expression);
     }
 
     assert_kind(TokenKind::TOKEN_CLOSE_PAREN, "Expect `)` after cast type");
     auto expression = parse_expression();
-    return std::make_shared<CastExpression>(cast_keyword, target_type, expression);
+    return create_node<CastExpression>(cast_keyword, target_type, expression);
 }
 
-auto amun::Parser::parse_type_size_expression() -> Shared<TypeSizeExpression>
+auto amun::Parser::parse_type_size_expression() -> TypeSizeExpression*
 {
     assert_kind(TokenKind::TOKEN_TYPE_SIZE, "Expect type_size keyword");
     assert_kind(TokenKind::TOKEN_OPEN_PAREN, "Expect `(` after type_size keyword");
     auto type = parse_type();
     assert_kind(TokenKind::TOKEN_CLOSE_PAREN, "Expect `)` after type_size type");
-    return std::make_shared<TypeSizeExpression>(type);
+    return create_node<TypeSizeExpression>(type);
 }
 
-auto amun::Parser::parse_type_allign_expression() -> Shared<TypeAlignExpression>
+auto amun::Parser::parse_type_allign_expression() -> TypeAlignExpression*
 {
     assert_kind(TokenKind::TOKEN_TYPE_ALLIGN, "Expect type_size keyword");
     assert_kind(TokenKind::TOKEN_OPEN_PAREN, "Expect `(` after type_size keyword");
     auto type = parse_type();
     assert_kind(TokenKind::TOKEN_CLOSE_PAREN, "Expect `)` after type_size type");
-    return std::make_shared<TypeAlignExpression>(type);
+    return create_node<TypeAlignExpression>(type);
 }
 
-auto amun::Parser::parse_value_size_expression() -> Shared<ValueSizeExpression>
+auto amun::Parser::parse_value_size_expression() -> ValueSizeExpression*
 {
     assert_kind(TokenKind::TOKEN_VALUE_SIZE, "Expect value_size keyword");
     assert_kind(TokenKind::TOKEN_OPEN_PAREN, "Expect `(` after value_size keyword");
     auto value = parse_expression();
     assert_kind(TokenKind::TOKEN_CLOSE_PAREN, "Expect `)` after value_size type");
-    return std::make_shared<ValueSizeExpression>(value);
+    return create_node<ValueSizeExpression>(value);
 }
 
-auto amun::Parser::parse_generic_arguments_if_exists() -> std::vector<Shared<amun::Type>>
+auto amun::Parser::parse_generic_arguments_if_exists() -> std::vector<amun::Type*>
 {
-    std::vector<Shared<amun::Type>> generic_arguments;
+    std::vector<amun::Type*> generic_arguments;
     if (is_current_kind(TokenKind::TOKEN_SMALLER)) {
         advanced_token();
         while (!is_current_kind(TokenKind::TOKEN_GREATER)) {
@@ -2252,7 +2193,7 @@ auto amun::Parser::parse_switch_operator() -> TokenKind
 
 auto amun::Parser::check_generic_parameter_name(Token name) -> void
 {
-    auto literal = name.literal;
+    auto literal = std::string(name.literal);
     auto position = name.position;
 
     // Check that parameter name is not a built in primitive type
@@ -2310,7 +2251,7 @@ auto amun::Parser::check_function_kind_paramters_count(FunctionKind kind, int co
     }
 }
 
-auto amun::Parser::check_compiletime_constants_expression(Shared<Expression> expression,
+auto amun::Parser::check_compiletime_constants_expression(Expression* expression,
                                                           TokenSpan position) -> void
 {
     auto ast_node_type = expression->get_ast_node_type();
@@ -2323,7 +2264,7 @@ auto amun::Parser::check_compiletime_constants_expression(Shared<Expression> exp
 
     // Allow negative number and later should allow prefix unary with constants right
     if (ast_node_type == AstNodeType::AST_PREFIX_UNARY) {
-        auto prefix_unary = std::dynamic_pointer_cast<PrefixUnaryExpression>(expression);
+        auto prefix_unary = dynamic_cast<PrefixUnaryExpression*>(expression);
         if (prefix_unary->right->get_ast_node_type() == AstNodeType::AST_NUMBER &&
             prefix_unary->operator_token.kind == TokenKind::TOKEN_MINUS) {
             return;
@@ -2396,13 +2337,11 @@ auto amun::Parser::get_number_kind(TokenKind token) -> amun::NumberKind
     }
 }
 
-auto amun::Parser::is_function_declaration_kind(std::string& fun_name, amun::FunctionKind kind)
-    -> bool
+auto amun::Parser::is_function_declaration_kind(std::string_view fun_name,
+                                                amun::FunctionKind kind) -> bool
 {
-    if (context->functions.contains(fun_name)) {
-        return context->functions[fun_name] == kind;
-    }
-    return false;
+    auto function = context->functions.find(std::string(fun_name));
+    return function != context->functions.end() && function->second == kind;
 }
 
 auto amun::Parser::is_valid_intrinsic_name(std::string& name) -> bool
@@ -2418,56 +2357,56 @@ auto amun::Parser::is_valid_intrinsic_name(std::string& name) -> bool
     return true;
 }
 
-auto amun::Parser::resolve_field_self_reference(Shared<amun::Type> field_type,
-                                                Shared<amun::PointerType> current_struct_ptr_type)
-    -> Shared<amun::Type>
+auto amun::Parser::resolve_field_self_reference(amun::Type* field_type,
+                                                amun::PointerType* current_struct_ptr_type)
+    -> amun::Type*
 {
     // If Field type is pointer to none that mean it point to struct itself
     if (field_type->type_kind == TypeKind::POINTER) {
-        auto pointer_type = std::static_pointer_cast<amun::PointerType>(field_type);
+        auto pointer_type = static_cast<amun::PointerType*>(field_type);
         if (pointer_type->base_type->type_kind == TypeKind::NONE) {
             current_struct_unknown_fields--;
             return current_struct_ptr_type;
         }
-        pointer_type->base_type =
+        auto base_type =
             resolve_field_self_reference(pointer_type->base_type, current_struct_ptr_type);
-        return pointer_type;
+        return context->type_context.pointer_type(base_type);
     }
 
     // Update element type for Array type
     if (field_type->type_kind == TypeKind::STATIC_ARRAY) {
-        auto array_type = std::static_pointer_cast<amun::StaticArrayType>(field_type);
-        array_type->element_type =
+        auto array_type = static_cast<amun::StaticArrayType*>(field_type);
+        auto element_type =
             resolve_field_self_reference(array_type->element_type, current_struct_ptr_type);
-        return array_type;
+        return context->type_context.static_array_type(element_type, array_type->size);
     }
 
     // Update Arguments and return type for Function type
     if (field_type->type_kind == TypeKind::FUNCTION) {
-        auto function_type = std::static_pointer_cast<amun::FunctionType>(field_type);
+        auto function_type = static_cast<amun::FunctionType*>(field_type);
 
         // Resolve return type
-        function_type->return_type =
+        auto return_type =
             resolve_field_self_reference(function_type->return_type, current_struct_ptr_type);
 
         // Resolve parameters
-        auto size = function_type->parameters.size();
-        for (size_t i = 0; i < size; i++) {
-            function_type->parameters[i] =
-                resolve_field_self_reference(function_type->parameters[i], current_struct_ptr_type);
+        std::vector<amun::Type*> parameters;
+        parameters.reserve(function_type->parameters.size());
+        for (auto& parameter : function_type->parameters) {
+            parameters.push_back(resolve_field_self_reference(parameter, current_struct_ptr_type));
         }
 
-        return function_type;
+        return context->type_context.function_type(parameters, return_type);
     }
 
     if (field_type->type_kind == TypeKind::TUPLE) {
-        auto tuple_type = std::static_pointer_cast<amun::TupleType>(field_type);
-        auto fields_size = tuple_type->fields_types.size();
-        for (size_t i = 0; i < fields_size; i++) {
-            tuple_type->fields_types[i] =
-                resolve_field_self_reference(tuple_type->fields_types[i], current_struct_ptr_type);
+        auto tuple_type = static_cast<amun::TupleType*>(field_type);
+        std::vector<amun::Type*> fields_types;
+        fields_types.reserve(tuple_type->fields_types.size());
+        for (auto& field : tuple_type->fields_types) {
+            fields_types.push_back(resolve_field_self_reference(field, current_struct_ptr_type));
         }
-        return tuple_type;
+        return context->type_context.tuple_type(fields_types);
     }
 
     return field_type;
@@ -2475,17 +2414,19 @@ auto amun::Parser::resolve_field_self_reference(Shared<amun::Type> field_type,
 
 auto amun::Parser::advanced_token() -> void
 {
-    auto scanned_token = tokenizer.scan_next_token();
+    previous_token_index = current_token_index;
+    current_token_index = next_token_index;
+
+    // Tokens buffer ends with end of file or invalid token so next index stops at the last token
+    next_token_index = std::min<int64>(next_token_index + 1, tokens.size() - 1);
 
     // Check if this token is an error from tokenizer
-    if (scanned_token.kind == TokenKind::TOKEN_INVALID) {
-        context->diagnostics.report_error(scanned_token.position, scanned_token.literal);
+    if (tokens.kind(next_token_index) == TokenKind::TOKEN_INVALID) {
+        auto invalid_token = tokens.token(next_token_index);
+        context->diagnostics.report_error(invalid_token.position,
+                                          std::string(invalid_token.literal));
         throw "Stop";
     }
-
-    previous_token = current_token;
-    current_token = next_token;
-    next_token = scanned_token;
 }
 
 auto amun::Parser::peek_and_advance_token() -> Token
@@ -2495,23 +2436,32 @@ auto amun::Parser::peek_and_advance_token() -> Token
     return current;
 }
 
-auto amun::Parser::peek_previous() -> Token { return previous_token.value(); }
+auto amun::Parser::peek_previous() -> Token { return tokens.token(previous_token_index); }
 
-auto amun::Parser::peek_current() -> Token { return current_token.value(); }
+auto amun::Parser::peek_current() -> Token { return tokens.token(current_token_index); }
 
-auto amun::Parser::peek_next() -> Token { return next_token.value(); }
+auto amun::Parser::peek_next() -> Token { return tokens.token(next_token_index); }
 
-auto amun::Parser::is_previous_kind(TokenKind kind) -> bool { return peek_previous().kind == kind; }
+auto amun::Parser::is_previous_kind(TokenKind kind) -> bool
+{
+    return tokens.kind(previous_token_index) == kind;
+}
 
-auto amun::Parser::is_current_kind(TokenKind kind) -> bool { return peek_current().kind == kind; }
+auto amun::Parser::is_current_kind(TokenKind kind) -> bool
+{
+    return tokens.kind(current_token_index) == kind;
+}
 
-auto amun::Parser::is_next_kind(TokenKind kind) -> bool { return peek_next().kind == kind; }
+auto amun::Parser::is_next_kind(TokenKind kind) -> bool
+{
+    return tokens.kind(next_token_index) == kind;
+}
 
 auto amun::Parser::consume_kind(TokenKind kind, const char* message) -> Token
 {
     if (is_current_kind(kind)) {
         advanced_token();
-        return previous_token.value();
+        return peek_previous();
     }
     context->diagnostics.report_error(peek_current().position, message);
     throw "Stop";
@@ -2532,6 +2482,36 @@ void amun::Parser::assert_kind(TokenKind kind, const char* message)
     throw "Stop";
 }
 
+auto amun::Parser::current_operator_precedence() -> OperatorPrecedence
+{
+    switch (tokens.kind(current_token_index)) {
+    case TokenKind::TOKEN_OR_OR: return OperatorPrecedence::LOGICAL_OR;
+    case TokenKind::TOKEN_AND_AND: return OperatorPrecedence::LOGICAL_AND;
+    case TokenKind::TOKEN_AND: return OperatorPrecedence::BITWISE_AND;
+    case TokenKind::TOKEN_XOR: return OperatorPrecedence::BITWISE_XOR;
+    case TokenKind::TOKEN_OR: return OperatorPrecedence::BITWISE_OR;
+    case TokenKind::TOKEN_EQUAL_EQUAL:
+    case TokenKind::TOKEN_BANG_EQUAL: return OperatorPrecedence::EQUALITY;
+    case TokenKind::TOKEN_GREATER: {
+        if (is_next_kind(TokenKind::TOKEN_GREATER) &&
+            is_right_shift_operator(peek_current(), peek_next())) {
+            return OperatorPrecedence::SHIFT;
+        }
+        return OperatorPrecedence::COMPARISON;
+    }
+    case TokenKind::TOKEN_GREATER_EQUAL:
+    case TokenKind::TOKEN_SMALLER:
+    case TokenKind::TOKEN_SMALLER_EQUAL: return OperatorPrecedence::COMPARISON;
+    case TokenKind::TOKEN_LEFT_SHIFT: return OperatorPrecedence::SHIFT;
+    case TokenKind::TOKEN_PLUS:
+    case TokenKind::TOKEN_MINUS: return OperatorPrecedence::TERM;
+    case TokenKind::TOKEN_STAR:
+    case TokenKind::TOKEN_SLASH:
+    case TokenKind::TOKEN_PERCENT: return OperatorPrecedence::FACTOR;
+    default: return OperatorPrecedence::NONE;
+    }
+}
+
 auto amun::Parser::is_right_shift_operator(Token first, Token second) -> bool
 {
     if (first.kind == TokenKind::TOKEN_GREATER && second.kind == TokenKind::TOKEN_GREATER) {
@@ -2545,5 +2525,5 @@ auto amun::Parser::is_right_shift_operator(Token first, Token second) -> bool
 
 auto amun::Parser::is_source_available() -> bool
 {
-    return peek_current().kind != TokenKind::TOKEN_END_OF_FILE;
+    return !is_current_kind(TokenKind::TOKEN_END_OF_FILE);
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "../include/amun_parser.hpp"
 
-auto amun::Parser::parse_declaraions_directive() -> Shared<Statement>
+#include <llvm/ADT/StringRef.h>
+
+auto amun::Parser::parse_declaraions_directive() -> Statement*
 {
     auto hash_token = consume_kind(TokenKind::TOKEN_AT, "Expect `@` before directive name");
     auto posiiton = hash_token.position;
@@ -78,7 +80,8 @@ auto amun::Parser::parse_declaraions_directive() -> Shared<Statement>
         }
 
         context->diagnostics.report_error(posiiton,
-                                          "No declaraions directive with name " + directive_name);
+                                          "No declaraions directive with name " +
+                                              std::string(directive_name));
         throw "Stop";
     }
 
@@ -86,9 +89,9 @@ auto amun::Parser::parse_declaraions_directive() -> Shared<Statement>
     throw "Stop";
 }
 
-auto amun::Parser::parse_statements_directive() -> Shared<Statement>
+auto amun::Parser::parse_statements_directive() -> Statement*
 {
-    auto hash_token = consume_kind(TokenKind::TOKEN_AT, "Expect `@` before directive name");
+    assert_kind(TokenKind::TOKEN_AT, "Expect `@` before directive name");
     auto directive = consume_kind(TokenKind::TOKEN_IDENTIFIER, "Expect symbol as directive name");
     auto directive_name = directive.literal;
     auto posiiton = directive.position;
@@ -100,19 +103,140 @@ auto amun::Parser::parse_statements_directive() -> Shared<Statement>
             throw "Stop";
         }
 
-        auto switch_node = std::dynamic_pointer_cast<SwitchStatement>(statement);
+        auto switch_node = dynamic_cast<SwitchStatement*>(statement);
         switch_node->should_perform_complete_check = true;
         return switch_node;
     }
 
+    if (directive_name == "unroll" || directive_name == "vectorize" ||
+        directive_name == "interleave" || directive_name == "no_vectorize") {
+        return parse_loop_hint_directive(directive);
+    }
+
     context->diagnostics.report_error(posiiton,
-                                      "No statement directive with name " + directive_name);
+                                      "No statement directive with name " +
+                                          std::string(directive_name));
     throw "Stop";
 }
 
-auto amun::Parser::parse_expressions_directive() -> Shared<Expression>
+static auto loop_statement_hints(Statement* statement) -> LoopHints*
 {
-    auto hash_token = consume_kind(TokenKind::TOKEN_AT, "Expect `@` before directive name");
+    if (auto for_range = dynamic_cast<ForRangeStatement*>(statement)) {
+        return &for_range->hints;
+    }
+    if (auto for_each = dynamic_cast<ForEachStatement*>(statement)) {
+        return &for_each->hints;
+    }
+    if (auto forever = dynamic_cast<ForeverStatement*>(statement)) {
+        return &forever->hints;
+    }
+    if (auto while_statement = dynamic_cast<WhileStatement*>(statement)) {
+        return &while_statement->hints;
+    }
+    return nullptr;
+}
+
+auto amun::Parser::parse_loop_hint_directive(Token directive) -> Statement*
+{
+    auto directive_name = std::string(directive.literal);
+    auto posiiton = directive.position;
+
+    // Parse the hint value before the loop, it can be followed by other loop directives
+    uint32 value = 0;
+    bool is_full_unroll = false;
+    if (directive_name != "no_vectorize") {
+        assert_kind(TokenKind::TOKEN_OPEN_PAREN, "Expect `(` after loop directive name");
+        if (directive_name == "unroll" && is_current_kind(TokenKind::TOKEN_IDENTIFIER) &&
+            peek_current().literal == "full") {
+            advanced_token();
+            is_full_unroll = true;
+        }
+        else {
+            value = parse_loop_hint_value(directive);
+        }
+        assert_kind(TokenKind::TOKEN_CLOSE_PAREN, "Expect `)` after loop directive value");
+    }
+
+    auto statement = parse_statement();
+    auto hints = loop_statement_hints(statement);
+    if (hints == nullptr) {
+        context->diagnostics.report_error(posiiton,
+                                          "@" + directive_name + " expect for or while statement");
+        throw "Stop";
+    }
+
+    if (directive_name == "unroll") {
+        if (hints->unroll_full || hints->unroll_count != 0) {
+            context->diagnostics.report_error(posiiton, "Loop can't has more than one @unroll");
+            throw "Stop";
+        }
+        hints->unroll_full = is_full_unroll;
+        hints->unroll_count = value;
+        return statement;
+    }
+
+    if (directive_name == "interleave") {
+        if (hints->interleave_count != 0) {
+            context->diagnostics.report_error(posiiton,
+                                              "Loop can't has more than one @interleave");
+            throw "Stop";
+        }
+        hints->interleave_count = value;
+        return statement;
+    }
+
+    if (hints->no_vectorize || hints->vectorize_width != 0) {
+        context->diagnostics.report_error(
+            posiiton, "Loop can't has more than one of @vectorize and @no_vectorize");
+        throw "Stop";
+    }
+
+    if (directive_name == "vectorize") {
+        if ((value & (value - 1)) != 0) {
+            context->diagnostics.report_error(posiiton,
+                                              "@vectorize width must be a power of two");
+            throw "Stop";
+        }
+        hints->vectorize_width = value;
+        return statement;
+    }
+
+    hints->no_vectorize = true;
+    return statement;
+}
+
+auto amun::Parser::parse_loop_hint_value(Token directive) -> uint32
+{
+    auto posiiton = directive.position;
+    auto value = parse_expression();
+    if (auto number_expr = dynamic_cast<NumberExpression*>(value)) {
+        auto number_value = number_expr->value;
+        if (is_float_number_token(number_value)) {
+            context->diagnostics.report_error(
+                posiiton, "Expect loop directive value to be integer but found floating point");
+            throw "Stop";
+        }
+
+        // Literal that doesn't fit in 64 bit integer is reported as out of range value
+        uint64 value_int = 0;
+        auto literal = llvm::StringRef(number_value.literal.data(), number_value.literal.size());
+        if (literal.getAsInteger(10, value_int) || value_int < 1 ||
+            value_int > static_cast<uint64>(std::numeric_limits<int32>::max())) {
+            context->diagnostics.report_error(
+                posiiton, "Expect loop directive value to be positive 32 bit integer");
+            throw "Stop";
+        }
+
+        return static_cast<uint32>(value_int);
+    }
+
+    context->diagnostics.report_error(posiiton, "Expect loop directive value to be integer");
+    throw "Stop";
+}
+
+auto amun::Parser::parse_expressions_directive() -> Expression*
+{
+    assert_kind(TokenKind::TOKEN_AT, "Expect `@` before directive name");
     auto directive = consume_kind(TokenKind::TOKEN_IDENTIFIER, "Expect symbol as directive name");
     auto directive_name = directive.literal;
     auto posiiton = directive.position;
@@ -122,8 +246,9 @@ auto amun::Parser::parse_expressions_directive() -> Shared<Expression>
         Token directive_token;
         directive_token.kind = TokenKind::TOKEN_INT64;
         directive_token.position = posiiton;
-        directive_token.literal = std::to_string(current_line);
-        return std::make_shared<NumberExpression>(directive_token, amun::i64_type);
+        directive_token.literal =
+            context->source_manager.save_literal(std::to_string(current_line));
+        return create_node<NumberExpression>(directive_token, amun::i64_type);
     }
 
     if (directive_name == "column") {
@@ -131,8 +256,9 @@ auto amun::Parser::parse_expressions_directive() -> Shared<Expression>
         Token directive_token;
         directive_token.kind = TokenKind::TOKEN_INT64;
         directive_token.position = posiiton;
-        directive_token.literal = std::to_string(current_column);
-        return std::make_shared<NumberExpression>(directive_token, amun::i64_type);
+        directive_token.literal =
+            context->source_manager.save_literal(std::to_string(current_column));
+        return create_node<NumberExpression>(directive_token, amun::i64_type);
     }
 
     if (directive_name == "filepath") {
@@ -140,8 +266,8 @@ auto amun::Parser::parse_expressions_directive() -> Shared<Expression>
         Token directive_token;
         directive_token.kind = TokenKind::TOKEN_STRING;
         directive_token.position = posiiton;
-        directive_token.literal = current_filepath;
-        return std::make_shared<StringExpression>(directive_token);
+        directive_token.literal = context->source_manager.save_literal(current_filepath);
+        return create_node<StringExpression>(directive_token);
     }
 
     if (directive_name == "vec") {
@@ -151,8 +277,10 @@ auto amun::Parser::parse_expressions_directive() -> Shared<Expression>
             throw "Stop";
         }
 
-        auto array = std::dynamic_pointer_cast<ArrayExpression>(expression);
-        return std::make_shared<VectorExpression>(array);
+        auto array = dynamic_cast<ArrayExpression*>(expression);
+        auto array_type = static_cast<amun::StaticArrayType*>(array->get_type_node());
+        auto vector_type = context->type_context.static_vector_type(array_type);
+        return create_node<VectorExpression>(array, vector_type);
     }
 
     if (directive_name == "max_value") {
@@ -165,25 +293,27 @@ auto amun::Parser::parse_expressions_directive() -> Shared<Expression>
             throw "Stop";
         }
 
-        auto number_type = std::static_pointer_cast<amun::NumberType>(type);
+        auto number_type = static_cast<amun::NumberType*>(type);
 
         Token max_value;
         max_value.kind = number_kind_token_kind[number_type->number_kind];
         max_value.position = posiiton;
 
+        std::string max_literal;
         if (is_integer_type(number_type)) {
-            max_value.literal = std::to_string(integers_kind_max_value[number_type->number_kind]);
+            max_literal = std::to_string(integers_kind_max_value[number_type->number_kind]);
         }
         else {
             if (number_type->number_kind == NumberKind::FLOAT_32) {
-                max_value.literal = std::to_string(std::numeric_limits<float32>::max());
+                max_literal = std::to_string(std::numeric_limits<float32>::max());
             }
             else {
-                max_value.literal = std::to_string(std::numeric_limits<float64>::max());
+                max_literal = std::to_string(std::numeric_limits<float64>::max());
             }
         }
+        max_value.literal = context->source_manager.save_literal(max_literal);
 
-        return std::make_shared<NumberExpression>(max_value, number_type);
+        return create_node<NumberExpression>(max_value, number_type);
     }
 
     if (directive_name == "min_value") {
@@ -196,41 +326,44 @@ auto amun::Parser::parse_expressions_directive() -> Shared<Expression>
             throw "Stop";
         }
 
-        auto number_type = std::static_pointer_cast<amun::NumberType>(type);
+        auto number_type = static_cast<amun::NumberType*>(type);
 
         Token min_value;
         min_value.kind = number_kind_token_kind[number_type->number_kind];
         min_value.position = posiiton;
 
+        std::string min_literal;
         if (is_integer_type(number_type)) {
-            min_value.literal = std::to_string(integers_kind_min_value[number_type->number_kind]);
+            min_literal = std::to_string(integers_kind_min_value[number_type->number_kind]);
         }
         else {
             if (number_type->number_kind == NumberKind::FLOAT_32) {
-                min_value.literal = std::to_string(std::numeric_limits<float32>::lowest());
+                min_literal = std::to_string(std::numeric_limits<float32>::lowest());
             }
             else {
-                min_value.literal = std::to_string(std::numeric_limits<float64>::lowest());
+                min_literal = std::to_string(std::numeric_limits<float64>::lowest());
             }
         }
+        min_value.literal = context->source_manager.save_literal(min_literal);
 
-        return std::make_shared<NumberExpression>(min_value, number_type);
+        return create_node<NumberExpression>(min_value, number_type);
     }
 
     if (directive_name == "infinity32") {
-        return std::make_shared<InfinityExpression>(amun::f32_type);
+        return create_node<InfinityExpression>(amun::f32_type);
     }
 
     if (directive_name == "infinity" || directive_name == "infinity64") {
-        return std::make_shared<InfinityExpression>(amun::f64_type);
+        return create_node<InfinityExpression>(amun::f64_type);
     }
 
     context->diagnostics.report_error(posiiton,
-                                      "No expression directive with name " + directive_name);
+                                      "No expression directive with name " +
+                                          std::string(directive_name));
     throw "Stop";
 }
 
-auto amun::Parser::pares_types_directive() -> Shared<amun::Type>
+auto amun::Parser::pares_types_directive() -> amun::Type*
 {
     auto hash_token = consume_kind(TokenKind::TOKEN_AT, "Expect `@` before directive name");
     auto posiiton = hash_token.position;
@@ -247,8 +380,8 @@ auto amun::Parser::pares_types_directive() -> Shared<amun::Type>
                 throw "Stop";
             }
 
-            auto array_type = std::static_pointer_cast<amun::StaticArrayType>(type);
-            return std::make_shared<amun::StaticVectorType>(array_type);
+            auto array_type = static_cast<amun::StaticArrayType*>(type);
+            return context->type_context.static_vector_type(array_type);
         }
     }
     context->diagnostics.report_error(posiiton, "Expect identifier as directive name");
@@ -1,9 +1,8 @@
-#include "../include/amun_name_mangle.hpp"
 #include "../include/amun_parser.hpp"
 
 #include <unordered_map>
 
-auto amun::Parser::parse_type() -> Shared<amun::Type>
+auto amun::Parser::parse_type() -> amun::Type*
 {
     if (is_current_kind(TokenKind::TOKEN_AT)) {
         return pares_types_directive();
@@ -11,7 +10,7 @@ auto amun::Parser::parse_type() -> Shared<amun::Type>
     return parse_type_with_prefix();
 }
 
-auto amun::Parser::parse_type_with_prefix() -> Shared<amun::Type>
+auto amun::Parser::parse_type_with_prefix() -> amun::Type*
 {
     // Parse function pointer type
     if (is_current_kind(TokenKind::TOKEN_FUN)) {
@@ -36,23 +35,22 @@ auto amun::Parser::parse_type_with_prefix() -> Shared<amun::Type>
     return parse_type_with_postfix();
 }
 
-auto amun::Parser::parse_pointer_to_type() -> Shared<amun::Type>
+auto amun::Parser::parse_pointer_to_type() -> amun::Type*
 {
     assert_kind(TokenKind::TOKEN_STAR, "Pointer type must be started with *");
-    return std::make_shared<amun::PointerType>(parse_type_with_prefix());
+    return context->type_context.pointer_type(parse_type_with_prefix());
 }
 
-auto amun::Parser::parse_function_ptr_type() -> Shared<amun::Type>
+auto amun::Parser::parse_function_ptr_type() -> amun::Type*
 {
     assert_kind(TokenKind::TOKEN_FUN, "Expect `fun` keyword at the start of function ptr");
-    auto paren = peek_current();
     auto parameters_types = parse_list_of_types();
     auto return_type = parse_type();
-    auto function_type = std::make_shared<amun::FunctionType>(paren, parameters_types, return_type);
-    return std::make_shared<amun::PointerType>(function_type);
+    auto function_type = context->type_context.function_type(parameters_types, return_type);
+    return context->type_context.pointer_type(function_type);
 }
 
-auto amun::Parser::parse_tuple_type() -> Shared<amun::Type>
+auto amun::Parser::parse_tuple_type() -> amun::Type*
 {
     auto paren = peek_current();
     auto field_types = parse_list_of_types();
@@ -62,16 +60,14 @@ auto amun::Parser::parse_tuple_type() -> Shared<amun::Type>
         throw "Stop";
     }
 
-    auto tuple_type = std::make_shared<amun::TupleType>("", field_types);
-    tuple_type->name = mangle_tuple_type(tuple_type);
-    return tuple_type;
+    return context->type_context.tuple_type(field_types);
 }
 
-auto amun::Parser::parse_list_of_types() -> std::vector<Shared<amun::Type>>
+auto amun::Parser::parse_list_of_types() -> std::vector<amun::Type*>
 {
     assert_kind(TokenKind::TOKEN_OPEN_PAREN, "Expect `(` before types");
 
-    std::vector<Shared<amun::Type>> types;
+    std::vector<amun::Type*> types;
     while (is_source_available() && !is_current_kind(TokenKind::TOKEN_CLOSE_PAREN)) {
         types.push_back(parse_type());
         if (is_current_kind(TokenKind::TOKEN_COMMA)) {
@@ -87,7 +83,7 @@ auto amun::Parser::parse_list_of_types() -> std::vector<Shared<amun::Type>>
     return types;
 }
 
-auto amun::Parser::parse_fixed_size_array_type() -> Shared<amun::Type>
+auto amun::Parser::parse_fixed_size_array_type() -> amun::Type*
 {
     auto bracket =
         consume_kind(TokenKind::TOKEN_OPEN_BRACKET, "Expect [ for fixed size array type");
@@ -111,14 +107,14 @@ auto amun::Parser::parse_fixed_size_array_type() -> Shared<amun::Type>
         throw "Stop";
     }
 
-    const auto size = std::dynamic_pointer_cast<NumberExpression>(size_expression);
+    const auto size = dynamic_cast<NumberExpression*>(size_expression);
     if (!amun::is_integer_type(size->get_type_node())) {
         context->diagnostics.report_error(bracket.position,
                                           "Array size must be an integer constants");
         throw "Stop";
     }
 
-    auto number_value = std::atoi(size->value.literal.c_str());
+    auto number_value = std::atoi(std::string(size->value.literal).c_str());
     assert_kind(TokenKind::TOKEN_CLOSE_BRACKET, "Expect ] after array size.");
     auto element_type = parse_type();
 
@@ -138,10 +134,10 @@ auto amun::Parser::parse_fixed_size_array_type() -> Shared<amun::Type>
         throw "Stop";
     }
 
-    return std::make_shared<amun::StaticArrayType>(element_type, number_value);
+    return context->type_context.static_array_type(element_type, number_value);
 }
 
-auto amun::Parser::parse_type_with_postfix() -> Shared<amun::Type>
+auto amun::Parser::parse_type_with_postfix() -> amun::Type*
 {
     auto type = parse_generic_struct_type();
 
@@ -156,7 +152,7 @@ auto amun::Parser::parse_type_with_postfix() -> Shared<amun::Type>
     return type;
 }
 
-auto amun::Parser::parse_generic_struct_type() -> Shared<amun::Type>
+auto amun::Parser::parse_generic_struct_type() -> amun::Type*
 {
     auto primary_type = parse_primary_type();
 
@@ -164,7 +160,7 @@ auto amun::Parser::parse_generic_struct_type() -> Shared<amun::Type>
     if (is_current_kind(TokenKind::TOKEN_SMALLER)) {
         if (primary_type->type_kind == amun::TypeKind::STRUCT) {
             auto smaller_token = peek_current();
-            auto struct_type = std::static_pointer_cast<amun::StructType>(primary_type);
+            auto struct_type = static_cast<amun::StructType*>(primary_type);
 
             // Prevent use non generic struct type with any type parameters
             if (!struct_type->is_generic) {
@@ -186,7 +182,7 @@ auto amun::Parser::parse_generic_struct_type() -> Shared<amun::Type>
                 throw "Stop";
             }
 
-            return std::make_shared<amun::GenericStructType>(struct_type, generic_parameters);
+            return context->type_context.generic_struct_type(struct_type, generic_parameters);
         }
 
         context->diagnostics.report_error(peek_previous().position,
@@ -196,12 +192,12 @@ auto amun::Parser::parse_generic_struct_type() -> Shared<amun::Type>
 
     // Assert that generic structs types must be created with parameters types
     if (primary_type->type_kind == amun::TypeKind::STRUCT) {
-        auto struct_type = std::static_pointer_cast<amun::StructType>(primary_type);
+        auto struct_type = static_cast<amun::StructType*>(primary_type);
         if (struct_type->is_generic) {
             auto struct_name = peek_previous();
             context->diagnostics.report_error(
                 struct_name.position, "Generic struct type must be used with parameters types " +
-                                          struct_name.literal + "<..>");
+                                          std::string(struct_name.literal) + "<..>");
             throw "Stop";
         }
     }
@@ -209,7 +205,7 @@ auto amun::Parser::parse_generic_struct_type() -> Shared<amun::Type>
     return primary_type;
 }
 
-auto amun::Parser::parse_primary_type() -> Shared<amun::Type>
+auto amun::Parser::parse_primary_type() -> amun::Type*
 {
     // Check if this type is an identifier
     if (is_current_kind(TokenKind::TOKEN_IDENTIFIER)) {
@@ -227,10 +223,10 @@ auto amun::Parser::parse_primary_type() -> Shared<amun::Type>
     throw "Stop";
 }
 
-auto amun::Parser::parse_identifier_type() -> Shared<amun::Type>
+auto amun::Parser::parse_identifier_type() -> amun::Type*
 {
     Token symbol_token = consume_kind(TokenKind::TOKEN_IDENTIFIER, "Expect identifier as type");
-    std::string type_literal = symbol_token.literal;
+    auto type_literal = std::string(symbol_token.literal);
 
     // Check if this time is primitive
     if (primitive_types.contains(type_literal)) {
@@ -245,9 +241,8 @@ auto amun::Parser::parse_identifier_type() -> Shared<amun::Type>
     // Check if this type is enumeration type
     if (context->enumerations.contains(type_literal)) {
         auto enum_type = context->enumerations[type_literal];
-        auto enum_element_type =
-            std::make_shared<amun::EnumElementType>(symbol_token.literal, enum_type->element_type);
-        return enum_element_type;
+        return context->type_context.enum_element_type(std::string(symbol_token.literal),
+                                                       enum_type->element_type);
     }
 
     // Struct with field that has his type for example LinkedList Node struct
@@ -259,7 +254,7 @@ auto amun::Parser::parse_identifier_type() -> Shared<amun::Type>
 
     // Check if this is a it generic type parameter
     if (generic_parameters_names.contains(type_literal)) {
-        return std::make_shared<amun::GenericParameterType>(type_literal);
+        return context->type_context.generic_parameter_type(type_literal);
     }
 
     // Check if this identifier is a type alias key
@@ -1,19 +1,136 @@
 #include "../include/amun_source_manager.hpp"
+#include "../include/amun_logger.hpp"
+
+#include <algorithm>
+#include <cstdint>
 
 auto amun::SourceManager::register_source_path(std::string path) -> int
 {
-    last_source_file_id++;
-    files_map[last_source_file_id] = path;
+    std::lock_guard<std::mutex> lock(mutex);
     files_set.insert(path);
-    return last_source_file_id;
+    return resolve_source_id(path);
+}
+
+auto amun::SourceManager::reserve_source_id(const std::string& path) -> int
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return resolve_source_id(path);
 }
 
 auto amun::SourceManager::resolve_source_path(int source_id) -> std::string
 {
+    std::lock_guard<std::mutex> lock(mutex);
     return files_map[source_id];
 }
 
 auto amun::SourceManager::is_path_registered(std::string path) -> bool
 {
+    std::lock_guard<std::mutex> lock(mutex);
     return files_set.contains(path);
 }
+
+auto amun::SourceManager::registered_sources_ids() -> std::vector<int>
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<int> sources_ids;
+    sources_ids.reserve(files_set.size());
+    for (const auto& path : files_set) {
+        sources_ids.push_back(files_ids[path]);
+    }
+    std::sort(sources_ids.begin(), sources_ids.end());
+    return sources_ids;
+}
+
+auto amun::SourceManager::load_source_buffer(int source_id) -> SourceBuffer&
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto buffer = buffers_map.find(source_id);
+    if (buffer != buffers_map.end()) {
+        return buffer->second;
+    }
+
+    // Large files are memory mapped and small files are read into one allocation
+    const auto& path = files_map[source_id];
+    auto memory_buffer = llvm::MemoryBuffer::getFile(path, false, true);
+    if (auto error = memory_buffer.getError()) {
+        amun::loge << "Can't read source file " << path << " " << error.message() << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    auto source_buffer = SourceBuffer(std::move(memory_buffer.get()));
+    return buffers_map.emplace(source_id, std::move(source_buffer)).first->second;
+}
+
+auto amun::SourceManager::resolve_source_line(int source_id, int line_number) -> std::string_view
+{
+    return load_source_buffer(source_id).line(line_number);
+}
+
+auto amun::SourceManager::save_literal(std::string_view literal) -> std::string_view
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto saved_literal = literals_saver.save(llvm::StringRef(literal.data(), literal.size()));
+    return {saved_literal.data(), saved_literal.size()};
+}
+
+auto amun::SourceManager::resolve_source_id(const std::string& path) -> int
+{
+    auto source_id = files_ids.find(path);
+    if (source_id != files_ids.end()) {
+        return source_id->second;
+    }
+
+    last_source_file_id++;
+    files_map[last_source_file_id] = path;
+    files_ids[path] = last_source_file_id;
+    return last_source_file_id;
+}
+
+auto amun::SourceBuffer::line(int line_number) -> std::string_view
+{
+    build_lines_offsets();
+    if (line_number < 1 || static_cast<size_t>(line_number) > lines_offsets.size()) {
+        return {};
+    }
+
+    auto source = content();
+    auto line_start = lines_offsets[line_number - 1];
+    auto is_last_line = static_cast<size_t>(line_number) == lines_offsets.size();
+    auto line_end = is_last_line ? source.size() : lines_offsets[line_number] - 1;
+    return source.substr(line_start, line_end - line_start);
+}
+
+auto amun::SourceBuffer::resolve_line_containing(size_t offset) -> void
+{
+    build_lines_offsets();
+
+    // Check the line after the last resolved one before searching all the lines
+    auto next_line_index = last_line_index + 1;
+    if (next_line_index < lines_offsets.size() && offset >= lines_offsets[next_line_index] &&
+        (next_line_index + 1 == lines_offsets.size() ||
+         offset < lines_offsets[next_line_index + 1])) {
+        last_line_index = next_line_index;
+    }
+    else {
+        auto next_line = std::upper_bound(lines_offsets.begin(), lines_offsets.end(), offset);
+        last_line_index = (next_line - lines_offsets.begin()) - 1;
+    }
+
+    last_line_start = lines_offsets[last_line_index];
+    auto is_last_line = last_line_index + 1 == lines_offsets.size();
+    last_line_end = is_last_line ? SIZE_MAX : lines_offsets[last_line_index + 1];
+}
+
+auto amun::SourceBuffer::build_lines_offsets() -> void
+{
+    if (!lines_offsets.empty()) {
+        return;
+    }
+
+    auto source = content();
+    lines_offsets.push_back(0);
+    for (auto end = source.find('\n'); end != std::string_view::npos;
+         end = source.find('\n', end + 1)) {
+        lines_offsets.push_back(end + 1);
+    }
+}
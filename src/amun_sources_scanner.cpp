@@ -0,0 +1,89 @@
+#include "../include/amun_sources_scanner.hpp"
+#include "../include/amun_basic.hpp"
+#include "../include/amun_files.hpp"
+#include "../include/amun_tokenizer.hpp"
+
+auto amun::SourcesScanner::take_tokens(int source_file_id) -> TokenBuffer
+{
+    std::unique_ptr<ScannedFile> scanned_file;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto scanned_file_it = scanned_files.find(source_file_id);
+        if (scanned_file_it != scanned_files.end()) {
+            scanned_file = std::move(scanned_file_it->second);
+            scanned_files.erase(scanned_file_it);
+        }
+    }
+
+    if (scanned_file) {
+        scanned_file->scanned.wait();
+        return std::move(*scanned_file->tokens);
+    }
+
+    auto tokens = scan_source_file(source_file_id);
+    prefetch_dependencies(tokens, source_file_id);
+    return tokens;
+}
+
+auto amun::SourcesScanner::scan_source_file(int source_file_id) -> TokenBuffer
+{
+    amun::Tokenizer tokenizer(source_manager, source_file_id);
+    return tokenizer.scan_all_tokens();
+}
+
+auto amun::SourcesScanner::prefetch_dependencies(const TokenBuffer& tokens, int source_file_id)
+    -> void
+{
+    // Scanning ahead is useful only if the pool threads can run beside the parser thread
+    if (thread_pool.getThreadCount() < 2) {
+        return;
+    }
+
+    auto source_path = source_manager.resolve_source_path(source_file_id);
+    auto parent_path = amun::find_parent_directory(source_path);
+
+    // Find the files names after load and import keywords or inside their blocks, the parser
+    // reports any invalid load or import so they are ignored here
+    auto tokens_count = tokens.size();
+    for (size_t index = 0; index + 1 < tokens_count; index++) {
+        auto kind = tokens.kind(index);
+        if (kind != TokenKind::TOKEN_LOAD && kind != TokenKind::TOKEN_IMPORT) {
+            continue;
+        }
+
+        auto path_prefix =
+            kind == TokenKind::TOKEN_LOAD ? parent_path : std::string(AMUN_LIBRARIES_PREFIX);
+        auto is_block = tokens.kind(index + 1) == TokenKind::TOKEN_OPEN_BRACE;
+        for (index += is_block ? 2 : 1;
+             index < tokens_count && tokens.kind(index) == TokenKind::TOKEN_STRING; index++) {
+            auto path = path_prefix + std::string(tokens.literal(index)) + AMUN_LANGUAGE_EXTENSION;
+            prefetch_source_file(path);
+            if (!is_block) {
+                break;
+            }
+        }
+    }
+}
+
+auto amun::SourcesScanner::prefetch_source_file(const std::string& path) -> void
+{
+    if (!amun::is_file_exists(path)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (prefetched_paths.contains(path) || source_manager.is_path_registered(path)) {
+        return;
+    }
+
+    prefetched_paths.insert(path);
+    auto source_file_id = source_manager.reserve_source_id(path);
+    auto& scanned_file = scanned_files[source_file_id];
+    scanned_file = std::make_unique<ScannedFile>();
+    scanned_file->scanned =
+        thread_pool.async([this, scanned_file = scanned_file.get(), source_file_id] {
+            auto tokens = scan_source_file(source_file_id);
+            prefetch_dependencies(tokens, source_file_id);
+            scanned_file->tokens.emplace(std::move(tokens));
+        });
+}
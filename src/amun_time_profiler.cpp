@@ -0,0 +1,47 @@
+#include "../include/amun_time_profiler.hpp"
+
+#include <cstdio>
+
+auto amun::TimeProfiler::record_phase_time(const std::string& phase_name, double seconds) -> void
+{
+    // Phases that executed more than one time are accumulated in the same entry
+    for (auto& [name, total_seconds] : phases_time) {
+        if (name == phase_name) {
+            total_seconds += seconds;
+            return;
+        }
+    }
+    phases_time.emplace_back(phase_name, seconds);
+}
+
+auto amun::TimeProfiler::report_phases_time() -> void
+{
+    double total_seconds = 0;
+    for (const auto& phase_time : phases_time) {
+        total_seconds += phase_time.second;
+    }
+
+    printf("===-------------------------------------------------------------------------===\n");
+    printf("                          Amun compilation time report\n");
+    printf("===-------------------------------------------------------------------------===\n");
+    printf("  Total Execution Time: %.4f seconds\n\n", total_seconds);
+    printf("   ---Wall Time---  --- Name ---\n");
+    for (const auto& [name, seconds] : phases_time) {
+        auto percentage = total_seconds > 0 ? seconds * 100 / total_seconds : 0;
+        printf("   %.4f (%5.1f%%)  %s\n", seconds, percentage, name.c_str());
+    }
+    printf("   %.4f (100.0%%)  Total\n", total_seconds);
+}
+
+amun::PhaseTimeScope::PhaseTimeScope(TimeProfiler& profiler, const char* phase_name,
+                                     const std::string& detail)
+    : profiler(profiler), phase_name(phase_name), start_time(std::chrono::steady_clock::now()),
+      trace_scope(phase_name, detail)
+{
+}
+
+amun::PhaseTimeScope::~PhaseTimeScope()
+{
+    auto duration = std::chrono::steady_clock::now() - start_time;
+    profiler.record_phase_time(phase_name, std::chrono::duration<double>(duration).count());
+}
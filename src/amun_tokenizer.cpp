@@ -2,34 +2,137 @@
 #include "../include/amun_basic.hpp"
 #include "../include/amun_logger.hpp"
 
+#include <llvm/Support/MathExtras.h>
+
+#include <array>
+#include <charconv>
+#include <cstring>
 #include <iostream>
-#include <sstream>
+#include <string>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+struct Keyword {
+    std::string_view name;
+    TokenKind kind;
+};
+
+constexpr Keyword keywords[] = {
+    {"if", TokenKind::TOKEN_IF},
+    {"fun", TokenKind::TOKEN_FUN},
+    {"var", TokenKind::TOKEN_VAR},
+    {"for", TokenKind::TOKEN_FOR},
+    {"load", TokenKind::TOKEN_LOAD},
+    {"null", TokenKind::TOKEN_NULL},
+    {"true", TokenKind::TOKEN_TRUE},
+    {"cast", TokenKind::TOKEN_CAST},
+    {"else", TokenKind::TOKEN_ELSE},
+    {"enum", TokenKind::TOKEN_ENUM},
+    {"type", TokenKind::TOKEN_TYPE},
+    {"while", TokenKind::TOKEN_WHILE},
+    {"defer", TokenKind::TOKEN_DEFER},
+    {"false", TokenKind::TOKEN_FALSE},
+    {"break", TokenKind::TOKEN_BREAK},
+    {"const", TokenKind::TOKEN_CONST},
+    {"import", TokenKind::TOKEN_IMPORT},
+    {"struct", TokenKind::TOKEN_STRUCT},
+    {"return", TokenKind::TOKEN_RETURN},
+    {"switch", TokenKind::TOKEN_SWITCH},
+    {"varargs", TokenKind::TOKEN_VARARGS},
+    {"continue", TokenKind::TOKEN_CONTINUE},
+    {"operator", TokenKind::TOKEN_OPERATOR},
+    {"type_size", TokenKind::TOKEN_TYPE_SIZE},
+    {"undefined", TokenKind::TOKEN_UNDEFINED},
+    {"value_size", TokenKind::TOKEN_VALUE_SIZE},
+    {"type_allign", TokenKind::TOKEN_TYPE_ALLIGN},
+};
+
+constexpr size_t keywords_table_size = 64;
+constexpr size_t keyword_min_length = 2;
+constexpr size_t keyword_max_length = 11;
+
+// Keywords are different in at least one of length, first, second or last character
+constexpr auto keyword_hash(std::string_view keyword, uint32_t seed) -> size_t
+{
+    auto hash = static_cast<uint32_t>(keyword.size());
+    hash = hash * seed + static_cast<uint8_t>(keyword[0]);
+    hash = hash * seed + static_cast<uint8_t>(keyword[1]);
+    hash = hash * seed + static_cast<uint8_t>(keyword.back());
+    return (hash ^ (hash >> 11)) & (keywords_table_size - 1);
+}
 
-auto amun::Tokenizer::scan_all_tokens() -> std::vector<Token>
+constexpr auto is_perfect_keyword_seed(uint32_t seed) -> bool
 {
-    std::vector<Token> tokens;
-    while (is_source_available()) {
-        tokens.push_back(scan_next_token());
+    std::array<bool, keywords_table_size> used_slots = {};
+    for (const auto& keyword : keywords) {
+        auto slot = keyword_hash(keyword.name, seed);
+        if (used_slots[slot]) {
+            return false;
+        }
+        used_slots[slot] = true;
+    }
+    return true;
+}
+
+constexpr auto find_perfect_keyword_seed() -> uint32_t
+{
+    for (uint32_t seed = 1; seed < 0xFFFF; seed++) {
+        if (is_perfect_keyword_seed(seed)) {
+            return seed;
+        }
+    }
+    return 0;
+}
+
+constexpr uint32_t keyword_seed = find_perfect_keyword_seed();
+static_assert(keyword_seed != 0, "Can't find perfect hash seed for the keywords");
+
+// Empty slots have empty name so they never match identifier with keyword length
+constexpr auto build_keywords_table() -> std::array<Keyword, keywords_table_size>
+{
+    std::array<Keyword, keywords_table_size> table = {};
+    for (auto& slot : table) {
+        slot = {"", TokenKind::TOKEN_IDENTIFIER};
+    }
+    for (const auto& keyword : keywords) {
+        table[keyword_hash(keyword.name, keyword_seed)] = keyword;
+    }
+    return table;
+}
+
+constexpr auto keywords_table = build_keywords_table();
+
+} // namespace
+
+auto amun::Tokenizer::scan_all_tokens() -> TokenBuffer
+{
+    // Scanning stops at the first invalid token because the parser stops after reporting it
+    tokens.reserve(source_code_length / 2);
+    while (true) {
+        scan_next_token();
+        auto last_kind = tokens.kind(tokens.size() - 1);
+        if (last_kind == TokenKind::TOKEN_END_OF_FILE || last_kind == TokenKind::TOKEN_INVALID) {
+            break;
+        }
     }
-    tokens.push_back(build_token(TokenKind::TOKEN_END_OF_FILE));
-    return tokens;
+    return std::move(tokens);
 }
 
-auto amun::Tokenizer::scan_next_token() -> Token
+auto amun::Tokenizer::scan_next_token() -> void
 {
     skip_whitespaces();
 
     start_position = current_position;
-    column_start = column_current;
 
     char c = advance();
 
     start_position++;
     current_position = start_position;
 
-    column_start++;
-    column_current = column_start;
-
     switch (c) {
     // One character token
     case '(': return build_token(TokenKind::TOKEN_OPEN_PAREN);
@@ -240,18 +343,19 @@ auto amun::Tokenizer::scan_next_token() -> Token
     }
 }
 
-auto amun::Tokenizer::consume_symbol() -> Token
+auto amun::Tokenizer::consume_symbol() -> void
 {
-    while (is_alpha_num(peek()) or peek() == '_') {
-        advance();
-    }
+    const auto* source = source_code.data();
+    const auto* symbol_end = skip_identifier_characters(source + current_position,
+                                                        source + source_code_length);
+    current_position = symbol_end - source;
     size_t len = current_position - start_position + 1;
     auto literal = source_code.substr(start_position - 1, len);
-    auto kind = resolve_keyword_token_kind(literal.c_str());
+    auto kind = resolve_keyword_token_kind(literal);
     return build_token(kind, literal);
 }
 
-auto amun::Tokenizer::consume_number() -> Token
+auto amun::Tokenizer::consume_number() -> void
 {
     auto kind = TokenKind::TOKEN_INT;
     while (is_digit(peek()) or is_underscore(peek())) {
@@ -327,11 +431,18 @@ auto amun::Tokenizer::consume_number() -> Token
 
     size_t len = number_end_position - start_position + 1;
     auto literal = source_code.substr(start_position - 1, len);
-    literal.erase(std::remove(literal.begin(), literal.end(), '_'), literal.end());
+
+    // Only numbers with digits separators need an owned literal without them
+    if (literal.find('_') != std::string_view::npos) {
+        std::string number(literal);
+        number.erase(std::remove(number.begin(), number.end(), '_'), number.end());
+        return build_token(kind, source_manager.save_literal(number));
+    }
+
     return build_token(kind, literal);
 }
 
-auto amun::Tokenizer::consume_hex_number() -> Token
+auto amun::Tokenizer::consume_hex_number() -> void
 {
     auto has_digits = false;
     while (is_hex_digit(peek()) or is_underscore(peek())) {
@@ -345,18 +456,17 @@ auto amun::Tokenizer::consume_hex_number() -> Token
     }
 
     size_t len = current_position - start_position - 1;
-    auto literal = source_code.substr(start_position + 1, len);
-    literal.erase(std::remove(literal.begin(), literal.end(), '_'), literal.end());
-    auto decimal_value = hex_to_decimal(literal);
+    auto decimal_value = digits_to_decimal(source_code.substr(start_position + 1, len), 16);
 
     if (decimal_value == -1) {
         return build_token(TokenKind::TOKEN_INVALID, "Hex integer literal is too large");
     }
 
-    return build_token(TokenKind::TOKEN_INT, std::to_string(decimal_value));
+    auto decimal_literal = source_manager.save_literal(std::to_string(decimal_value));
+    return build_token(TokenKind::TOKEN_INT, decimal_literal);
 }
 
-auto amun::Tokenizer::consume_binary_number() -> Token
+auto amun::Tokenizer::consume_binary_number() -> void
 {
     auto has_digits = false;
     while (is_binary_digit(peek()) or is_underscore(peek())) {
@@ -370,18 +480,17 @@ auto amun::Tokenizer::consume_binary_number() -> Token
     }
 
     size_t len = current_position - start_position - 1;
-    auto literal = source_code.substr(start_position + 1, len);
-    literal.erase(std::remove(literal.begin(), literal.end(), '_'), literal.end());
-    auto decimal_value = binary_to_decimal(literal);
+    auto decimal_value = digits_to_decimal(source_code.substr(start_position + 1, len), 2);
 
     if (decimal_value == -1) {
         return build_token(TokenKind::TOKEN_INVALID, "binary integer literal is too large");
     }
 
-    return build_token(TokenKind::TOKEN_INT, std::to_string(decimal_value));
+    auto decimal_literal = source_manager.save_literal(std::to_string(decimal_value));
+    return build_token(TokenKind::TOKEN_INT, decimal_literal);
 }
 
-auto amun::Tokenizer::consume_octal_number() -> Token
+auto amun::Tokenizer::consume_octal_number() -> void
 {
     auto has_digits = false;
     while (is_octal_digit(peek()) or is_underscore(peek())) {
@@ -395,27 +504,41 @@ auto amun::Tokenizer::consume_octal_number() -> Token
     }
 
     size_t len = current_position - start_position - 1;
-    auto literal = source_code.substr(start_position + 1, len);
-    literal.erase(std::remove(literal.begin(), literal.end(), '_'), literal.end());
-    auto decimal_value = octal_to_decimal(literal);
+    auto decimal_value = digits_to_decimal(source_code.substr(start_position + 1, len), 8);
 
     if (decimal_value == -1) {
         return build_token(TokenKind::TOKEN_INVALID, "octal integer literal is too large");
     }
 
-    return build_token(TokenKind::TOKEN_INT, std::to_string(decimal_value));
+    auto decimal_literal = source_manager.save_literal(std::to_string(decimal_value));
+    return build_token(TokenKind::TOKEN_INT, decimal_literal);
 }
 
-auto amun::Tokenizer::consume_string() -> Token
+auto amun::Tokenizer::consume_string() -> void
 {
-    std::stringstream stream;
+    // String without escape characters is a view into the source buffer
+    auto string_start_position = current_position;
+    const auto* source = source_code.data();
+    const auto* delimiter = find_string_delimiter(source + current_position,
+                                                  source + source_code_length);
+    current_position = delimiter - source;
+
+    if (is_source_available() && peek() == '"') {
+        auto len = current_position - string_start_position;
+        advance();
+        return build_token(TokenKind::TOKEN_STRING, source_code.substr(string_start_position, len));
+    }
+
+    // String with escape characters need an owned literal after resolving them
+    auto len = current_position - string_start_position;
+    std::string literal(source_code.substr(string_start_position, len));
     while (is_source_available() && peek() != '"') {
         char c = consume_one_character();
         if (c == -1) {
             return build_token(TokenKind::TOKEN_INVALID, "invalid character");
         }
 
-        stream << c;
+        literal.push_back(c);
     }
 
     if (not is_source_available()) {
@@ -423,10 +546,10 @@ auto amun::Tokenizer::consume_string() -> Token
     }
 
     advance();
-    return build_token(TokenKind::TOKEN_STRING, stream.str());
+    return build_token(TokenKind::TOKEN_STRING, source_manager.save_literal(literal));
 }
 
-auto amun::Tokenizer::consume_character() -> Token
+auto amun::Tokenizer::consume_character() -> void
 {
     char c = consume_one_character();
     if (c == -1) {
@@ -443,7 +566,7 @@ auto amun::Tokenizer::consume_character() -> Token
 
     advance();
 
-    return build_token(TokenKind::TOKEN_CHARACTER, std::string(1, c));
+    return build_token(TokenKind::TOKEN_CHARACTER, source_manager.save_literal({&c, 1}));
 }
 
 auto amun::Tokenizer::consume_one_character() -> char
@@ -527,16 +650,13 @@ auto amun::Tokenizer::consume_one_character() -> char
     return c;
 }
 
-auto amun::Tokenizer::build_token(TokenKind kind) -> Token { return build_token(kind, ""); }
-
-auto amun::Tokenizer::build_token(TokenKind kind, std::string literal) -> Token
-{
-    return {kind, build_token_span(), literal};
-}
+auto amun::Tokenizer::build_token(TokenKind kind) -> void { build_token(kind, ""); }
 
-auto amun::Tokenizer::build_token_span() -> TokenSpan
+auto amun::Tokenizer::build_token(TokenKind kind, std::string_view literal) -> void
 {
-    return {source_file_id, line_number, column_start, column_current};
+    auto offset = static_cast<uint32_t>(start_position - 1);
+    auto length = static_cast<uint32_t>(current_position - offset);
+    tokens.push_token(kind, offset, length, literal);
 }
 
 auto amun::Tokenizer::skip_whitespaces() -> void
@@ -546,12 +666,14 @@ auto amun::Tokenizer::skip_whitespaces() -> void
         switch (c) {
         case ' ':
         case '\r':
-        case '\t': advance(); break;
-        case '\n':
-            line_number++;
-            advance();
-            column_current = 0;
+        case '\t':
+        case '\n': {
+            const auto* source = source_code.data();
+            const auto* whitespaces_end = skip_whitespace_characters(source + current_position,
+                                                                     source + source_code_length);
+            current_position = whitespaces_end - source;
             break;
+        }
         case '/': {
             if (peek_next() == '/' || peek_next() == '*') {
                 advance();
@@ -574,28 +696,34 @@ auto amun::Tokenizer::skip_whitespaces() -> void
 
 auto amun::Tokenizer::skip_single_line_comment() -> void
 {
-    while (is_source_available() && peek() != '\n') {
-        advance();
-    }
+    const auto* source = source_code.data();
+    const auto* line_end = static_cast<const char*>(
+        std::memchr(source + current_position, '\n', source_code_length - current_position));
+    current_position = line_end ? line_end - source : source_code_length;
 }
 
 auto amun::Tokenizer::skip_multi_lines_comment() -> void
 {
-    while (is_source_available() && (peek() != '*' || peek_next() != '/')) {
-        advance();
-        if (peek() == '\n') {
-            line_number++;
-            column_current = 0;
+    const auto* source = source_code.data();
+    const auto* end = source + source_code_length;
+    const auto* current = source + current_position;
+    while (true) {
+        const auto* star = static_cast<const char*>(std::memchr(current, '*', end - current));
+        if (star == nullptr) {
+            current = end;
+            break;
+        }
+
+        if (star + 1 < end && star[1] == '/') {
+            current = star;
+            break;
         }
+
+        current = star + 1;
     }
+    current_position = current - source;
     advance();
     advance();
-
-    // If multi line comments end with new line update the line number
-    if (peek() == '\n') {
-        line_number++;
-        column_current = 0;
-    }
 }
 
 auto amun::Tokenizer::match(char current) -> bool
@@ -604,7 +732,6 @@ auto amun::Tokenizer::match(char current) -> bool
         return false;
     }
     current_position++;
-    column_current++;
     return true;
 }
 
@@ -612,7 +739,6 @@ auto amun::Tokenizer::match(char current, char next) -> bool
 {
     if (current == peek() && next == peek_next()) {
         current_position += 2;
-        column_current += 2;
         return true;
     }
     return false;
@@ -622,13 +748,13 @@ auto amun::Tokenizer::advance() -> char
 {
     if (is_source_available()) {
         current_position++;
-        column_current++;
         return source_code[current_position - 1];
     }
     return '\0';
 }
 
-inline auto amun::Tokenizer::peek() -> char { return source_code[current_position]; }
+// Source buffer is null terminated so peek at the end of the source returns '\0'
+inline auto amun::Tokenizer::peek() -> char { return source_code.data()[current_position]; }
 
 auto amun::Tokenizer::peek_next() -> char
 {
@@ -661,159 +787,118 @@ inline auto amun::Tokenizer::is_alpha_num(char c) -> bool { return is_alpha(c) |
 
 inline auto amun::Tokenizer::is_underscore(char c) -> bool { return c == '_'; }
 
-auto amun::Tokenizer::hex_to_int(char c) -> int8_t
+// Scan runs of characters 16 bytes at a time, the tail of the source is scanned one by one
+auto amun::Tokenizer::skip_identifier_characters(const char* current, const char* end)
+    -> const char*
 {
-    return c <= '9' ? c - '0' : c <= 'F' ? c - 'A' : c - 'a';
+#if defined(__SSE2__)
+    const auto lower_a = _mm_set1_epi8('a' - 1);
+    const auto lower_z = _mm_set1_epi8('z' + 1);
+    const auto digit_0 = _mm_set1_epi8('0' - 1);
+    const auto digit_9 = _mm_set1_epi8('9' + 1);
+    const auto underscore = _mm_set1_epi8('_');
+    const auto lower_case_bit = _mm_set1_epi8(0x20);
+    while (end - current >= 16) {
+        auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+        auto lower = _mm_or_si128(chunk, lower_case_bit);
+        auto letters =
+            _mm_and_si128(_mm_cmpgt_epi8(lower, lower_a), _mm_cmplt_epi8(lower, lower_z));
+        auto digits =
+            _mm_and_si128(_mm_cmpgt_epi8(chunk, digit_0), _mm_cmplt_epi8(chunk, digit_9));
+        auto underscores = _mm_cmpeq_epi8(chunk, underscore);
+        auto mask = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(letters, digits), underscores));
+        if (mask != 0xFFFF) {
+            return current + llvm::countTrailingZeros(static_cast<uint32_t>(~mask));
+        }
+        current += 16;
+    }
+#endif
+    while (current < end && (is_alpha_num(*current) || is_underscore(*current))) {
+        current++;
+    }
+    return current;
 }
 
-auto amun::Tokenizer::hex_to_decimal(const std::string& hex) -> int64
+auto amun::Tokenizer::skip_whitespace_characters(const char* current, const char* end)
+    -> const char*
 {
-    try {
-        return std::stol(hex, nullptr, 16);
-    }
-    catch (...) {
-        return -1;
-    }
+#if defined(__SSE2__)
+    const auto space = _mm_set1_epi8(' ');
+    const auto tab = _mm_set1_epi8('\t');
+    const auto carriage_return = _mm_set1_epi8('\r');
+    const auto new_line = _mm_set1_epi8('\n');
+    while (end - current >= 16) {
+        auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+        auto spaces = _mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab));
+        auto lines = _mm_or_si128(_mm_cmpeq_epi8(chunk, carriage_return),
+                                  _mm_cmpeq_epi8(chunk, new_line));
+        auto mask = _mm_movemask_epi8(_mm_or_si128(spaces, lines));
+        if (mask != 0xFFFF) {
+            return current + llvm::countTrailingZeros(static_cast<uint32_t>(~mask));
+        }
+        current += 16;
+    }
+#endif
+    while (current < end &&
+           (*current == ' ' || *current == '\t' || *current == '\r' || *current == '\n')) {
+        current++;
+    }
+    return current;
 }
 
-auto amun::Tokenizer::binary_to_decimal(const std::string& binary) -> int64
+auto amun::Tokenizer::find_string_delimiter(const char* current, const char* end)
+    -> const char*
 {
-    try {
-        return std::stol(binary, nullptr, 2);
-    }
-    catch (...) {
-        return -1;
-    }
+#if defined(__SSE2__)
+    const auto quote = _mm_set1_epi8('"');
+    const auto backslash = _mm_set1_epi8('\\');
+    while (end - current >= 16) {
+        auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+        auto delimiters = _mm_or_si128(_mm_cmpeq_epi8(chunk, quote),
+                                       _mm_cmpeq_epi8(chunk, backslash));
+        auto mask = _mm_movemask_epi8(delimiters);
+        if (mask != 0) {
+            return current + llvm::countTrailingZeros(static_cast<uint32_t>(mask));
+        }
+        current += 16;
+    }
+#endif
+    while (current < end && *current != '"' && *current != '\\') {
+        current++;
+    }
+    return current;
 }
 
-auto amun::Tokenizer::octal_to_decimal(const std::string& octal) -> int64
+auto amun::Tokenizer::hex_to_int(char c) -> int8_t
 {
-    try {
-        return std::stol(octal, nullptr, 8);
-    }
-    catch (...) {
-        return -1;
-    }
+    return c <= '9' ? c - '0' : c <= 'F' ? c - 'A' : c - 'a';
 }
 
-auto amun::Tokenizer::resolve_keyword_token_kind(const char* keyword) -> TokenKind
+auto amun::Tokenizer::digits_to_decimal(std::string_view digits, int base) -> int64
 {
-    switch (strlen(keyword)) {
-    case 2: {
-        if (str2Equals("if", keyword)) {
-            return TokenKind::TOKEN_IF;
-        }
-        return TokenKind::TOKEN_IDENTIFIER;
-    }
-    case 3: {
-        if (str3Equals("fun", keyword)) {
-            return TokenKind::TOKEN_FUN;
-        }
-        if (str3Equals("var", keyword)) {
-            return TokenKind::TOKEN_VAR;
-        }
-        if (str3Equals("for", keyword)) {
-            return TokenKind::TOKEN_FOR;
-        }
-        return TokenKind::TOKEN_IDENTIFIER;
-    }
-    case 4: {
-        if (str4Equals("load", keyword)) {
-            return TokenKind::TOKEN_LOAD;
-        }
-        if (str4Equals("null", keyword)) {
-            return TokenKind::TOKEN_NULL;
-        }
-        if (str4Equals("true", keyword)) {
-            return TokenKind::TOKEN_TRUE;
-        }
-        if (str4Equals("cast", keyword)) {
-            return TokenKind::TOKEN_CAST;
-        }
-        if (str4Equals("else", keyword)) {
-            return TokenKind::TOKEN_ELSE;
-        }
-        if (str4Equals("enum", keyword)) {
-            return TokenKind::TOKEN_ENUM;
-        }
-        if (str4Equals("type", keyword)) {
-            return TokenKind::TOKEN_TYPE;
-        }
-        return TokenKind::TOKEN_IDENTIFIER;
-    }
-    case 5: {
-        if (str5Equals("while", keyword)) {
-            return TokenKind::TOKEN_WHILE;
-        }
-        if (str5Equals("defer", keyword)) {
-            return TokenKind::TOKEN_DEFER;
-        }
-        if (str5Equals("false", keyword)) {
-            return TokenKind::TOKEN_FALSE;
-        }
-        if (str5Equals("break", keyword)) {
-            return TokenKind::TOKEN_BREAK;
-        }
-        if (str5Equals("const", keyword)) {
-            return TokenKind::TOKEN_CONST;
-        }
-        return TokenKind::TOKEN_IDENTIFIER;
-    }
-    case 6: {
-        if (str6Equals("import", keyword)) {
-            return TokenKind::TOKEN_IMPORT;
-        }
-        if (str6Equals("struct", keyword)) {
-            return TokenKind::TOKEN_STRUCT;
-        }
-        if (str6Equals("return", keyword)) {
-            return TokenKind::TOKEN_RETURN;
-        }
-        if (str6Equals("switch", keyword)) {
-            return TokenKind::TOKEN_SWITCH;
-        }
-        return TokenKind::TOKEN_IDENTIFIER;
-    }
-    case 7: {
-        if (str7Equals("varargs", keyword)) {
-            return TokenKind::TOKEN_VARARGS;
-        }
-        return TokenKind::TOKEN_IDENTIFIER;
-    }
-    case 8: {
-        if (str8Equals("continue", keyword)) {
-            return TokenKind::TOKEN_CONTINUE;
-        }
-        if (str8Equals("operator", keyword)) {
-            return TokenKind::TOKEN_OPERATOR;
-        }
-        return TokenKind::TOKEN_IDENTIFIER;
-    }
-    case 9: {
-        if (str9Equals("type_size", keyword)) {
-            return TokenKind::TOKEN_TYPE_SIZE;
-        }
-        if (str9Equals("undefined", keyword)) {
-            return TokenKind::TOKEN_UNDEFINED;
-        }
-        return TokenKind::TOKEN_IDENTIFIER;
-    }
-    case 10: {
-        if (str10Equals("value_size", keyword)) {
-            return TokenKind::TOKEN_VALUE_SIZE;
-        }
-        return TokenKind::TOKEN_IDENTIFIER;
-    }
-    case 11: {
-        if (str11Equals("type_allign", keyword)) {
-            return TokenKind::TOKEN_TYPE_ALLIGN;
-        }
-        return TokenKind::TOKEN_IDENTIFIER;
-    }
-    default: {
+    // Only literals with digits separators need a copy without them
+    std::string digits_without_separators;
+    if (digits.find('_') != std::string_view::npos) {
+        digits_without_separators = digits;
+        digits_without_separators.erase(std::remove(digits_without_separators.begin(),
+                                                    digits_without_separators.end(), '_'),
+                                        digits_without_separators.end());
+        digits = digits_without_separators;
+    }
+
+    int64 value = 0;
+    auto [_, error] = std::from_chars(digits.data(), digits.data() + digits.size(), value, base);
+    return error == std::errc() ? value : -1;
+}
+
+auto amun::Tokenizer::resolve_keyword_token_kind(std::string_view keyword) -> TokenKind
+{
+    if (keyword.size() < keyword_min_length || keyword.size() > keyword_max_length) {
         return TokenKind::TOKEN_IDENTIFIER;
     }
-    }
+
+    const auto& slot = keywords_table[keyword_hash(keyword, keyword_seed)];
+    return slot.name == keyword ? slot.kind : TokenKind::TOKEN_IDENTIFIER;
 }
 
 auto amun::Tokenizer::get_source_file_id() -> int { return source_file_id; }
@@ -1,107 +1,23 @@
 #include "../include/amun_type.hpp"
 #include "../include/amun_primitives.hpp"
 
-auto amun::is_types_equals(const Shared<amun::Type>& type, const Shared<amun::Type>& other) -> bool
+auto amun::is_types_equals(amun::Type* type, amun::Type* other) -> bool
 {
-    const auto type_kind = type->type_kind;
-    const auto other_kind = other->type_kind;
-
-    if (type_kind == amun::TypeKind::NUMBER && other->type_kind == amun::TypeKind::NUMBER) {
-        auto type_number = std::static_pointer_cast<amun::NumberType>(type);
-        auto other_number = std::static_pointer_cast<amun::NumberType>(other);
-        return type_number->number_kind == other_number->number_kind;
-    }
-
-    if (type_kind == amun::TypeKind::POINTER && other->type_kind == amun::TypeKind::POINTER) {
-        auto type_ptr = std::static_pointer_cast<amun::PointerType>(type);
-        auto other_ptr = std::static_pointer_cast<amun::PointerType>(other);
-        return amun::is_types_equals(type_ptr->base_type, other_ptr->base_type);
-    }
-
-    if (type_kind == amun::TypeKind::STATIC_ARRAY &&
-        other->type_kind == amun::TypeKind::STATIC_ARRAY) {
-        auto type_array = std::static_pointer_cast<amun::StaticArrayType>(type);
-        auto other_array = std::static_pointer_cast<amun::StaticArrayType>(other);
-        return type_array->size == other_array->size &&
-               amun::is_types_equals(type_array->element_type, other_array->element_type);
-    }
-
-    if (type_kind == amun::TypeKind::STATIC_VECTOR &&
-        other->type_kind == amun::TypeKind::STATIC_VECTOR) {
-        auto type_vector = std::static_pointer_cast<amun::StaticVectorType>(type);
-        auto other_vector = std::static_pointer_cast<amun::StaticVectorType>(other);
-        return is_types_equals(type_vector->array, other_vector->array);
-    }
-
-    if (type_kind == amun::TypeKind::FUNCTION && other->type_kind == amun::TypeKind::FUNCTION) {
-        auto type_function = std::static_pointer_cast<amun::FunctionType>(type);
-        auto other_function = std::static_pointer_cast<amun::FunctionType>(other);
-        return amun::is_functions_types_equals(type_function, other_function);
-    }
-
-    if (type_kind == amun::TypeKind::STRUCT && other->type_kind == amun::TypeKind::STRUCT) {
-        auto type_struct = std::static_pointer_cast<amun::StructType>(type);
-        auto other_struct = std::static_pointer_cast<amun::StructType>(other);
-        return amun::get_type_literal(type_struct) == amun::get_type_literal(other_struct);
-    }
-
-    if (type_kind == amun::TypeKind::TUPLE && other->type_kind == amun::TypeKind::TUPLE) {
-        auto type_tuple = std::static_pointer_cast<amun::TupleType>(type);
-        auto other_tuple = std::static_pointer_cast<amun::TupleType>(other);
-        return amun::get_type_literal(type_tuple) == amun::get_type_literal(other_tuple);
-    }
-
-    if (type_kind == amun::TypeKind::ENUM_ELEMENT &&
-        other->type_kind == amun::TypeKind::ENUM_ELEMENT) {
-        auto type_element = std::static_pointer_cast<amun::EnumElementType>(type);
-        auto other_element = std::static_pointer_cast<amun::EnumElementType>(other);
-        return type_element->enum_name == other_element->enum_name;
-    }
-
-    if (type_kind == amun::TypeKind::GENERIC_STRUCT &&
-        other->type_kind == amun::TypeKind::GENERIC_STRUCT) {
-        auto type_element = std::static_pointer_cast<amun::GenericStructType>(type);
-        auto other_element = std::static_pointer_cast<amun::GenericStructType>(other);
-        if (!amun::is_types_equals(type_element->struct_type, other_element->struct_type)) {
-            return false;
-        }
-
-        auto type_parameters = type_element->parameters;
-        auto other_parameters = other_element->parameters;
-        if (type_parameters.size() != other_parameters.size()) {
-            return false;
-        }
-
-        for (size_t i = 0; i < type_parameters.size(); i++) {
-            if (!amun::is_types_equals(type_parameters[i], other_parameters[i])) {
-                return false;
-            }
-        }
-
+    // Types are uniqued by the type context so equal types are always the same object
+    if (type == other) {
         return true;
     }
 
-    return type_kind == other_kind;
-}
-
-auto amun::is_functions_types_equals(const Shared<amun::FunctionType>& type,
-                                     const Shared<amun::FunctionType>& other) -> bool
-{
-    const auto type_parameters = type->parameters;
-    const auto other_parameters = other->parameters;
-    const auto type_parameters_size = type_parameters.size();
-    if (type_parameters_size != other_parameters.size()) {
-        return false;
-    }
-    for (size_t i = 0; i < type_parameters_size; i++) {
-        if (!amun::is_types_equals(type_parameters[i], other_parameters[i])) {
-            return false;
-        }
+    // Generic parameters and enumerations are compared only by their kinds
+    const auto type_kind = type->type_kind;
+    if (type_kind == amun::TypeKind::GENERIC_PARAMETER || type_kind == amun::TypeKind::ENUM) {
+        return type_kind == other->type_kind;
     }
-    return amun::is_types_equals(type->return_type, other->return_type);
+
+    return false;
 }
 
-auto amun::can_types_casted(const Shared<amun::Type>& from, const Shared<amun::Type>& to) -> bool
+auto amun::can_types_casted(amun::Type* from, amun::Type* to) -> bool
 {
     const auto from_kind = from->type_kind;
     const auto to_kind = to->type_kind;
@@ -133,40 +49,40 @@ auto amun::can_types_casted(const Shared<amun::Type>& from, const Shared<amun::T
 
     // Casting Array to pointer of the same elemnet type
     if (from_kind == amun::TypeKind::STATIC_ARRAY && to_kind == amun::TypeKind::POINTER) {
-        auto from_array = std::static_pointer_cast<amun::StaticArrayType>(from);
-        auto to_pointer = std::static_pointer_cast<amun::PointerType>(to);
+        auto from_array = static_cast<amun::StaticArrayType*>(from);
+        auto to_pointer = static_cast<amun::PointerType*>(to);
         return amun::is_types_equals(from_array->element_type, to_pointer->base_type);
     }
 
     return false;
 }
 
-auto amun::get_type_literal(const Shared<amun::Type>& type) -> std::string
+auto amun::get_type_literal(amun::Type* type) -> std::string
 {
     const auto type_kind = type->type_kind;
     if (type_kind == amun::TypeKind::NUMBER) {
-        auto number_type = std::static_pointer_cast<amun::NumberType>(type);
+        auto number_type = static_cast<amun::NumberType*>(type);
         return amun::get_number_kind_literal(number_type->number_kind);
     }
 
     if (type_kind == amun::TypeKind::STATIC_ARRAY) {
-        auto array_type = std::static_pointer_cast<amun::StaticArrayType>(type);
+        auto array_type = static_cast<amun::StaticArrayType*>(type);
         return "[" + std::to_string(array_type->size) + "]" +
                amun::get_type_literal(array_type->element_type);
     }
 
     if (type_kind == amun::TypeKind::STATIC_VECTOR) {
-        auto vector_type = std::static_pointer_cast<amun::StaticVectorType>(type);
+        auto vector_type = static_cast<amun::StaticVectorType*>(type);
         return "@vec" + get_type_literal(vector_type->array);
     }
 
     if (type_kind == amun::TypeKind::POINTER) {
-        auto pointer_type = std::static_pointer_cast<amun::PointerType>(type);
+        auto pointer_type = static_cast<amun::PointerType*>(type);
         return "*" + amun::get_type_literal(pointer_type->base_type);
     }
 
     if (type_kind == amun::TypeKind::FUNCTION) {
-        const auto function_type = std::static_pointer_cast<amun::FunctionType>(type);
+        const auto function_type = static_cast<amun::FunctionType*>(type);
 
         std::stringstream string_stream;
         string_stream << "(";
@@ -182,12 +98,12 @@ auto amun::get_type_literal(const Shared<amun::Type>& type) -> std::string
     }
 
     if (type_kind == amun::TypeKind::STRUCT) {
-        auto struct_type = std::static_pointer_cast<amun::StructType>(type);
+        auto struct_type = static_cast<amun::StructType*>(type);
         return struct_type->name;
     }
 
     if (type_kind == amun::TypeKind::TUPLE) {
-        auto tuple_type = std::static_pointer_cast<amun::TupleType>(type);
+        auto tuple_type = static_cast<amun::TupleType*>(type);
         std::stringstream string_stream;
         string_stream << "(";
         auto number_of_fields = tuple_type->fields_types.size();
@@ -204,17 +120,17 @@ auto amun::get_type_literal(const Shared<amun::Type>& type) -> std::string
     }
 
     if (type_kind == amun::TypeKind::ENUM) {
-        auto enum_type = std::static_pointer_cast<amun::EnumType>(type);
-        return enum_type->name.literal;
+        auto enum_type = static_cast<amun::EnumType*>(type);
+        return std::string(enum_type->name.literal);
     }
 
     if (type_kind == amun::TypeKind::ENUM_ELEMENT) {
-        auto enum_element = std::static_pointer_cast<amun::EnumElementType>(type);
+        auto enum_element = static_cast<amun::EnumElementType*>(type);
         return enum_element->enum_name;
     }
 
     if (type_kind == amun::TypeKind::GENERIC_STRUCT) {
-        auto generic_struct = std::static_pointer_cast<amun::GenericStructType>(type);
+        auto generic_struct = static_cast<amun::GenericStructType*>(type);
 
         std::stringstream string_stream;
         string_stream << amun::get_type_literal(generic_struct->struct_type);
@@ -233,7 +149,7 @@ auto amun::get_type_literal(const Shared<amun::Type>& type) -> std::string
     }
 
     if (type_kind == amun::TypeKind::GENERIC_PARAMETER) {
-        auto generic_parameter = std::static_pointer_cast<amun::GenericParameterType>(type);
+        auto generic_parameter = static_cast<amun::GenericParameterType*>(type);
         return generic_parameter->name;
     }
 
@@ -270,15 +186,15 @@ auto amun::get_number_kind_literal(amun::NumberKind kind) -> const char*
     }
 }
 
-auto amun::is_number_type(Shared<amun::Type> type) -> bool
+auto amun::is_number_type(amun::Type* type) -> bool
 {
     return type->type_kind == amun::TypeKind::NUMBER;
 }
 
-auto amun::is_integer_type(Shared<amun::Type> type) -> bool
+auto amun::is_integer_type(amun::Type* type) -> bool
 {
     if (type->type_kind == amun::TypeKind::NUMBER) {
-        auto number_type = std::static_pointer_cast<amun::NumberType>(type);
+        auto number_type = static_cast<amun::NumberType*>(type);
         auto number_kind = number_type->number_kind;
         return number_kind != amun::NumberKind::FLOAT_32 &&
                number_kind != amun::NumberKind::FLOAT_64;
@@ -286,10 +202,10 @@ auto amun::is_integer_type(Shared<amun::Type> type) -> bool
     return false;
 }
 
-auto amun::is_signed_integer_type(Shared<amun::Type> type) -> bool
+auto amun::is_signed_integer_type(amun::Type* type) -> bool
 {
     if (type->type_kind == amun::TypeKind::NUMBER) {
-        auto number_type = std::static_pointer_cast<amun::NumberType>(type);
+        auto number_type = static_cast<amun::NumberType*>(type);
         auto number_kind = number_type->number_kind;
         return number_kind == amun::NumberKind::INTEGER_1 ||
                number_kind == amun::NumberKind::INTEGER_8 ||
@@ -300,10 +216,10 @@ auto amun::is_signed_integer_type(Shared<amun::Type> type) -> bool
     return false;
 }
 
-auto amun::is_unsigned_integer_type(Shared<amun::Type> type) -> bool
+auto amun::is_unsigned_integer_type(amun::Type* type) -> bool
 {
     if (type->type_kind == amun::TypeKind::NUMBER) {
-        auto number_type = std::static_pointer_cast<amun::NumberType>(type);
+        auto number_type = static_cast<amun::NumberType*>(type);
         auto number_kind = number_type->number_kind;
         return number_kind == amun::NumberKind::U_INTEGER_8 ||
                number_kind == amun::NumberKind::U_INTEGER_16 ||
@@ -313,137 +229,137 @@ auto amun::is_unsigned_integer_type(Shared<amun::Type> type) -> bool
     return false;
 }
 
-auto amun::is_integer1_type(Shared<amun::Type> type) -> bool
+auto amun::is_integer1_type(amun::Type* type) -> bool
 {
     if (type->type_kind == amun::TypeKind::NUMBER) {
-        auto number_type = std::static_pointer_cast<amun::NumberType>(type);
+        auto number_type = static_cast<amun::NumberType*>(type);
         return number_type->number_kind == amun::NumberKind::INTEGER_1;
     }
     return false;
 }
 
-auto amun::is_integer32_type(Shared<amun::Type> type) -> bool
+auto amun::is_integer32_type(amun::Type* type) -> bool
 {
     if (type->type_kind == amun::TypeKind::NUMBER) {
-        auto number_type = std::static_pointer_cast<amun::NumberType>(type);
+        auto number_type = static_cast<amun::NumberType*>(type);
         return number_type->number_kind == amun::NumberKind::INTEGER_32;
     }
     return false;
 }
 
-auto amun::is_integer64_type(Shared<amun::Type> type) -> bool
+auto amun::is_integer64_type(amun::Type* type) -> bool
 {
     if (type->type_kind == amun::TypeKind::NUMBER) {
-        auto number_type = std::static_pointer_cast<amun::NumberType>(type);
+        auto number_type = static_cast<amun::NumberType*>(type);
         return number_type->number_kind == amun::NumberKind::INTEGER_64;
     }
     return false;
 }
 
-auto amun::is_enum_type(Shared<amun::Type> type) -> bool
+auto amun::is_enum_type(amun::Type* type) -> bool
 {
     return type->type_kind == amun::TypeKind::ENUM;
 }
 
-auto amun::is_enum_element_type(Shared<amun::Type> type) -> bool
+auto amun::is_enum_element_type(amun::Type* type) -> bool
 {
     return type->type_kind == amun::TypeKind::ENUM_ELEMENT;
 }
 
-auto amun::is_struct_type(Shared<amun::Type> type) -> bool
+auto amun::is_struct_type(amun::Type* type) -> bool
 {
     return type->type_kind == amun::TypeKind::STRUCT;
 }
 
-auto amun::is_generic_struct_type(Shared<amun::Type> type) -> bool
+auto amun::is_generic_struct_type(amun::Type* type) -> bool
 {
     return type->type_kind == amun::TypeKind::GENERIC_STRUCT;
 }
 
-auto amun::is_tuple_type(Shared<amun::Type> type) -> bool
+auto amun::is_tuple_type(amun::Type* type) -> bool
 {
     return type->type_kind == amun::TypeKind::TUPLE;
 }
 
-auto amun::is_boolean_type(Shared<amun::Type> type) -> bool
+auto amun::is_boolean_type(amun::Type* type) -> bool
 {
     if (type->type_kind == amun::TypeKind::NUMBER) {
-        auto number_type = std::static_pointer_cast<amun::NumberType>(type);
+        auto number_type = static_cast<amun::NumberType*>(type);
         return number_type->number_kind == amun::NumberKind::INTEGER_1;
     }
     return false;
 }
 
-auto amun::is_function_type(Shared<amun::Type> type) -> bool
+auto amun::is_function_type(amun::Type* type) -> bool
 {
     return type->type_kind == amun::TypeKind::FUNCTION;
 }
 
-auto amun::is_function_pointer_type(Shared<amun::Type> type) -> bool
+auto amun::is_function_pointer_type(amun::Type* type) -> bool
 {
     if (amun::is_pointer_type(type)) {
-        auto pointer = std::static_pointer_cast<amun::PointerType>(type);
+        auto pointer = static_cast<amun::PointerType*>(type);
         return amun::is_function_type(pointer->base_type);
     }
     return false;
 }
 
-auto amun::is_array_type(Shared<amun::Type> type) -> bool
+auto amun::is_array_type(amun::Type* type) -> bool
 {
     return type->type_kind == amun::TypeKind::STATIC_ARRAY;
 }
 
-auto amun::is_vector_type(Shared<amun::Type> type) -> bool
+auto amun::is_vector_type(amun::Type* type) -> bool
 {
     return type->type_kind == amun::TypeKind::STATIC_VECTOR;
 }
 
-auto amun::is_pointer_type(Shared<amun::Type> type) -> bool
+auto amun::is_pointer_type(amun::Type* type) -> bool
 {
     return type->type_kind == amun::TypeKind::POINTER;
 }
 
-auto amun::is_void_type(Shared<amun::Type> type) -> bool
+auto amun::is_void_type(amun::Type* type) -> bool
 {
     return type->type_kind == amun::TypeKind::VOID;
 }
 
-auto amun::is_null_type(Shared<amun::Type> type) -> bool
+auto amun::is_null_type(amun::Type* type) -> bool
 {
     return type->type_kind == amun::TypeKind::NILL;
 }
 
-auto amun::is_none_type(Shared<amun::Type> type) -> bool
+auto amun::is_none_type(amun::Type* type) -> bool
 {
     const auto type_kind = type->type_kind;
 
     if (type_kind == amun::TypeKind::STATIC_ARRAY) {
-        auto array_type = std::static_pointer_cast<amun::StaticArrayType>(type);
+        auto array_type = static_cast<amun::StaticArrayType*>(type);
         return array_type->element_type->type_kind == amun::TypeKind::NONE;
     }
 
     if (type_kind == amun::TypeKind::POINTER) {
-        auto array_type = std::static_pointer_cast<amun::PointerType>(type);
+        auto array_type = static_cast<amun::PointerType*>(type);
         return array_type->base_type->type_kind == amun::TypeKind::NONE;
     }
 
     return type->type_kind == amun::TypeKind::NONE;
 }
 
-auto amun::is_pointer_of_type(Shared<amun::Type> type, Shared<amun::Type> base) -> bool
+auto amun::is_pointer_of_type(amun::Type* type, amun::Type* base) -> bool
 {
     if (type->type_kind != amun::TypeKind::POINTER) {
         return false;
     }
-    auto pointer_type = std::static_pointer_cast<amun::PointerType>(type);
+    auto pointer_type = static_cast<amun::PointerType*>(type);
     return amun::is_types_equals(pointer_type->base_type, base);
 }
 
-auto amun::is_array_of_type(Shared<amun::Type> type, Shared<amun::Type> base) -> bool
+auto amun::is_array_of_type(amun::Type* type, amun::Type* base) -> bool
 {
     if (type->type_kind != amun::TypeKind::STATIC_ARRAY) {
         return false;
     }
-    auto array_type = std::static_pointer_cast<amun::StaticArrayType>(type);
+    auto array_type = static_cast<amun::StaticArrayType*>(type);
     return amun::is_types_equals(array_type->element_type, base);
 }
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include "../include/amun_type_context.hpp"
+#include "../include/amun_name_mangle.hpp"
+#include "../include/amun_primitives.hpp"
+
+#include <llvm/ADT/Hashing.h>
+
+amun::TypeContext::TypeContext()
+{
+    // Primitive pointers are shared globals so they must be found when uniquing pointers
+    pointer_types[amun::i8_type] = amun::i8_ptr_type;
+    pointer_types[amun::i32_type] = amun::i32_ptr_type;
+    pointer_types[amun::none_type] = amun::none_ptr_type;
+}
+
+auto amun::TypeContext::number_type(amun::NumberKind kind) -> amun::NumberType*
+{
+    switch (kind) {
+    case amun::NumberKind::INTEGER_1: return amun::i1_type;
+    case amun::NumberKind::INTEGER_8: return amun::i8_type;
+    case amun::NumberKind::INTEGER_16: return amun::i6_type;
+    case amun::NumberKind::INTEGER_32: return amun::i32_type;
+    case amun::NumberKind::INTEGER_64: return amun::i64_type;
+    case amun::NumberKind::U_INTEGER_8: return amun::u8_type;
+    case amun::NumberKind::U_INTEGER_16: return amun::u16_type;
+    case amun::NumberKind::U_INTEGER_32: return amun::u32_type;
+    case amun::NumberKind::U_INTEGER_64: return amun::u64_type;
+    case amun::NumberKind::FLOAT_32: return amun::f32_type;
+    case amun::NumberKind::FLOAT_64: return amun::f64_type;
+    }
+    return amun::i64_type;
+}
+
+auto amun::TypeContext::pointer_type(amun::Type* base_type) -> amun::PointerType*
+{
+    auto& pointer_type = pointer_types[base_type];
+    if (pointer_type == nullptr) {
+        pointer_type = create<amun::PointerType>(base_type);
+    }
+    return pointer_type;
+}
+
+auto amun::TypeContext::static_array_type(amun::Type* element_type, size_t size)
+    -> amun::StaticArrayType*
+{
+    auto& array_type = static_array_types[{element_type, size}];
+    if (array_type == nullptr) {
+        array_type = create<amun::StaticArrayType>(element_type, size);
+    }
+    return array_type;
+}
+
+auto amun::TypeContext::static_vector_type(amun::StaticArrayType* array)
+    -> amun::StaticVectorType*
+{
+    auto& vector_type = static_vector_types[array];
+    if (vector_type == nullptr) {
+        vector_type = create<amun::StaticVectorType>(array);
+    }
+    return vector_type;
+}
+
+auto amun::TypeContext::tuple_type(const std::vector<amun::Type*>& fields_types)
+    -> amun::TupleType*
+{
+    auto& tuple_type = tuple_types[fields_types];
+    if (tuple_type == nullptr) {
+        tuple_type = create<amun::TupleType>("_tuple_" + mangle_types(fields_types), fields_types);
+    }
+    return tuple_type;
+}
+
+auto amun::TypeContext::function_type(const std::vector<amun::Type*>& parameters,
+                                      amun::Type* return_type, bool varargs,
+                                      amun::Type* varargs_type, bool is_intrinsic,
+                                      bool is_generic,
+                                      const std::vector<std::string>& generic_names,
+                                      int implicit_parameters_count) -> amun::FunctionType*
+{
+    FunctionTypeKey key = {parameters,   return_type, varargs,       varargs_type,
+                           is_intrinsic, is_generic,  generic_names, implicit_parameters_count};
+    auto& function_type = function_types[key];
+    if (function_type == nullptr) {
+        function_type = create<amun::FunctionType>(parameters, return_type, varargs, varargs_type,
+                                                   is_intrinsic, is_generic, generic_names,
+                                                   implicit_parameters_count);
+    }
+    return function_type;
+}
+
+auto amun::TypeContext::generic_struct_type(amun::StructType* struct_type,
+                                            const std::vector<amun::Type*>& parameters)
+    -> amun::GenericStructType*
+{
+    // Key is the generic structure type followed by the parameters types
+    std::vector<amun::Type*> key;
+    key.reserve(parameters.size() + 1);
+    key.push_back(struct_type);
+    key.insert(key.end(), parameters.begin(), parameters.end());
+
+    auto& generic_struct_type = generic_struct_types[key];
+    if (generic_struct_type == nullptr) {
+        generic_struct_type = create<amun::GenericStructType>(struct_type, parameters);
+    }
+    return generic_struct_type;
+}
+
+auto amun::TypeContext::generic_struct_instance(amun::GenericStructType* generic_struct)
+    -> amun::StructType*
+{
+    auto instance = generic_struct_instances.find(generic_struct);
+    if (instance == generic_struct_instances.end()) {
+        return nullptr;
+    }
+    return instance->second;
+}
+
+auto amun::TypeContext::define_generic_struct_instance(amun::GenericStructType* generic_struct,
+                                                       amun::StructType* instance) -> void
+{
+    generic_struct_instances[generic_struct] = instance;
+}
+
+auto amun::TypeContext::enum_element_type(const std::string& enum_name, amun::Type* element_type)
+    -> amun::EnumElementType*
+{
+    auto& enum_element_type = enum_element_types[enum_name];
+    if (enum_element_type == nullptr) {
+        enum_element_type = create<amun::EnumElementType>(enum_name, element_type);
+    }
+    return enum_element_type;
+}
+
+auto amun::TypeContext::generic_parameter_type(const std::string& name)
+    -> amun::GenericParameterType*
+{
+    auto& generic_parameter_type = generic_parameter_types[name];
+    if (generic_parameter_type == nullptr) {
+        generic_parameter_type = create<amun::GenericParameterType>(name);
+    }
+    return generic_parameter_type;
+}
+
+auto amun::TypeContext::TypesListHash::operator()(const std::vector<amun::Type*>& types) const
+    -> size_t
+{
+    return llvm::hash_combine_range(types.begin(), types.end());
+}
+
+auto amun::TypeContext::FunctionTypeKeyHash::operator()(const FunctionTypeKey& key) const
+    -> size_t
+{
+    return llvm::hash_combine(
+        llvm::hash_combine_range(key.parameters.begin(), key.parameters.end()), key.return_type,
+        key.has_varargs, key.varargs_type, key.is_intrinsic, key.is_generic,
+        llvm::hash_combine_range(key.generic_names.begin(), key.generic_names.end()),
+        key.implicit_parameters_count);
+}
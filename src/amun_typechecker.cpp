@@ -5,7 +5,8 @@
 #include "../include/amun_name_mangle.hpp"
 #include "../include/amun_type.hpp"
 
-#include <any>
+#include <llvm/Support/TimeProfiler.h>
+
 #include <cassert>
 #include <limits>
 #include <memory>
@@ -15,7 +16,7 @@
 #include <unordered_set>
 #include <vector>
 
-auto amun::TypeChecker::check_compilation_unit(Shared<CompilationUnit> compilation_unit) -> void
+auto amun::TypeChecker::check_compilation_unit(CompilationUnit* compilation_unit) -> void
 {
     auto statements = compilation_unit->tree_nodes;
     try {
@@ -28,7 +29,7 @@ auto amun::TypeChecker::check_compilation_unit(Shared<CompilationUnit> compilati
     }
 }
 
-auto amun::TypeChecker::visit(BlockStatement* node) -> std::any
+auto amun::TypeChecker::visit(BlockStatement* node) -> amun::Type*
 {
     push_new_scope();
     for (const auto& statement : node->statements) {
@@ -38,14 +39,14 @@ auto amun::TypeChecker::visit(BlockStatement* node) -> std::any
         // diagnostics engine first
     }
     pop_current_scope();
-    return 0;
+    return nullptr;
 }
 
-auto amun::TypeChecker::visit(FieldDeclaration* node) -> std::any
+auto amun::TypeChecker::visit(FieldDeclaration* node) -> amun::Type*
 {
     auto left_type = node->has_explicit_type ? resolve_generic_type(node->type) : amun::none_type;
     auto right_value = node->value;
-    auto name = node->name.literal;
+    auto name = std::string(node->name.literal);
 
     bool should_update_node_type = true;
 
@@ -54,7 +55,7 @@ auto amun::TypeChecker::visit(FieldDeclaration* node) -> std::any
     // type
     if (right_value != nullptr) {
         auto origin_right_value_type = right_value->get_type_node();
-        auto right_type = node_amun_type(right_value->accept(this));
+        auto right_type = right_value->accept(this);
 
         // Prevent declaring field with void type
         if (amun::is_void_type(right_type)) {
@@ -129,7 +130,7 @@ auto amun::TypeChecker::visit(FieldDeclaration* node) -> std::any
         }
 
         if (is_left_ptr_type and is_right_null_type) {
-            auto null_expr = std::dynamic_pointer_cast<NullExpression>(node->value);
+            auto null_expr = dynamic_cast<NullExpression*>(node->value);
             null_expr->null_base_type = left_type;
             is_type_updated = true;
         }
@@ -159,10 +160,10 @@ auto amun::TypeChecker::visit(FieldDeclaration* node) -> std::any
         }
     }
 
-    return 0;
+    return nullptr;
 }
 
-auto amun::TypeChecker::visit(DestructuringDeclaraion* node) -> std::any
+auto amun::TypeChecker::visit(DestructuringDeclaraion* node) -> amun::Type*
 {
     auto position = node->equal_token.position;
 
@@ -171,13 +172,13 @@ auto amun::TypeChecker::visit(DestructuringDeclaraion* node) -> std::any
         throw "Stop";
     }
 
-    auto value = node_amun_type(node->value->accept(this));
+    auto value = node->value->accept(this);
     if (!amun::is_tuple_type(value)) {
         context->diagnostics.report_error(position, "value type must be a tuple");
         throw "Stop";
     }
 
-    auto tuple_value = std::static_pointer_cast<amun::TupleType>(value);
+    auto tuple_value = static_cast<amun::TupleType*>(value);
     auto tuple_field_types = tuple_value->fields_types;
     auto tuple_size = tuple_field_types.size();
 
@@ -199,46 +200,47 @@ auto amun::TypeChecker::visit(DestructuringDeclaraion* node) -> std::any
             throw "Stop";
         }
 
-        bool is_first_defined = types_table.define(node->names[i].literal, node->types[i]);
+        bool is_first_defined =
+            types_table.define(std::string(node->names[i].literal), node->types[i]);
         if (!is_first_defined) {
             context->diagnostics.report_error(node->names[i].position,
-                                              "Field " + node->names[i].literal +
+                                              "Field " + std::string(node->names[i].literal) +
                                                   " is defined twice in the same scope");
             throw "Stop";
         }
     }
 
-    return 0;
+    return nullptr;
 }
 
-auto amun::TypeChecker::visit(ConstDeclaration* node) -> std::any
+auto amun::TypeChecker::visit(ConstDeclaration* node) -> amun::Type*
 {
-    auto name = node->name.literal;
-    auto type = node_amun_type(node->value->accept(this));
+    auto name = std::string(node->name.literal);
+    auto type = node->value->accept(this);
     bool is_first_defined = types_table.define(name, type);
     if (!is_first_defined) {
         context->diagnostics.report_error(node->name.position,
                                           "Field " + name + " is defined twice in the same scope");
         throw "Stop";
     }
-    return 0;
+    return nullptr;
 }
 
-auto amun::TypeChecker::visit(FunctionPrototype* node) -> std::any
+auto amun::TypeChecker::visit(FunctionPrototype* node) -> amun::Type*
 {
     auto name = node->name;
-    std::vector<Shared<amun::Type>> parameters;
+    std::vector<amun::Type*> parameters;
     parameters.reserve(node->parameters.size());
     for (const auto& parameter : node->parameters) {
         parameters.push_back(parameter->type);
     }
     auto return_type = node->return_type;
-    auto function_type = std::make_shared<amun::FunctionType>(
-        name, parameters, return_type, node->has_varargs, node->varargs_type);
+    auto function_type = context->type_context.function_type(
+        parameters, return_type, node->has_varargs, node->varargs_type);
 
-    bool is_first_defined = types_table.define(name.literal, function_type);
+    bool is_first_defined = types_table.define(std::string(name.literal), function_type);
     if (not is_first_defined) {
-        context->diagnostics.report_error(name.position, "function " + name.literal +
+        context->diagnostics.report_error(name.position, "function " + std::string(name.literal) +
                                                              " is defined twice in the same scope");
         throw "Stop";
     }
@@ -246,43 +248,46 @@ auto amun::TypeChecker::visit(FunctionPrototype* node) -> std::any
     return function_type;
 }
 
-auto amun::TypeChecker::visit(IntrinsicPrototype* node) -> std::any
+auto amun::TypeChecker::visit(IntrinsicPrototype* node) -> amun::Type*
 {
     auto name = node->name;
 
-    std::vector<Shared<amun::Type>> parameters;
+    std::vector<amun::Type*> parameters;
     parameters.reserve(node->parameters.size());
     for (auto& parameter : node->parameters) {
         parameters.push_back(parameter->type);
     }
 
     auto return_type = node->return_type;
-    auto function_type = std::make_shared<amun::FunctionType>(
-        name, parameters, return_type, node->varargs, node->varargs_type, true);
-    bool is_first_defined = types_table.define(name.literal, function_type);
+    auto function_type = context->type_context.function_type(
+        parameters, return_type, node->varargs, node->varargs_type, true);
+    bool is_first_defined = types_table.define(std::string(name.literal), function_type);
     if (not is_first_defined) {
-        context->diagnostics.report_error(name.position, "function " + name.literal +
+        context->diagnostics.report_error(name.position, "function " + std::string(name.literal) +
                                                              " is defined twice in the same scope");
         throw "Stop";
     }
+    context->intrinsics.insert(node->native_name);
     return function_type;
 }
 
-auto amun::TypeChecker::visit(FunctionDeclaration* node) -> std::any
+auto amun::TypeChecker::visit(FunctionDeclaration* node) -> amun::Type*
 {
     auto prototype = node->prototype;
     if (prototype->is_generic) {
-        generic_functions_declaraions[prototype->name.literal] = node;
-        return 0;
+        generic_functions_declaraions[std::string(prototype->name.literal)] = node;
+        return nullptr;
     }
 
-    auto function_type = node_amun_type(node->prototype->accept(this));
-    auto function = std::static_pointer_cast<amun::FunctionType>(function_type);
+    llvm::TimeTraceScope trace_scope("Type check function", prototype->name.literal);
+
+    auto function_type = node->prototype->accept(this);
+    auto function = static_cast<amun::FunctionType*>(function_type);
     return_types_stack.push(function->return_type);
 
     push_new_scope();
     for (auto& parameter : prototype->parameters) {
-        types_table.define(parameter->name.literal, parameter->type);
+        types_table.define(std::string(parameter->name.literal), parameter->type);
     }
 
     auto function_body = node->body;
@@ -305,7 +310,7 @@ auto amun::TypeChecker::visit(FunctionDeclaration* node) -> std::any
     return function_type;
 }
 
-auto amun::TypeChecker::visit(OperatorFunctionDeclaraion* node) -> std::any
+auto amun::TypeChecker::visit(OperatorFunctionDeclaraion* node) -> amun::Type*
 {
     auto prototype = node->function->prototype;
     auto paramters = prototype->parameters;
@@ -332,7 +337,7 @@ auto amun::TypeChecker::visit(OperatorFunctionDeclaraion* node) -> std::any
     return node->function->accept(this);
 }
 
-auto amun::TypeChecker::visit(StructDeclaration* node) -> std::any
+auto amun::TypeChecker::visit(StructDeclaration* node) -> amun::Type*
 {
     auto struct_type = node->struct_type;
     // Generic struct are a template and should defined
@@ -343,10 +348,10 @@ auto amun::TypeChecker::visit(StructDeclaration* node) -> std::any
     return nullptr;
 }
 
-auto amun::TypeChecker::visit(EnumDeclaration* node) -> std::any
+auto amun::TypeChecker::visit(EnumDeclaration* node) -> amun::Type*
 {
-    auto name = node->name.literal;
-    auto enum_type = std::static_pointer_cast<amun::EnumType>(node->enum_type);
+    auto name = std::string(node->name.literal);
+    auto enum_type = static_cast<amun::EnumType*>(node->enum_type);
     auto enum_element_type = enum_type->element_type;
     if (!amun::is_integer_type(enum_element_type)) {
         context->diagnostics.report_error(node->name.position,
@@ -367,13 +372,13 @@ auto amun::TypeChecker::visit(EnumDeclaration* node) -> std::any
             node->name.position, "enumeration " + name + " is defined twice in the same scope");
         throw "Stop";
     }
-    return is_first_defined;
+    return nullptr;
 }
 
-auto amun::TypeChecker::visit(IfStatement* node) -> std::any
+auto amun::TypeChecker::visit(IfStatement* node) -> amun::Type*
 {
     for (auto& conditional_block : node->conditional_blocks) {
-        auto condition = node_amun_type(conditional_block->condition->accept(this));
+        auto condition = conditional_block->condition->accept(this);
         if (!amun::is_number_type(condition)) {
             context->diagnostics.report_error(conditional_block->position.position,
                                               "if condition mush be a number but got " +
@@ -384,19 +389,19 @@ auto amun::TypeChecker::visit(IfStatement* node) -> std::any
         conditional_block->body->accept(this);
         pop_current_scope();
     }
-    return 0;
+    return nullptr;
 }
 
-auto amun::TypeChecker::visit(ForRangeStatement* node) -> std::any
+auto amun::TypeChecker::visit(ForRangeStatement* node) -> amun::Type*
 {
-    const auto start_type = node_amun_type(node->range_start->accept(this));
-    const auto end_type = node_amun_type(node->range_end->accept(this));
+    const auto start_type = node->range_start->accept(this);
+    const auto end_type = node->range_end->accept(this);
 
     // For range start and end must be number type and has the same exacily type
     if (amun::is_number_type(start_type) && amun::is_types_equals(start_type, end_type)) {
         // User declared step must be the same type as range start and end
         if (node->step) {
-            const auto step_type = node_amun_type(node->step->accept(this));
+            const auto step_type = node->step->accept(this);
             if (!amun::is_types_equals(step_type, start_type)) {
                 context->diagnostics.report_error(
                     node->position.position,
@@ -410,12 +415,15 @@ auto amun::TypeChecker::visit(ForRangeStatement* node) -> std::any
 
         // Define element name only inside loop scope
         types_table.define(node->element_name, start_type);
+        auto loop_level = static_cast<int>(types_table.size()) - 1;
+        loop_variables.emplace_back(node->element_name, loop_level);
 
         node->body->accept(this);
 
+        loop_variables.pop_back();
         pop_current_scope();
 
-        return 0;
+        return nullptr;
     }
 
     context->diagnostics.report_error(node->position.position,
@@ -423,9 +431,9 @@ auto amun::TypeChecker::visit(ForRangeStatement* node) -> std::any
     throw "Stop";
 }
 
-auto amun::TypeChecker::visit(ForEachStatement* node) -> std::any
+auto amun::TypeChecker::visit(ForEachStatement* node) -> amun::Type*
 {
-    auto collection_type = node_amun_type(node->collection->accept(this));
+    auto collection_type = node->collection->accept(this);
     auto is_array_type = collection_type->type_kind == amun::TypeKind::STATIC_ARRAY;
     auto is_string_type = amun::is_pointer_of_type(collection_type, amun::i8_type);
     auto is_vector_type = collection_type->type_kind == TypeKind::STATIC_VECTOR;
@@ -443,12 +451,12 @@ auto amun::TypeChecker::visit(ForEachStatement* node) -> std::any
         // Define element name only inside loop scope
         if (is_array_type) {
             // If paramter is array, set element type to array elmenet type
-            auto array_type = std::static_pointer_cast<amun::StaticArrayType>(collection_type);
+            auto array_type = static_cast<amun::StaticArrayType*>(collection_type);
             types_table.define(node->element_name, array_type->element_type);
         }
         else if (is_vector_type) {
             // If paramter is vector, set element type to vector elmenet type
-            auto vector_type = std::static_pointer_cast<amun::StaticVectorType>(collection_type);
+            auto vector_type = static_cast<amun::StaticVectorType*>(collection_type);
             types_table.define(node->element_name, vector_type->array->element_type);
         }
         else {
@@ -463,23 +471,32 @@ auto amun::TypeChecker::visit(ForEachStatement* node) -> std::any
         types_table.define(node->index_name, amun::i64_type);
     }
 
+    auto loop_variables_count = loop_variables.size();
+    auto loop_level = static_cast<int>(types_table.size()) - 1;
+    for (const auto& name : {node->element_name, node->index_name}) {
+        if (name != "_") {
+            loop_variables.emplace_back(name, loop_level);
+        }
+    }
+
     node->body->accept(this);
 
+    loop_variables.resize(loop_variables_count);
     pop_current_scope();
-    return 0;
+    return nullptr;
 }
 
-auto amun::TypeChecker::visit(ForeverStatement* node) -> std::any
+auto amun::TypeChecker::visit(ForeverStatement* node) -> amun::Type*
 {
     push_new_scope();
     node->body->accept(this);
     pop_current_scope();
-    return 0;
+    return nullptr;
 }
 
-auto amun::TypeChecker::visit(WhileStatement* node) -> std::any
+auto amun::TypeChecker::visit(WhileStatement* node) -> amun::Type*
 {
-    auto left_type = node_amun_type(node->condition->accept(this));
+    auto left_type = node->condition->accept(this);
     if (!amun::is_number_type(left_type)) {
         context->diagnostics.report_error(node->keyword.position,
                                           "While condition mush be a number but got " +
@@ -489,13 +506,13 @@ auto amun::TypeChecker::visit(WhileStatement* node) -> std::any
     push_new_scope();
     node->body->accept(this);
     pop_current_scope();
-    return 0;
+    return nullptr;
 }
 
-auto amun::TypeChecker::visit(SwitchStatement* node) -> std::any
+auto amun::TypeChecker::visit(SwitchStatement* node) -> amun::Type*
 {
     // Check that switch argument is integer type
-    auto argument = node_amun_type(node->argument->accept(this));
+    auto argument = node->argument->accept(this);
     auto position = node->keyword.position;
 
     bool is_argment_enum_type = amun::is_enum_element_type(argument);
@@ -525,15 +542,14 @@ auto amun::TypeChecker::visit(SwitchStatement* node) -> std::any
                 auto value_node_type = value->get_ast_node_type();
                 if (value_node_type == AstNodeType::AST_ENUM_ELEMENT) {
                     if (is_argment_enum_type) {
-                        auto enum_access = std::dynamic_pointer_cast<EnumAccessExpression>(value);
-                        auto enum_element =
-                            std::static_pointer_cast<amun::EnumElementType>(argument);
+                        auto enum_access = dynamic_cast<EnumAccessExpression*>(value);
+                        auto enum_element = static_cast<amun::EnumElementType*>(argument);
                         if (enum_access->enum_name.literal != enum_element->enum_name) {
                             context->diagnostics.report_error(
                                 branch_position, "Switch argument and case are elements of "
                                                  "different enums " +
                                                      enum_element->enum_name + " and " +
-                                                     enum_access->enum_name.literal);
+                                                     std::string(enum_access->enum_name.literal));
                             throw "Stop";
                         }
 
@@ -557,7 +573,7 @@ auto amun::TypeChecker::visit(SwitchStatement* node) -> std::any
                 if (value_node_type == AstNodeType::AST_NUMBER) {
                     if (is_argument_num_type) {
                         // If it a number type we must check that it integer
-                        auto value_type = node_amun_type(value->accept(this));
+                        auto value_type = value->accept(this);
                         if (!amun::is_number_type(value_type)) {
                             context->diagnostics.report_error(
                                 branch_position, "Switch case value must be an integer but found " +
@@ -565,8 +581,8 @@ auto amun::TypeChecker::visit(SwitchStatement* node) -> std::any
                             throw "Stop";
                         }
 
-                        auto number = std::dynamic_pointer_cast<NumberExpression>(value);
-                        if (!cases_values.insert(number->value.literal).second) {
+                        auto number = dynamic_cast<NumberExpression*>(value);
+                        if (!cases_values.insert(std::string(number->value.literal)).second) {
                             context->diagnostics.report_error(branch_position,
                                                               "Switch can't has more than case "
                                                               "with the same constants value");
@@ -600,16 +616,16 @@ auto amun::TypeChecker::visit(SwitchStatement* node) -> std::any
     // note Should provide complete check to make sure all cases are covered or
     // there is else branch
     if (node->should_perform_complete_check && amun::is_enum_element_type(argument)) {
-        auto enum_element = std::static_pointer_cast<amun::EnumElementType>(argument);
+        auto enum_element = static_cast<amun::EnumElementType*>(argument);
         auto enum_name = enum_element->enum_name;
         auto enum_type = context->enumerations[enum_element->enum_name];
         check_complete_switch_cases(enum_type, cases_values, node->has_default_case, position);
     }
 
-    return 0;
+    return nullptr;
 }
 
-auto amun::TypeChecker::visit(ReturnStatement* node) -> std::any
+auto amun::TypeChecker::visit(ReturnStatement* node) -> amun::Type*
 {
     if (!node->has_value) {
         if (return_types_stack.top()->type_kind != amun::TypeKind::VOID) {
@@ -619,19 +635,19 @@ auto amun::TypeChecker::visit(ReturnStatement* node) -> std::any
                                                   " but got void");
             throw "Stop";
         }
-        return 0;
+        return nullptr;
     }
 
-    auto return_type = node_amun_type(node->value->accept(this));
+    auto return_type = node->value->accept(this);
     auto function_return_type = resolve_generic_type(return_types_stack.top());
 
     if (!amun::is_types_equals(function_return_type, return_type)) {
         // If Function return type is pointer and return value is null
         // set null pointer base type to function return type
         if (amun::is_pointer_type(function_return_type) and amun::is_null_type(return_type)) {
-            auto null_expr = std::dynamic_pointer_cast<NullExpression>(node->value);
+            auto null_expr = dynamic_cast<NullExpression*>(node->value);
             null_expr->null_base_type = function_return_type;
-            return 0;
+            return nullptr;
         }
 
         // If function return type is not pointer, you can't return null
@@ -645,14 +661,12 @@ auto amun::TypeChecker::visit(ReturnStatement* node) -> std::any
         // Prevent returning function with implicit capture from other functions
         if (amun::is_function_pointer_type(function_return_type) and
             amun::is_function_pointer_type(return_type)) {
-            auto expected_fun_ptr_type =
-                std::static_pointer_cast<amun::PointerType>(function_return_type);
+            auto expected_fun_ptr_type = static_cast<amun::PointerType*>(function_return_type);
             auto expected_fun_type =
-                std::static_pointer_cast<amun::FunctionType>(expected_fun_ptr_type->base_type);
+                static_cast<amun::FunctionType*>(expected_fun_ptr_type->base_type);
 
-            auto return_fun_ptr = std::static_pointer_cast<amun::PointerType>(return_type);
-            auto return_fun =
-                std::static_pointer_cast<amun::FunctionType>(return_fun_ptr->base_type);
+            auto return_fun_ptr = static_cast<amun::PointerType*>(return_type);
+            auto return_fun = static_cast<amun::FunctionType*>(return_fun_ptr->base_type);
 
             if (expected_fun_type->implicit_parameters_count !=
                 return_fun->implicit_parameters_count) {
@@ -670,48 +684,48 @@ auto amun::TypeChecker::visit(ReturnStatement* node) -> std::any
         throw "Stop";
     }
 
-    return 0;
+    return nullptr;
 }
 
-auto amun::TypeChecker::visit(DeferStatement* node) -> std::any
+auto amun::TypeChecker::visit(DeferStatement* node) -> amun::Type*
 {
     node->call_expression->accept(this);
-    return 0;
+    return nullptr;
 }
 
-auto amun::TypeChecker::visit(BreakStatement* node) -> std::any
+auto amun::TypeChecker::visit(BreakStatement* node) -> amun::Type*
 {
     if (node->has_times and node->times == 1) {
         context->diagnostics.report_warning(node->keyword.position,
                                             "`break 1;` can implicity written as `break;`");
     }
-    return 0;
+    return nullptr;
 }
 
-auto amun::TypeChecker::visit(ContinueStatement* node) -> std::any
+auto amun::TypeChecker::visit(ContinueStatement* node) -> amun::Type*
 {
     if (node->has_times and node->times == 1) {
         context->diagnostics.report_warning(node->keyword.position,
                                             "`continue 1;` can implicity written as `continue;`");
     }
-    return 0;
+    return nullptr;
 }
 
-auto amun::TypeChecker::visit(ExpressionStatement* node) -> std::any
+auto amun::TypeChecker::visit(ExpressionStatement* node) -> amun::Type*
 {
     return node->expression->accept(this);
 }
 
-auto amun::TypeChecker::visit(IfExpression* node) -> std::any
+auto amun::TypeChecker::visit(IfExpression* node) -> amun::Type*
 {
     const auto branches_count = node->tokens.size();
-    Shared<amun::Type> node_type = amun::none_type;
+    amun::Type* node_type = amun::none_type;
 
     // Check branches
     for (size_t i = 0; i < branches_count; i++) {
 
         // Check branch condition
-        auto condition = node_amun_type(node->conditions[i]->accept(this));
+        auto condition = node->conditions[i]->accept(this);
         if (not amun::is_number_type(condition)) {
             context->diagnostics.report_error(node->tokens[i].position,
                                               "If Expression condition mush be a number but got " +
@@ -720,7 +734,7 @@ auto amun::TypeChecker::visit(IfExpression* node) -> std::any
         }
 
         // Check branch return value
-        auto value = node_amun_type(node->values[i]->accept(this));
+        auto value = node->values[i]->accept(this);
         if (i == 0) {
             node_type = value;
             continue;
@@ -740,9 +754,9 @@ auto amun::TypeChecker::visit(IfExpression* node) -> std::any
     return node_type;
 }
 
-auto amun::TypeChecker::visit(SwitchExpression* node) -> std::any
+auto amun::TypeChecker::visit(SwitchExpression* node) -> amun::Type*
 {
-    auto argument = node_amun_type(node->argument->accept(this));
+    auto argument = node->argument->accept(this);
     auto position = node->keyword.position;
 
     auto cases = node->switch_cases;
@@ -750,7 +764,7 @@ auto amun::TypeChecker::visit(SwitchExpression* node) -> std::any
 
     for (size_t i = 0; i < cases_size; i++) {
         auto case_expression = cases[i];
-        auto case_type = node_amun_type(case_expression->accept(this));
+        auto case_type = case_expression->accept(this);
         if (!amun::is_types_equals(argument, case_type)) {
             context->diagnostics.report_error(
                 position, "Switch case type must be the same type of argument type " +
@@ -762,9 +776,9 @@ auto amun::TypeChecker::visit(SwitchExpression* node) -> std::any
     }
 
     auto values = node->switch_cases_values;
-    auto expected_type = node_amun_type(values[0]->accept(this));
+    auto expected_type = values[0]->accept(this);
     for (size_t i = 1; i < cases_size; i++) {
-        auto case_value = node_amun_type(values[i]->accept(this));
+        auto case_value = values[i]->accept(this);
         if (!amun::is_types_equals(expected_type, case_value)) {
             context->diagnostics.report_error(position,
                                               "Switch cases must be the same time but got " +
@@ -777,7 +791,7 @@ auto amun::TypeChecker::visit(SwitchExpression* node) -> std::any
     bool has_else_branch = false;
     auto else_value = node->default_value;
     if (else_value) {
-        auto default_value_type = node_amun_type(else_value->accept(this));
+        auto default_value_type = else_value->accept(this);
         has_else_branch = true;
         if (!amun::is_types_equals(expected_type, default_value_type)) {
             context->diagnostics.report_error(
@@ -792,7 +806,7 @@ auto amun::TypeChecker::visit(SwitchExpression* node) -> std::any
     // Check that switch expression are complete
     if (!has_else_branch) {
         if (amun::is_enum_element_type(argument)) {
-            auto enum_element = std::static_pointer_cast<amun::EnumElementType>(argument);
+            auto enum_element = static_cast<amun::EnumElementType*>(argument);
             auto enum_name = enum_element->enum_name;
             auto enum_type = context->enumerations[enum_name];
             auto enum_values = enum_type->values;
@@ -815,33 +829,33 @@ auto amun::TypeChecker::visit(SwitchExpression* node) -> std::any
     return expected_type;
 }
 
-auto amun::TypeChecker::visit(TupleExpression* node) -> std::any
+auto amun::TypeChecker::visit(TupleExpression* node) -> amun::Type*
 {
-    std::vector<Shared<amun::Type>> field_types;
+    std::vector<amun::Type*> field_types;
     field_types.reserve(node->values.size());
     for (const auto& value : node->values) {
-        field_types.push_back(node_amun_type(value->accept(this)));
+        field_types.push_back(value->accept(this));
     }
-    auto tuple_type = std::make_shared<amun::TupleType>("", field_types);
-    tuple_type->name = "_tuple_" + mangle_types(field_types);
+    auto tuple_type = context->type_context.tuple_type(field_types);
     node->set_type_node(tuple_type);
     return tuple_type;
 }
 
-auto amun::TypeChecker::visit(AssignExpression* node) -> std::any
+auto amun::TypeChecker::visit(AssignExpression* node) -> amun::Type*
 {
     auto left_node = node->left;
-    auto left_type = node_amun_type(left_node->accept(this));
+    auto left_type = left_node->accept(this);
 
     // Check that right hand side is a valid type for assignements
     check_valid_assignment_right_side(left_node, node->operator_token.position);
+    check_loop_variable_assignment(left_node, node->operator_token.position);
 
-    auto right_type = node_amun_type(node->right->accept(this));
+    auto right_type = node->right->accept(this);
 
     // if Variable type is pointer and rvalue is null, change null base type to
     // lvalue type
     if (amun::is_pointer_type(left_type) and amun::is_null_type(right_type)) {
-        auto null_expr = std::dynamic_pointer_cast<NullExpression>(node->right);
+        auto null_expr = dynamic_cast<NullExpression*>(node->right);
         null_expr->null_base_type = left_type;
         return left_type;
     }
@@ -858,10 +872,10 @@ auto amun::TypeChecker::visit(AssignExpression* node) -> std::any
     return right_type;
 }
 
-auto amun::TypeChecker::visit(BinaryExpression* node) -> std::any
+auto amun::TypeChecker::visit(BinaryExpression* node) -> amun::Type*
 {
-    auto lhs = node_amun_type(node->left->accept(this));
-    auto rhs = node_amun_type(node->right->accept(this));
+    auto lhs = node->left->accept(this);
+    auto rhs = node->right->accept(this);
     auto op = node->operator_token;
     auto position = op.position;
 
@@ -894,9 +908,9 @@ auto amun::TypeChecker::visit(BinaryExpression* node) -> std::any
     auto function_name = mangle_operator_function(op.kind, {lhs, rhs});
     if (types_table.is_defined(function_name)) {
         auto function = types_table.lookup(function_name);
-        auto type = node_amun_type(function);
+        auto type = function;
         assert(type->type_kind == amun::TypeKind::FUNCTION);
-        auto function_type = std::static_pointer_cast<amun::FunctionType>(type);
+        auto function_type = static_cast<amun::FunctionType*>(type);
         return function_type->return_type;
     }
 
@@ -909,10 +923,10 @@ auto amun::TypeChecker::visit(BinaryExpression* node) -> std::any
     throw "Stop";
 }
 
-auto amun::TypeChecker::visit(BitwiseExpression* node) -> std::any
+auto amun::TypeChecker::visit(BitwiseExpression* node) -> amun::Type*
 {
-    auto lhs = node_amun_type(node->left->accept(this));
-    auto rhs = node_amun_type(node->right->accept(this));
+    auto lhs = node->left->accept(this);
+    auto rhs = node->right->accept(this);
     auto op = node->operator_token;
     auto position = op.position;
 
@@ -925,10 +939,10 @@ auto amun::TypeChecker::visit(BitwiseExpression* node) -> std::any
             // Check for compile time integer overflow if possiable
             if (op.kind == TokenKind::TOKEN_RIGHT_SHIFT || op.kind == TokenKind::TOKEN_LEFT_SHIFT) {
                 if (right_node_type == AstNodeType::AST_NUMBER) {
-                    auto crhs = std::dynamic_pointer_cast<NumberExpression>(right);
-                    auto str_value = crhs->value.literal;
+                    auto crhs = dynamic_cast<NumberExpression*>(right);
+                    auto str_value = std::string(crhs->value.literal);
                     auto num = str_to_int(str_value.c_str());
-                    auto number_kind = std::static_pointer_cast<amun::NumberType>(lhs)->number_kind;
+                    auto number_kind = static_cast<amun::NumberType*>(lhs)->number_kind;
                     auto first_operand_width = number_kind_width[number_kind];
                     if (num >= first_operand_width) {
                         context->diagnostics.report_error(
@@ -943,7 +957,7 @@ auto amun::TypeChecker::visit(BitwiseExpression* node) -> std::any
 
                 // Check that scond operand is a positive number
                 if (right_node_type == AstNodeType::AST_PREFIX_UNARY) {
-                    auto unary = std::dynamic_pointer_cast<PrefixUnaryExpression>(right);
+                    auto unary = dynamic_cast<PrefixUnaryExpression*>(right);
                     if (unary->operator_token.kind == TokenKind::TOKEN_MINUS &&
                         unary->right->get_ast_node_type() == AstNodeType::AST_NUMBER) {
                         context->diagnostics.report_error(
@@ -980,9 +994,9 @@ auto amun::TypeChecker::visit(BitwiseExpression* node) -> std::any
     auto function_name = mangle_operator_function(op.kind, {lhs, rhs});
     if (types_table.is_defined(function_name)) {
         auto function = types_table.lookup(function_name);
-        auto type = node_amun_type(function);
+        auto type = function;
         assert(type->type_kind == amun::TypeKind::FUNCTION);
-        auto function_type = std::static_pointer_cast<amun::FunctionType>(type);
+        auto function_type = static_cast<amun::FunctionType*>(type);
         return function_type->return_type;
     }
 
@@ -995,10 +1009,10 @@ auto amun::TypeChecker::visit(BitwiseExpression* node) -> std::any
     throw "Stop";
 }
 
-auto amun::TypeChecker::visit(ComparisonExpression* node) -> std::any
+auto amun::TypeChecker::visit(ComparisonExpression* node) -> amun::Type*
 {
-    auto lhs = node_amun_type(node->left->accept(this));
-    auto rhs = node_amun_type(node->right->accept(this));
+    auto lhs = node->left->accept(this);
+    auto rhs = node->right->accept(this);
     auto are_types_equals = amun::is_types_equals(lhs, rhs);
     auto op = node->operator_token;
     auto position = op.position;
@@ -1042,14 +1056,14 @@ auto amun::TypeChecker::visit(ComparisonExpression* node) -> std::any
 
     // Pointer vs null comparaisons and set null pointer base type
     if (amun::is_pointer_type(lhs) && amun::is_null_type(rhs)) {
-        auto null_expr = std::dynamic_pointer_cast<NullExpression>(node->right);
+        auto null_expr = dynamic_cast<NullExpression*>(node->right);
         null_expr->null_base_type = lhs;
         return amun::i1_type;
     }
 
     // Null vs Pointer comparaisons and set null pointer base type
     if (amun::is_null_type(lhs) && amun::is_pointer_type(rhs)) {
-        auto null_expr = std::dynamic_pointer_cast<NullExpression>(node->left);
+        auto null_expr = dynamic_cast<NullExpression*>(node->left);
         null_expr->null_base_type = rhs;
         return amun::i1_type;
     }
@@ -1084,9 +1098,9 @@ auto amun::TypeChecker::visit(ComparisonExpression* node) -> std::any
     auto function_name = mangle_operator_function(op.kind, {lhs, rhs});
     if (types_table.is_defined(function_name)) {
         auto function = types_table.lookup(function_name);
-        auto type = node_amun_type(function);
+        auto type = function;
         assert(type->type_kind == amun::TypeKind::FUNCTION);
-        auto function_type = std::static_pointer_cast<amun::FunctionType>(type);
+        auto function_type = static_cast<amun::FunctionType*>(type);
         return function_type->return_type;
     }
 
@@ -1099,10 +1113,10 @@ auto amun::TypeChecker::visit(ComparisonExpression* node) -> std::any
     throw "Stop";
 }
 
-auto amun::TypeChecker::visit(LogicalExpression* node) -> std::any
+auto amun::TypeChecker::visit(LogicalExpression* node) -> amun::Type*
 {
-    auto lhs = node_amun_type(node->left->accept(this));
-    auto rhs = node_amun_type(node->right->accept(this));
+    auto lhs = node->left->accept(this);
+    auto rhs = node->right->accept(this);
 
     if (amun::is_integer1_type(lhs) && amun::is_integer1_type(rhs)) {
         return lhs;
@@ -1114,9 +1128,9 @@ auto amun::TypeChecker::visit(LogicalExpression* node) -> std::any
     auto function_name = mangle_operator_function(op.kind, {lhs, rhs});
     if (types_table.is_defined(function_name)) {
         auto function = types_table.lookup(function_name);
-        auto type = node_amun_type(function);
+        auto type = function;
         assert(type->type_kind == amun::TypeKind::FUNCTION);
-        auto function_type = std::static_pointer_cast<amun::FunctionType>(type);
+        auto function_type = static_cast<amun::FunctionType*>(type);
         return function_type->return_type;
     }
 
@@ -1130,9 +1144,9 @@ auto amun::TypeChecker::visit(LogicalExpression* node) -> std::any
     throw "Stop";
 }
 
-auto amun::TypeChecker::visit(PrefixUnaryExpression* node) -> std::any
+auto amun::TypeChecker::visit(PrefixUnaryExpression* node) -> amun::Type*
 {
-    auto rhs = node_amun_type(node->right->accept(this));
+    auto rhs = node->right->accept(this);
     auto op_kind = node->operator_token.kind;
 
     if (op_kind == TokenKind::TOKEN_MINUS) {
@@ -1145,9 +1159,9 @@ auto amun::TypeChecker::visit(PrefixUnaryExpression* node) -> std::any
         auto function_name = "_prefix" + mangle_operator_function(op_kind, {rhs});
         if (types_table.is_defined(function_name)) {
             auto function = types_table.lookup(function_name);
-            auto type = node_amun_type(function);
+            auto type = function;
             assert(type->type_kind == amun::TypeKind::FUNCTION);
-            auto function_type = std::static_pointer_cast<amun::FunctionType>(type);
+            auto function_type = static_cast<amun::FunctionType*>(type);
             return function_type->return_type;
         }
 
@@ -1168,9 +1182,9 @@ auto amun::TypeChecker::visit(PrefixUnaryExpression* node) -> std::any
         auto function_name = "_prefix" + mangle_operator_function(op_kind, {rhs});
         if (types_table.is_defined(function_name)) {
             auto function = types_table.lookup(function_name);
-            auto type = node_amun_type(function);
+            auto type = function;
             assert(type->type_kind == amun::TypeKind::FUNCTION);
-            auto function_type = std::static_pointer_cast<amun::FunctionType>(type);
+            auto function_type = static_cast<amun::FunctionType*>(type);
             return function_type->return_type;
         }
 
@@ -1190,9 +1204,9 @@ auto amun::TypeChecker::visit(PrefixUnaryExpression* node) -> std::any
         auto function_name = "_prefix" + mangle_operator_function(op_kind, {rhs});
         if (types_table.is_defined(function_name)) {
             auto function = types_table.lookup(function_name);
-            auto type = node_amun_type(function);
+            auto type = function;
             assert(type->type_kind == amun::TypeKind::FUNCTION);
-            auto function_type = std::static_pointer_cast<amun::FunctionType>(type);
+            auto function_type = static_cast<amun::FunctionType*>(type);
             return function_type->return_type;
         }
 
@@ -1204,7 +1218,7 @@ auto amun::TypeChecker::visit(PrefixUnaryExpression* node) -> std::any
 
     if (op_kind == TokenKind::TOKEN_STAR) {
         if (rhs->type_kind == amun::TypeKind::POINTER) {
-            auto pointer_type = std::static_pointer_cast<amun::PointerType>(rhs);
+            auto pointer_type = static_cast<amun::PointerType*>(rhs);
             auto type = pointer_type->base_type;
             node->set_type_node(type);
             return type;
@@ -1218,12 +1232,11 @@ auto amun::TypeChecker::visit(PrefixUnaryExpression* node) -> std::any
     }
 
     if (op_kind == TokenKind::TOKEN_AND) {
-        auto pointer_type = std::make_shared<amun::PointerType>(rhs);
+        auto pointer_type = context->type_context.pointer_type(rhs);
         if (amun::is_function_pointer_type(pointer_type)) {
-            auto function_type =
-                std::static_pointer_cast<amun::FunctionType>(pointer_type->base_type);
+            auto function_type = static_cast<amun::FunctionType*>(pointer_type->base_type);
             if (function_type->is_intrinsic) {
-                context->diagnostics.report_error(function_type->name.position,
+                context->diagnostics.report_error(node->operator_token.position,
                                                   "Can't take address of an intrinsic function");
                 throw "Stop";
             }
@@ -1234,6 +1247,7 @@ auto amun::TypeChecker::visit(PrefixUnaryExpression* node) -> std::any
 
     if (op_kind == TokenKind::TOKEN_PLUS_PLUS || op_kind == TokenKind::TOKEN_MINUS_MINUS) {
         if (rhs->type_kind == amun::TypeKind::NUMBER) {
+            check_loop_variable_assignment(node->right, node->operator_token.position);
             node->set_type_node(rhs);
             return rhs;
         }
@@ -1242,9 +1256,9 @@ auto amun::TypeChecker::visit(PrefixUnaryExpression* node) -> std::any
         auto function_name = "_prefix" + mangle_operator_function(op_kind, {rhs});
         if (types_table.is_defined(function_name)) {
             auto function = types_table.lookup(function_name);
-            auto type = node_amun_type(function);
+            auto type = function;
             assert(type->type_kind == amun::TypeKind::FUNCTION);
-            auto function_type = std::static_pointer_cast<amun::FunctionType>(type);
+            auto function_type = static_cast<amun::FunctionType*>(type);
             return function_type->return_type;
         }
 
@@ -1261,14 +1275,15 @@ auto amun::TypeChecker::visit(PrefixUnaryExpression* node) -> std::any
     throw "Stop";
 }
 
-auto amun::TypeChecker::visit(PostfixUnaryExpression* node) -> std::any
+auto amun::TypeChecker::visit(PostfixUnaryExpression* node) -> amun::Type*
 {
-    auto rhs = node_amun_type(node->right->accept(this));
+    auto rhs = node->right->accept(this);
     auto op_kind = node->operator_token.kind;
     auto position = node->operator_token.position;
 
     if (op_kind == TokenKind::TOKEN_PLUS_PLUS or op_kind == TokenKind::TOKEN_MINUS_MINUS) {
         if (rhs->type_kind == amun::TypeKind::NUMBER) {
+            check_loop_variable_assignment(node->right, position);
             node->set_type_node(rhs);
             return rhs;
         }
@@ -1277,9 +1292,9 @@ auto amun::TypeChecker::visit(PostfixUnaryExpression* node) -> std::any
         auto function_name = "_postfix" + mangle_operator_function(op_kind, {rhs});
         if (types_table.is_defined(function_name)) {
             auto function = types_table.lookup(function_name);
-            auto type = node_amun_type(function);
+            auto type = function;
             assert(type->type_kind == amun::TypeKind::FUNCTION);
-            auto function_type = std::static_pointer_cast<amun::FunctionType>(type);
+            auto function_type = static_cast<amun::FunctionType*>(type);
             return function_type->return_type;
         }
 
@@ -1294,7 +1309,7 @@ auto amun::TypeChecker::visit(PostfixUnaryExpression* node) -> std::any
     throw "Stop";
 }
 
-auto amun::TypeChecker::visit(CallExpression* node) -> std::any
+auto amun::TypeChecker::visit(CallExpression* node) -> amun::Type*
 {
     auto callee = node->callee;
     auto callee_ast_node_type = node->callee->get_ast_node_type();
@@ -1302,24 +1317,23 @@ auto amun::TypeChecker::visit(CallExpression* node) -> std::any
 
     // Call function by name for example function();
     if (callee_ast_node_type == AstNodeType::AST_LITERAL) {
-        auto literal = std::dynamic_pointer_cast<LiteralExpression>(callee);
-        auto name = literal->name.literal;
+        auto literal = dynamic_cast<LiteralExpression*>(callee);
+        auto name = std::string(literal->name.literal);
         if (types_table.is_defined(name)) {
-            auto lookup = types_table.lookup(name);
-            auto value = node_amun_type(types_table.lookup(name));
+            auto value = types_table.lookup(name);
 
             if (value->type_kind == amun::TypeKind::POINTER) {
-                auto pointer_type = std::static_pointer_cast<amun::PointerType>(value);
+                auto pointer_type = static_cast<amun::PointerType*>(value);
                 value = pointer_type->base_type;
             }
 
             if (value->type_kind == amun::TypeKind::FUNCTION) {
-                auto type = std::static_pointer_cast<amun::FunctionType>(value);
+                auto type = static_cast<amun::FunctionType*>(value);
                 node->set_type_node(type);
                 auto parameters = type->parameters;
                 auto arguments = node->arguments;
                 for (auto& argument : arguments) {
-                    argument->set_type_node(node_amun_type(argument->accept(this)));
+                    argument->set_type_node(argument->accept(this));
                 }
 
                 check_parameters_types(node_span, arguments, parameters, type->has_varargs,
@@ -1366,7 +1380,7 @@ auto amun::TypeChecker::visit(CallExpression* node) -> std::any
                 for (const auto& parameter : prototype_parameters) {
                     const auto parameter_type = parameter->type;
                     const auto resolved_argument = call_arguments[parameter_index]->accept(this);
-                    const auto argument_type = node_amun_type(resolved_argument);
+                    const auto argument_type = resolved_argument;
 
                     if (!amun::is_types_equals(parameter_type, argument_type)) {
 
@@ -1422,7 +1436,7 @@ auto amun::TypeChecker::visit(CallExpression* node) -> std::any
                 function_prototype->return_type, prototype_generic_names, call_generic_arguments);
             return_types_stack.push(return_type);
 
-            std::vector<Shared<amun::Type>> resolved_parameters;
+            std::vector<amun::Type*> resolved_parameters;
             resolved_parameters.reserve(prototype_parameters.size());
             for (const auto& parameter : prototype_parameters) {
                 resolved_parameters.push_back(resolve_generic_type(
@@ -1433,18 +1447,22 @@ auto amun::TypeChecker::visit(CallExpression* node) -> std::any
 
             int index = 0;
             for (auto& parameter : prototype_parameters) {
-                types_table.define(parameter->name.literal, resolved_parameters[index]);
+                types_table.define(std::string(parameter->name.literal),
+                                   resolved_parameters[index]);
                 index++;
             }
 
+            auto outer_generic_arguments = generic_arguments;
+            generic_arguments = call_generic_arguments;
             function_declaraion->body->accept(this);
+            generic_arguments = outer_generic_arguments;
             pop_current_scope();
 
             return_types_stack.pop();
 
             auto arguments = call_arguments;
             for (auto& argument : arguments) {
-                auto argument_type = node_amun_type(argument->accept(this));
+                auto argument_type = argument->accept(this);
                 argument_type = resolve_generic_type(argument_type);
                 argument->set_type_node(argument_type);
             }
@@ -1467,11 +1485,10 @@ auto amun::TypeChecker::visit(CallExpression* node) -> std::any
     // Call function pointer returned from call expression for example
     // function()();
     if (callee_ast_node_type == AstNodeType::AST_CALL) {
-        auto call = std::dynamic_pointer_cast<CallExpression>(callee);
-        auto call_result = node_amun_type(call->accept(this));
-        auto function_pointer_type = std::static_pointer_cast<amun::PointerType>(call_result);
-        auto function_type =
-            std::static_pointer_cast<amun::FunctionType>(function_pointer_type->base_type);
+        auto call = dynamic_cast<CallExpression*>(callee);
+        auto call_result = call->accept(this);
+        auto function_pointer_type = static_cast<amun::PointerType*>(call_result);
+        auto function_type = static_cast<amun::FunctionType*>(function_pointer_type->base_type);
         auto parameters = function_type->parameters;
         auto arguments = node->arguments;
         check_parameters_types(node_span, arguments, parameters, function_type->has_varargs,
@@ -1483,17 +1500,16 @@ auto amun::TypeChecker::visit(CallExpression* node) -> std::any
 
     // Call lambda expression for example { () void -> return; } ()
     if (callee_ast_node_type == AstNodeType::AST_LAMBDA) {
-        auto lambda = std::dynamic_pointer_cast<LambdaExpression>(node->callee);
-        auto lambda_function_type = node_amun_type(lambda->accept(this));
-        auto function_ptr_type = std::static_pointer_cast<amun::PointerType>(lambda_function_type);
+        auto lambda = dynamic_cast<LambdaExpression*>(node->callee);
+        auto lambda_function_type = lambda->accept(this);
+        auto function_ptr_type = static_cast<amun::PointerType*>(lambda_function_type);
 
-        auto function_type =
-            std::static_pointer_cast<amun::FunctionType>(function_ptr_type->base_type);
+        auto function_type = static_cast<amun::FunctionType*>(function_ptr_type->base_type);
 
         auto parameters = function_type->parameters;
         auto arguments = node->arguments;
         for (auto& argument : arguments) {
-            argument->set_type_node(node_amun_type(argument->accept(this)));
+            argument->set_type_node(argument->accept(this));
         }
 
         check_parameters_types(node_span, arguments, parameters, function_type->has_varargs,
@@ -1506,17 +1522,16 @@ auto amun::TypeChecker::visit(CallExpression* node) -> std::any
 
     // Call struct field with function pointer for example type struct.field()
     if (callee_ast_node_type == AstNodeType::AST_DOT) {
-        auto dot_expression = std::dynamic_pointer_cast<DotExpression>(node->callee);
-        auto dot_function_type = node_amun_type(dot_expression->accept(this));
-        auto function_ptr_type = std::static_pointer_cast<amun::PointerType>(dot_function_type);
+        auto dot_expression = dynamic_cast<DotExpression*>(node->callee);
+        auto dot_function_type = dot_expression->accept(this);
+        auto function_ptr_type = static_cast<amun::PointerType*>(dot_function_type);
 
-        auto function_type =
-            std::static_pointer_cast<amun::FunctionType>(function_ptr_type->base_type);
+        auto function_type = static_cast<amun::FunctionType*>(function_ptr_type->base_type);
 
         auto parameters = function_type->parameters;
         auto arguments = node->arguments;
         for (auto& argument : arguments) {
-            argument->set_type_node(node_amun_type(argument->accept(this)));
+            argument->set_type_node(argument->accept(this));
         }
 
         check_parameters_types(node_span, arguments, parameters, function_type->has_varargs,
@@ -1531,13 +1546,13 @@ auto amun::TypeChecker::visit(CallExpression* node) -> std::any
     throw "Stop";
 }
 
-auto amun::TypeChecker::visit(InitializeExpression* node) -> std::any
+auto amun::TypeChecker::visit(InitializeExpression* node) -> amun::Type*
 {
     auto type = resolve_generic_type(node->type);
     node->set_type_node(type);
 
     if (type->type_kind == amun::TypeKind::STRUCT) {
-        auto struct_type = std::static_pointer_cast<amun::StructType>(type);
+        auto struct_type = static_cast<amun::StructType*>(type);
         auto parameters = struct_type->fields_types;
         auto arguments = node->arguments;
 
@@ -1550,28 +1565,28 @@ auto amun::TypeChecker::visit(InitializeExpression* node) -> std::any
     throw "Stop";
 }
 
-auto amun::TypeChecker::visit(LambdaExpression* node) -> std::any
+auto amun::TypeChecker::visit(LambdaExpression* node) -> amun::Type*
 {
-    auto function_ptr_type = std::static_pointer_cast<amun::PointerType>(node->get_type_node());
-    auto function_type = std::static_pointer_cast<amun::FunctionType>(function_ptr_type->base_type);
+    auto function_ptr_type = static_cast<amun::PointerType*>(node->get_type_node());
+    auto function_type = static_cast<amun::FunctionType*>(function_ptr_type->base_type);
 
     // Resolving return type
-    function_type->return_type = resolve_generic_type(function_type->return_type);
-    return_types_stack.push(function_type->return_type);
+    auto return_type = resolve_generic_type(function_type->return_type);
+    return_types_stack.push(return_type);
 
     is_inside_lambda_body = true;
     lambda_implicit_parameters.push({});
 
     push_new_scope();
 
-    function_type->parameters.clear();
+    std::vector<amun::Type*> parameters;
 
     // Define Explicit parameter inside lambda body scope
     for (auto& parameter : node->explicit_parameters) {
         // Resolve only if lambda is inside generic function
         parameter->type = resolve_generic_type(parameter->type);
-        types_table.define(parameter->name.literal, parameter->type);
-        function_type->parameters.push_back(parameter->type);
+        types_table.define(std::string(parameter->name.literal), parameter->type);
+        parameters.push_back(parameter->type);
     }
 
     node->body->accept(this);
@@ -1585,15 +1600,16 @@ auto amun::TypeChecker::visit(LambdaExpression* node) -> std::any
     for (auto& parameter_pair : extra_parameter_pairs) {
         node->implict_parameters_names.push_back(parameter_pair.first);
         node->implict_parameters_types.push_back(parameter_pair.second);
-        function_type->implicit_parameters_count++;
     }
 
-    function_type->parameters.insert(function_type->parameters.begin(),
-                                     node->implict_parameters_types.begin(),
-                                     node->implict_parameters_types.end());
+    parameters.insert(parameters.begin(), node->implict_parameters_types.begin(),
+                      node->implict_parameters_types.end());
 
-    // Modify function pointer type after appending implicit paramaters
-    function_ptr_type->base_type = function_type;
+    // Create function pointer type after appending implicit paramaters
+    int implicit_parameters_count = node->implict_parameters_types.size();
+    auto lambda_function_type = context->type_context.function_type(
+        parameters, return_type, false, nullptr, false, false, {}, implicit_parameters_count);
+    function_ptr_type = context->type_context.pointer_type(lambda_function_type);
     node->set_type_node(function_ptr_type);
 
     lambda_implicit_parameters.pop();
@@ -1602,10 +1618,10 @@ auto amun::TypeChecker::visit(LambdaExpression* node) -> std::any
     return function_ptr_type;
 }
 
-auto amun::TypeChecker::visit(DotExpression* node) -> std::any
+auto amun::TypeChecker::visit(DotExpression* node) -> amun::Type*
 {
     auto callee = node->callee->accept(this);
-    auto callee_type = node_amun_type(callee);
+    auto callee_type = callee;
     auto callee_type_kind = callee_type->type_kind;
     auto node_position = node->dot_token.position;
 
@@ -1619,8 +1635,8 @@ auto amun::TypeChecker::visit(DotExpression* node) -> std::any
             throw "Stop";
         }
 
-        auto struct_type = std::static_pointer_cast<amun::StructType>(callee_type);
-        auto field_name = node->field_name.literal;
+        auto struct_type = static_cast<amun::StructType*>(callee_type);
+        auto field_name = std::string(node->field_name.literal);
         auto fields_names = struct_type->fields_names;
         if (is_contains(fields_names, field_name)) {
             int member_index = index_of(fields_names, field_name);
@@ -1644,7 +1660,7 @@ auto amun::TypeChecker::visit(DotExpression* node) -> std::any
             throw "Stop";
         }
 
-        auto tuple_type = std::static_pointer_cast<amun::TupleType>(callee_type);
+        auto tuple_type = static_cast<amun::TupleType*>(callee_type);
         size_t field_index = node->field_index;
 
         if (field_index >= tuple_type->fields_types.size()) {
@@ -1658,11 +1674,11 @@ auto amun::TypeChecker::visit(DotExpression* node) -> std::any
     }
 
     if (callee_type_kind == amun::TypeKind::POINTER) {
-        auto pointer_type = std::static_pointer_cast<amun::PointerType>(callee_type);
+        auto pointer_type = static_cast<amun::PointerType*>(callee_type);
         auto pointer_to_type = pointer_type->base_type;
         if (pointer_to_type->type_kind == amun::TypeKind::STRUCT) {
-            auto struct_type = std::static_pointer_cast<amun::StructType>(pointer_to_type);
-            auto field_name = node->field_name.literal;
+            auto struct_type = static_cast<amun::StructType*>(pointer_to_type);
+            auto field_name = std::string(node->field_name.literal);
             auto fields_names = struct_type->fields_names;
             if (is_contains(fields_names, field_name)) {
                 int member_index = index_of(fields_names, field_name);
@@ -1679,7 +1695,7 @@ auto amun::TypeChecker::visit(DotExpression* node) -> std::any
 
         if (amun::is_types_equals(pointer_to_type, amun::i8_type)) {
             auto attribute_token = node->field_name;
-            auto literal = attribute_token.literal;
+            auto literal = std::string(attribute_token.literal);
 
             if (literal == "count") {
                 node->is_constants_ = node->callee->get_ast_node_type() == AstNodeType::AST_STRING;
@@ -1700,7 +1716,7 @@ auto amun::TypeChecker::visit(DotExpression* node) -> std::any
 
     if (callee_type_kind == amun::TypeKind::STATIC_ARRAY) {
         auto attribute_token = node->field_name;
-        auto literal = attribute_token.literal;
+        auto literal = std::string(attribute_token.literal);
 
         if (literal == "count") {
             node->is_constants_ = true;
@@ -1715,7 +1731,7 @@ auto amun::TypeChecker::visit(DotExpression* node) -> std::any
 
     if (callee_type_kind == amun::TypeKind::STATIC_VECTOR) {
         auto attribute_token = node->field_name;
-        auto literal = attribute_token.literal;
+        auto literal = std::string(attribute_token.literal);
 
         if (literal == "count") {
             node->is_constants_ = true;
@@ -1729,11 +1745,11 @@ auto amun::TypeChecker::visit(DotExpression* node) -> std::any
     }
 
     if (callee_type_kind == amun::TypeKind::GENERIC_STRUCT) {
-        auto generic_type = std::static_pointer_cast<amun::GenericStructType>(callee_type);
+        auto generic_type = static_cast<amun::GenericStructType*>(callee_type);
         auto resolved_type = resolve_generic_type(generic_type);
-        auto struct_type = std::static_pointer_cast<amun::StructType>(resolved_type);
+        auto struct_type = static_cast<amun::StructType*>(resolved_type);
         auto fields_names = struct_type->fields_names;
-        auto field_name = node->field_name.literal;
+        auto field_name = std::string(node->field_name.literal);
         if (is_contains(fields_names, field_name)) {
             int member_index = index_of(fields_names, field_name);
             auto field_type = struct_type->fields_types[member_index];
@@ -1752,10 +1768,10 @@ auto amun::TypeChecker::visit(DotExpression* node) -> std::any
     throw "Stop";
 }
 
-auto amun::TypeChecker::visit(CastExpression* node) -> std::any
+auto amun::TypeChecker::visit(CastExpression* node) -> amun::Type*
 {
     auto value = node->value;
-    auto value_type = node_amun_type(value->accept(this));
+    auto value_type = value->accept(this);
     auto target_type = node->get_type_node();
     target_type = resolve_generic_type(target_type);
     auto node_position = node->position.position;
@@ -1776,7 +1792,7 @@ auto amun::TypeChecker::visit(CastExpression* node) -> std::any
     return target_type;
 }
 
-auto amun::TypeChecker::visit(TypeSizeExpression* node) -> std::any
+auto amun::TypeChecker::visit(TypeSizeExpression* node) -> amun::Type*
 {
     auto type = node->type;
     auto resolved_type = resolve_generic_type(type);
@@ -1784,7 +1800,7 @@ auto amun::TypeChecker::visit(TypeSizeExpression* node) -> std::any
     return amun::i64_type;
 }
 
-auto amun::TypeChecker::visit(TypeAlignExpression* node) -> std::any
+auto amun::TypeChecker::visit(TypeAlignExpression* node) -> amun::Type*
 {
     auto type = node->type;
     auto resolved_type = resolve_generic_type(type);
@@ -1792,16 +1808,16 @@ auto amun::TypeChecker::visit(TypeAlignExpression* node) -> std::any
     return amun::i64_type;
 }
 
-auto amun::TypeChecker::visit(ValueSizeExpression* node) -> std::any
+auto amun::TypeChecker::visit(ValueSizeExpression* node) -> amun::Type*
 {
     node->value->accept(this);
     return amun::i64_type;
 }
 
-auto amun::TypeChecker::visit(IndexExpression* node) -> std::any
+auto amun::TypeChecker::visit(IndexExpression* node) -> amun::Type*
 {
     auto index_expression = node->index;
-    auto index_type = node_amun_type(index_expression->accept(this));
+    auto index_type = index_expression->accept(this);
     auto position = node->position.position;
 
     // Make sure index is integer type with any size
@@ -1816,8 +1832,8 @@ auto amun::TypeChecker::visit(IndexExpression* node) -> std::any
     size_t constant_index = -1;
 
     if (has_constant_index) {
-        auto number_expr = std::dynamic_pointer_cast<NumberExpression>(index_expression);
-        auto number_literal = number_expr->value.literal;
+        auto number_expr = dynamic_cast<NumberExpression*>(index_expression);
+        auto number_literal = std::string(number_expr->value.literal);
         constant_index = str_to_int(number_literal.c_str());
 
         // Check that index is not negative
@@ -1828,10 +1844,10 @@ auto amun::TypeChecker::visit(IndexExpression* node) -> std::any
     }
 
     auto callee_expression = node->value;
-    auto callee_type = node_amun_type(callee_expression->accept(this));
+    auto callee_type = callee_expression->accept(this);
 
     if (callee_type->type_kind == amun::TypeKind::STATIC_ARRAY) {
-        auto array_type = std::static_pointer_cast<amun::StaticArrayType>(callee_type);
+        auto array_type = static_cast<amun::StaticArrayType*>(callee_type);
         node->set_type_node(array_type->element_type);
 
         // Compile time bounds check
@@ -1845,7 +1861,7 @@ auto amun::TypeChecker::visit(IndexExpression* node) -> std::any
     }
 
     if (callee_type->type_kind == amun::TypeKind::STATIC_VECTOR) {
-        auto vector_type = std::static_pointer_cast<amun::StaticVectorType>(callee_type);
+        auto vector_type = static_cast<amun::StaticVectorType*>(callee_type);
         auto array_type = vector_type->array;
         node->set_type_node(array_type->element_type);
 
@@ -1860,7 +1876,7 @@ auto amun::TypeChecker::visit(IndexExpression* node) -> std::any
     }
 
     if (callee_type->type_kind == amun::TypeKind::POINTER) {
-        auto pointer_type = std::static_pointer_cast<amun::PointerType>(callee_type);
+        auto pointer_type = static_cast<amun::PointerType*>(callee_type);
         node->set_type_node(pointer_type->base_type);
         return pointer_type->base_type;
     }
@@ -1870,27 +1886,26 @@ auto amun::TypeChecker::visit(IndexExpression* node) -> std::any
     throw "Stop";
 }
 
-auto amun::TypeChecker::visit(EnumAccessExpression* node) -> std::any
+auto amun::TypeChecker::visit(EnumAccessExpression* node) -> amun::Type*
 {
     return node->get_type_node();
 }
 
-auto amun::TypeChecker::visit(LiteralExpression* node) -> std::any
+auto amun::TypeChecker::visit(LiteralExpression* node) -> amun::Type*
 {
-    const auto name = node->name.literal;
+    const auto name = std::string(node->name.literal);
     if (!types_table.is_defined(name)) {
-        context->diagnostics.report_error(node->name.position,
-                                          "Can't resolve variable with name " + node->name.literal);
+        context->diagnostics.report_error(node->name.position, "Can't resolve variable with name " +
+                                                                   std::string(node->name.literal));
         throw "Stop";
     }
 
-    std::any value = nullptr;
+    amun::Type* value = nullptr;
     if (is_inside_lambda_body) {
         auto local_variable = types_table.lookup_on_current(name);
 
         // If not explicit parameter or local declared variable
-        std::string type_literal = local_variable.type().name();
-        if (type_literal == "Dn") {
+        if (local_variable == nullptr) {
             // Check if it declared in any outer scope
             auto outer_variable_pair = types_table.lookup_with_level(name);
             size_t declared_scope_level = outer_variable_pair.second;
@@ -1900,7 +1915,7 @@ auto amun::TypeChecker::visit(LiteralExpression* node) -> std::any
             // Check if it not global variable, need to perform implicit capture
             // for this variable
             if (declared_scope_level != 0 && (declared_scope_level < types_table.size() - 2)) {
-                auto type = node_amun_type(value);
+                auto type = value;
                 types_table.define(name, type);
                 lambda_implicit_parameters.top().push_back({name, type});
             }
@@ -1914,7 +1929,7 @@ auto amun::TypeChecker::visit(LiteralExpression* node) -> std::any
         value = types_table.lookup(name);
     }
 
-    auto type = node_amun_type(value);
+    auto type = value;
     node->type = type;
 
     if (type->type_kind == amun::TypeKind::NUMBER ||
@@ -1925,11 +1940,11 @@ auto amun::TypeChecker::visit(LiteralExpression* node) -> std::any
     return type;
 }
 
-auto amun::TypeChecker::visit(NumberExpression* node) -> std::any
+auto amun::TypeChecker::visit(NumberExpression* node) -> amun::Type*
 {
-    auto number_type = std::static_pointer_cast<amun::NumberType>(node->get_type_node());
+    auto number_type = static_cast<amun::NumberType*>(node->get_type_node());
     auto number_kind = number_type->number_kind;
-    auto number_literal = node->value.literal;
+    auto number_literal = std::string(node->value.literal);
 
     bool is_valid_range = check_number_limits(number_literal.c_str(), number_kind);
     if (not is_valid_range) {
@@ -1946,7 +1961,7 @@ auto amun::TypeChecker::visit(NumberExpression* node) -> std::any
     return number_type;
 }
 
-auto amun::TypeChecker::visit(ArrayExpression* node) -> std::any
+auto amun::TypeChecker::visit(ArrayExpression* node) -> amun::Type*
 {
     const auto values = node->values;
     const auto values_size = values.size();
@@ -1954,9 +1969,9 @@ auto amun::TypeChecker::visit(ArrayExpression* node) -> std::any
         return node->get_type_node();
     }
 
-    auto last_element_type = node_amun_type(values[0]->accept(this));
+    auto last_element_type = values[0]->accept(this);
     for (size_t i = 1; i < values_size; i++) {
-        auto current_element_type = node_amun_type(values[i]->accept(this));
+        auto current_element_type = values[i]->accept(this);
         if (amun::is_types_equals(current_element_type, last_element_type)) {
             last_element_type = current_element_type;
             continue;
@@ -1968,17 +1983,19 @@ auto amun::TypeChecker::visit(ArrayExpression* node) -> std::any
         throw "Stop";
     }
 
-    // Modify element_type with the type of first elements
-    auto array_type = std::static_pointer_cast<amun::StaticArrayType>(node->get_type_node());
-    array_type->element_type = last_element_type;
+    // Update element_type with the type of first elements
+    auto array_type = context->type_context.static_array_type(last_element_type, values_size);
     node->set_type_node(array_type);
+    if (!generic_arguments.empty()) {
+        node->generic_instances_types[generic_arguments] = array_type;
+    }
     return array_type;
 }
 
-auto amun::TypeChecker::visit(VectorExpression* node) -> std::any
+auto amun::TypeChecker::visit(VectorExpression* node) -> amun::Type*
 {
     auto array = node->array;
-    auto array_type = std::static_pointer_cast<amun::StaticArrayType>(array->type);
+    auto array_type = static_cast<amun::StaticArrayType*>(array->type);
     auto element_type = array_type->element_type;
 
     if (element_type->type_kind != TypeKind::NUMBER || amun::is_signed_integer_type(element_type)) {
@@ -1991,82 +2008,48 @@ auto amun::TypeChecker::visit(VectorExpression* node) -> std::any
     return node->get_type_node();
 }
 
-auto amun::TypeChecker::visit(StringExpression* node) -> std::any { return node->get_type_node(); }
-
-auto amun::TypeChecker::visit(CharacterExpression* node) -> std::any
+auto amun::TypeChecker::visit(StringExpression* node) -> amun::Type*
 {
     return node->get_type_node();
 }
 
-auto amun::TypeChecker::visit(BooleanExpression* node) -> std::any { return node->get_type_node(); }
-
-auto amun::TypeChecker::visit(NullExpression* node) -> std::any { return node->get_type_node(); }
-
-auto amun::TypeChecker::visit(UndefinedExpression* node) -> std::any
+auto amun::TypeChecker::visit(CharacterExpression* node) -> amun::Type*
 {
     return node->get_type_node();
 }
 
-auto amun::TypeChecker::visit(InfinityExpression* node) -> std::any
+auto amun::TypeChecker::visit(BooleanExpression* node) -> amun::Type*
 {
     return node->get_type_node();
 }
 
-auto amun::TypeChecker::node_amun_type(std::any any_type) -> Shared<amun::Type>
+auto amun::TypeChecker::visit(NullExpression* node) -> amun::Type* { return node->get_type_node(); }
+
+auto amun::TypeChecker::visit(UndefinedExpression* node) -> amun::Type*
 {
-    if (any_type.type() == typeid(Shared<amun::FunctionType>)) {
-        return std::any_cast<Shared<amun::FunctionType>>(any_type);
-    }
-    if (any_type.type() == typeid(Shared<amun::PointerType>)) {
-        return std::any_cast<Shared<amun::PointerType>>(any_type);
-    }
-    if (any_type.type() == typeid(Shared<amun::NumberType>)) {
-        return std::any_cast<Shared<amun::NumberType>>(any_type);
-    }
-    if (any_type.type() == typeid(Shared<amun::StaticArrayType>)) {
-        return std::any_cast<Shared<amun::StaticArrayType>>(any_type);
-    }
-    if (any_type.type() == typeid(Shared<amun::StructType>)) {
-        return std::any_cast<Shared<amun::StructType>>(any_type);
-    }
-    if (any_type.type() == typeid(Shared<amun::TupleType>)) {
-        return std::any_cast<Shared<amun::TupleType>>(any_type);
-    }
-    if (any_type.type() == typeid(Shared<amun::EnumType>)) {
-        return std::any_cast<Shared<amun::EnumType>>(any_type);
-    }
-    if (any_type.type() == typeid(Shared<amun::EnumElementType>)) {
-        return std::any_cast<Shared<amun::EnumElementType>>(any_type);
-    }
-    if (any_type.type() == typeid(Shared<amun::NoneType>)) {
-        return std::any_cast<Shared<amun::NoneType>>(any_type);
-    }
-    if (any_type.type() == typeid(Shared<amun::VoidType>)) {
-        return std::any_cast<Shared<amun::VoidType>>(any_type);
-    }
-    if (any_type.type() == typeid(Shared<amun::NullType>)) {
-        return std::any_cast<Shared<amun::NullType>>(any_type);
-    }
+    return node->get_type_node();
+}
 
-    return std::any_cast<Shared<amun::Type>>(any_type);
+auto amun::TypeChecker::visit(InfinityExpression* node) -> amun::Type*
+{
+    return node->get_type_node();
 }
 
-auto amun::TypeChecker::is_same_type(const Shared<amun::Type>& left,
-                                     const Shared<amun::Type>& right) -> bool
+auto amun::TypeChecker::is_same_type(amun::Type* left, amun::Type* right) -> bool
 {
     return left->type_kind == right->type_kind;
 }
 
-auto amun::TypeChecker::resolve_generic_type(Shared<amun::Type> type,
+auto amun::TypeChecker::resolve_generic_type(amun::Type* type,
                                              std::vector<std::string> generic_names,
-                                             std::vector<Shared<amun::Type>> generic_parameters)
-    -> Shared<amun::Type>
+                                             std::vector<amun::Type*> generic_parameters)
+    -> amun::Type*
 {
     const auto type_kind = type->type_kind;
 
     // Generic parameter such as T, E, ...etc
     if (type_kind == amun::TypeKind::GENERIC_PARAMETER) {
-        auto generic = std::static_pointer_cast<amun::GenericParameterType>(type);
+        auto generic = static_cast<amun::GenericParameterType*>(type);
         auto position = index_of(generic_names, generic->name);
 
         if (position >= 0) {
@@ -2080,64 +2063,66 @@ auto amun::TypeChecker::resolve_generic_type(Shared<amun::Type> type,
 
     // Resolve the base of pointer type
     if (type_kind == amun::TypeKind::POINTER) {
-        auto pointer = std::static_pointer_cast<amun::PointerType>(type);
+        auto pointer = static_cast<amun::PointerType*>(type);
         auto new_base = resolve_generic_type(pointer->base_type, generic_names, generic_parameters);
-        auto new_ptr = std::make_shared<amun::PointerType>(new_base);
-        return new_ptr;
+        return context->type_context.pointer_type(new_base);
     }
 
     // Resolve the element type of array type
     if (type_kind == amun::TypeKind::STATIC_ARRAY) {
-        auto array = std::static_pointer_cast<amun::StaticArrayType>(type);
+        auto array = static_cast<amun::StaticArrayType*>(type);
         auto element_type =
             resolve_generic_type(array->element_type, generic_names, generic_parameters);
-        auto length = array->size;
-        auto new_array = std::make_shared<amun::StaticArrayType>(element_type, length);
-        return new_array;
+        return context->type_context.static_array_type(element_type, array->size);
     }
 
     // Resolve function pointer with generic parameters or return type
     if (type_kind == amun::TypeKind::FUNCTION) {
-        auto function = std::static_pointer_cast<amun::FunctionType>(type);
+        auto function = static_cast<amun::FunctionType*>(type);
 
-        function->return_type =
+        auto return_type =
             resolve_generic_type(function->return_type, generic_names, generic_parameters);
 
-        auto parameters = function->parameters;
-        auto parameters_count = parameters.size();
-
-        for (uint64 i = 0; i < parameters_count; i++) {
-            function->parameters[i] =
-                resolve_generic_type(function->parameters[i], generic_names, generic_parameters);
+        std::vector<amun::Type*> parameters;
+        parameters.reserve(function->parameters.size());
+        for (auto& parameter : function->parameters) {
+            auto resolved = resolve_generic_type(parameter, generic_names, generic_parameters);
+            parameters.push_back(resolved);
         }
 
-        return function;
+        return context->type_context.function_type(
+            parameters, return_type, function->has_varargs, function->varargs_type,
+            function->is_intrinsic, function->is_generic, function->generic_names,
+            function->implicit_parameters_count);
     }
 
     // Resolve the fields types of structure type
     if (type_kind == amun::TypeKind::GENERIC_STRUCT) {
-        auto generic_struct = std::static_pointer_cast<amun::GenericStructType>(type);
+        auto generic_struct = static_cast<amun::GenericStructType*>(type);
         auto structure = generic_struct->struct_type;
 
-        int i = 0;
-        auto generic_struct_param = generic_struct->parameters;
-        for (auto& parameter : generic_struct_param) {
+        std::vector<amun::Type*> parameters;
+        parameters.reserve(generic_struct->parameters.size());
+        for (auto& parameter : generic_struct->parameters) {
             if (parameter->type_kind == amun::TypeKind::GENERIC_PARAMETER) {
-                auto generic_type = std::static_pointer_cast<amun::GenericParameterType>(parameter);
+                auto generic_type = static_cast<amun::GenericParameterType*>(parameter);
                 auto index = index_of(generic_names, generic_type->name);
                 if (index != -1) {
-                    generic_struct->parameters[i] = generic_parameters[index];
+                    parameters.push_back(generic_parameters[index]);
                 }
                 else {
-                    generic_struct->parameters[i] = generic_types[generic_type->name];
+                    parameters.push_back(generic_types[generic_type->name]);
                 }
+                continue;
             }
-            i++;
+            parameters.push_back(parameter);
         }
 
-        auto mangled_name = structure->name + mangle_types(generic_struct->parameters);
-        if (types_table.is_defined(mangled_name)) {
-            return std::any_cast<Shared<amun::StructType>>(types_table.lookup(mangled_name));
+        auto resolved_generic_struct =
+            context->type_context.generic_struct_type(structure, parameters);
+        auto instance = context->type_context.generic_struct_instance(resolved_generic_struct);
+        if (instance != nullptr) {
+            return instance;
         }
 
         std::vector<std::string> fields_names;
@@ -2145,56 +2130,54 @@ auto amun::TypeChecker::resolve_generic_type(Shared<amun::Type> type,
             fields_names.push_back(name);
         }
 
-        std::vector<Shared<amun::Type>> types;
+        std::vector<amun::Type*> types;
         for (const auto& type : structure->fields_types) {
-            types.push_back(resolve_generic_type(type, structure->generic_parameters,
-                                                 generic_struct->parameters));
+            types.push_back(resolve_generic_type(type, structure->generic_parameters, parameters));
         }
 
-        auto new_struct = std::make_shared<amun::StructType>(
+        auto mangled_name = structure->name + mangle_types(parameters);
+        auto new_struct = context->type_context.create<amun::StructType>(
             mangled_name, fields_names, types, structure->generic_parameters, true, true);
-        new_struct->generic_parameters_types = generic_struct->parameters;
-        types_table.define(mangled_name, new_struct);
+        new_struct->generic_parameters_types = parameters;
+        context->type_context.define_generic_struct_instance(resolved_generic_struct, new_struct);
         return new_struct;
     }
 
     // Resolve the inner types of tuple type
     if (type_kind == amun::TypeKind::TUPLE) {
-        auto tuple = std::static_pointer_cast<amun::TupleType>(type);
-        std::vector<Shared<amun::Type>> fields;
+        auto tuple = static_cast<amun::TupleType*>(type);
+        std::vector<amun::Type*> fields;
         for (auto& field : tuple->fields_types) {
             auto resolved_field = resolve_generic_type(field, generic_names, generic_parameters);
             fields.push_back(resolved_field);
         }
-        auto tuple_name = "_tuple_" + mangle_types(fields);
-        auto new_tuple = std::make_shared<amun::TupleType>(tuple_name, fields);
-        return new_tuple;
+        return context->type_context.tuple_type(fields);
     }
 
     return type;
 }
 
-auto amun::TypeChecker::infier_type_by_other_type(Shared<amun::Type> type, Shared<amun::Type> other)
-    -> std::unordered_map<std::string, Shared<amun::Type>>
+auto amun::TypeChecker::infier_type_by_other_type(amun::Type* type, amun::Type* other)
+    -> std::unordered_map<std::string, amun::Type*>
 {
     if (type->type_kind == amun::TypeKind::GENERIC_PARAMETER) {
-        std::unordered_map<std::string, Shared<amun::Type>> resolved_types;
-        auto geneic_parameter = std::static_pointer_cast<amun::GenericParameterType>(type);
+        std::unordered_map<std::string, amun::Type*> resolved_types;
+        auto geneic_parameter = static_cast<amun::GenericParameterType*>(type);
         resolved_types[geneic_parameter->name] = other;
         return resolved_types;
     }
 
     if (amun::is_function_pointer_type(type) && amun::is_function_pointer_type(other)) {
-        auto type_ptr = std::static_pointer_cast<amun::PointerType>(type);
-        auto other_ptr = std::static_pointer_cast<amun::PointerType>(other);
+        auto type_ptr = static_cast<amun::PointerType*>(type);
+        auto other_ptr = static_cast<amun::PointerType*>(other);
 
-        auto type_fptr = std::static_pointer_cast<amun::FunctionType>(type_ptr->base_type);
-        auto other_fptr = std::static_pointer_cast<amun::FunctionType>(other_ptr->base_type);
+        auto type_fptr = static_cast<amun::FunctionType*>(type_ptr->base_type);
+        auto other_fptr = static_cast<amun::FunctionType*>(other_ptr->base_type);
 
         if (type_fptr->parameters.size() == other_fptr->parameters.size()) {
             auto return_type =
                 infier_type_by_other_type(type_fptr->return_type, other_fptr->return_type);
-            std::unordered_map<std::string, Shared<amun::Type>> resolved_types;
+            std::unordered_map<std::string, amun::Type*> resolved_types;
             for (const auto& type : return_type) {
                 resolved_types[type.first] = type.second;
             }
@@ -2218,25 +2201,23 @@ auto amun::TypeChecker::infier_type_by_other_type(Shared<amun::Type> type, Share
     }
 
     if (amun::is_pointer_type(type) && amun::is_pointer_type(other)) {
-        auto type_ptr = std::static_pointer_cast<amun::PointerType>(type);
-        auto other_ptr = std::static_pointer_cast<amun::PointerType>(other);
+        auto type_ptr = static_cast<amun::PointerType*>(type);
+        auto other_ptr = static_cast<amun::PointerType*>(other);
         return infier_type_by_other_type(type_ptr->base_type, other_ptr->base_type);
     }
 
     if (amun::is_array_type(type) && amun::is_array_type(other)) {
-        auto type_arr = std::static_pointer_cast<amun::StaticArrayType>(type);
-        auto other_arr = std::static_pointer_cast<amun::StaticArrayType>(other);
+        auto type_arr = static_cast<amun::StaticArrayType*>(type);
+        auto other_arr = static_cast<amun::StaticArrayType*>(other);
         return infier_type_by_other_type(type_arr->element_type, other_arr->element_type);
     }
 
     if (amun::is_generic_struct_type(type) && amun::is_struct_type(other)) {
-        auto type_generic_struct = std::static_pointer_cast<amun::GenericStructType>(type);
-
-        auto type_struct = type_generic_struct->struct_type;
-        auto other_struct = std::static_pointer_cast<amun::StructType>(other);
+        auto type_generic_struct = static_cast<amun::GenericStructType*>(type);
+        auto other_struct = static_cast<amun::StructType*>(other);
 
         int index = 0;
-        std::unordered_map<std::string, Shared<amun::Type>> resolved_types;
+        std::unordered_map<std::string, amun::Type*> resolved_types;
         for (const auto& t : other_struct->generic_parameters_types) {
             auto result = infier_type_by_other_type(type_generic_struct->parameters[index], t);
             for (const auto& element : result) {
@@ -2251,15 +2232,15 @@ auto amun::TypeChecker::infier_type_by_other_type(Shared<amun::Type> type, Share
     }
 
     if (amun::is_generic_struct_type(type) && amun::is_generic_struct_type(other)) {
-        auto type_generic_struct = std::static_pointer_cast<amun::GenericStructType>(type);
-        auto other_generic_struct = std::static_pointer_cast<amun::GenericStructType>(other);
+        auto type_generic_struct = static_cast<amun::GenericStructType*>(type);
+        auto other_generic_struct = static_cast<amun::GenericStructType*>(other);
 
         auto type_struct = type_generic_struct->struct_type;
         auto other_struct = other_generic_struct->struct_type;
 
         if (type_struct->name == other_struct->name &&
             type_struct->fields_types.size() == other_struct->fields_types.size()) {
-            std::unordered_map<std::string, Shared<amun::Type>> resolved_types;
+            std::unordered_map<std::string, amun::Type*> resolved_types;
             size_t index = 0;
             for (const auto& field_type : type_generic_struct->parameters) {
                 auto other_type = other_generic_struct->parameters[index];
@@ -2278,10 +2259,10 @@ auto amun::TypeChecker::infier_type_by_other_type(Shared<amun::Type> type, Share
     }
 
     if (amun::is_tuple_type(type) && amun::is_tuple_type(other)) {
-        auto type_tuple = std::static_pointer_cast<amun::TupleType>(type);
-        auto other_tuple = std::static_pointer_cast<amun::TupleType>(other);
+        auto type_tuple = static_cast<amun::TupleType*>(type);
+        auto other_tuple = static_cast<amun::TupleType*>(other);
         if (type_tuple->fields_types.size() == other_tuple->fields_types.size()) {
-            std::unordered_map<std::string, Shared<amun::Type>> resolved_types;
+            std::unordered_map<std::string, amun::Type*> resolved_types;
             size_t index = 0;
             for (const auto& field_type : type_tuple->fields_types) {
                 auto other_type = other_tuple->fields_types[index];
@@ -2302,7 +2283,7 @@ auto amun::TypeChecker::infier_type_by_other_type(Shared<amun::Type> type, Share
     return {};
 }
 
-auto amun::TypeChecker::check_complete_switch_cases(Shared<amun::EnumType> enum_type,
+auto amun::TypeChecker::check_complete_switch_cases(amun::EnumType* enum_type,
                                                     std::unordered_set<std::string> cases_values,
                                                     bool has_else_branch, TokenSpan span) -> void
 {
@@ -2326,7 +2307,7 @@ auto amun::TypeChecker::check_complete_switch_cases(Shared<amun::EnumType> enum_
 
     for (const auto& member : enum_members_map) {
         if (!cases_values.contains(std::to_string(member.second))) {
-            auto enum_element_name = enum_name.literal + "::" + member.first;
+            auto enum_element_name = std::string(enum_name.literal) + "::" + member.first;
             string_stream << "- " << enum_element_name << "\n";
         }
     }
@@ -2336,9 +2317,9 @@ auto amun::TypeChecker::check_complete_switch_cases(Shared<amun::EnumType> enum_
 }
 
 auto amun::TypeChecker::check_parameters_types(TokenSpan location,
-                                               std::vector<Shared<Expression>>& arguments,
-                                               std::vector<Shared<amun::Type>>& parameters,
-                                               bool has_varargs, Shared<amun::Type> varargs_type,
+                                               std::vector<Expression*>& arguments,
+                                               std::vector<amun::Type*>& parameters,
+                                               bool has_varargs, amun::Type* varargs_type,
                                                int implicit_parameters_count) -> void
 {
 
@@ -2364,7 +2345,7 @@ auto amun::TypeChecker::check_parameters_types(TokenSpan location,
     }
 
     // Resolve Arguments types
-    std::vector<Shared<amun::Type>> arguments_types;
+    std::vector<amun::Type*> arguments_types;
     arguments_types.reserve(arguments.size());
 
     // Resolve Arguments
@@ -2372,7 +2353,7 @@ auto amun::TypeChecker::check_parameters_types(TokenSpan location,
         // Check if any argument is an lambda expression with implicit capturing
         check_lambda_has_invalid_capturing(argument);
 
-        auto argument_type = node_amun_type(argument->accept(this));
+        auto argument_type = argument->accept(this);
         if (argument_type->type_kind == amun::TypeKind::GENERIC_STRUCT) {
             arguments_types.push_back(resolve_generic_type(argument_type));
         }
@@ -2398,7 +2379,7 @@ auto amun::TypeChecker::check_parameters_types(TokenSpan location,
             // if Parameter is pointer type and null pointer passed as argument
             // Change null pointer base type to parameter type
             if (amun::is_pointer_type(parameters[p]) && amun::is_null_type(arguments_types[i])) {
-                auto null_expr = std::dynamic_pointer_cast<NullExpression>(arguments[i]);
+                auto null_expr = dynamic_cast<NullExpression*>(arguments[i]);
                 null_expr->null_base_type = parameters[p];
                 continue;
             }
@@ -2408,11 +2389,12 @@ auto amun::TypeChecker::check_parameters_types(TokenSpan location,
             // parameter element type
             if (amun::is_array_type(parameters[p]) &&
                 arguments[i]->get_ast_node_type() == AstNodeType::AST_ARRAY) {
-                auto array_expr = std::dynamic_pointer_cast<ArrayExpression>(arguments[i]);
-                auto array_type = std::static_pointer_cast<amun::StaticArrayType>(array_expr->type);
-                auto param_type = std::static_pointer_cast<amun::StaticArrayType>(parameters[p]);
+                auto array_expr = dynamic_cast<ArrayExpression*>(arguments[i]);
+                auto array_type = static_cast<amun::StaticArrayType*>(array_expr->type);
+                auto param_type = static_cast<amun::StaticArrayType*>(parameters[p]);
                 if (array_type->size == 0) {
-                    array_type->element_type = param_type->element_type;
+                    array_expr->set_type_node(
+                        context->type_context.static_array_type(param_type->element_type, 0));
                 }
                 continue;
             }
@@ -2442,10 +2424,10 @@ auto amun::TypeChecker::check_parameters_types(TokenSpan location,
     }
 }
 
-auto amun::TypeChecker::check_lambda_has_invalid_capturing(Shared<Expression> expression) -> void
+auto amun::TypeChecker::check_lambda_has_invalid_capturing(Expression* expression) -> void
 {
     if (expression->get_ast_node_type() == AstNodeType::AST_LAMBDA) {
-        auto lambda = std::dynamic_pointer_cast<LambdaExpression>(expression);
+        auto lambda = dynamic_cast<LambdaExpression*>(expression);
         auto location = lambda->position.position;
         if (!lambda->implict_parameters_names.empty()) {
             std::stringstream error_message;
@@ -2529,14 +2511,14 @@ auto amun::TypeChecker::check_number_limits(const char* literal, amun::NumberKin
     }
 }
 
-auto amun::TypeChecker::check_missing_return_statement(Shared<Statement> node) -> bool
+auto amun::TypeChecker::check_missing_return_statement(Statement* node) -> bool
 {
     // This case for single node function declaration
     if (node->get_ast_node_type() == AstNodeType::AST_RETURN) {
         return true;
     }
 
-    const auto& body = std::dynamic_pointer_cast<BlockStatement>(node);
+    const auto& body = dynamic_cast<BlockStatement*>(node);
     const auto& statements = body->statements;
 
     // This check called only for non void function so it must have return in
@@ -2561,7 +2543,7 @@ auto amun::TypeChecker::check_missing_return_statement(Shared<Statement> node) -
 
         else if (node_kind == AstNodeType::AST_IF_STATEMENT) {
             bool is_covered = false;
-            auto if_statement = std::dynamic_pointer_cast<IfStatement>(statement);
+            auto if_statement = dynamic_cast<IfStatement*>(statement);
             for (const auto& branch : if_statement->conditional_blocks) {
                 is_covered = check_missing_return_statement(branch->body);
                 if (!is_covered) {
@@ -2575,7 +2557,7 @@ auto amun::TypeChecker::check_missing_return_statement(Shared<Statement> node) -
         }
 
         else if (node_kind == AstNodeType::AST_SWITCH_STATEMENT) {
-            auto switch_statement = std::dynamic_pointer_cast<SwitchStatement>(statement);
+            auto switch_statement = dynamic_cast<SwitchStatement*>(statement);
             if (!switch_statement->has_default_case) {
                 return false;
             }
@@ -2602,7 +2584,7 @@ auto amun::TypeChecker::check_missing_return_statement(Shared<Statement> node) -
     return false;
 }
 
-auto amun::TypeChecker::check_valid_assignment_right_side(Shared<Expression> node,
+auto amun::TypeChecker::check_valid_assignment_right_side(Expression* node,
                                                           TokenSpan position) -> void
 {
     const auto left_node_type = node->get_ast_node_type();
@@ -2628,7 +2610,7 @@ auto amun::TypeChecker::check_valid_assignment_right_side(Shared<Expression> nod
     // Make sure to report error if use want to modify string literal using
     // index expression
     if (left_node_type == AstNodeType::AST_INDEX) {
-        auto index_expression = std::dynamic_pointer_cast<IndexExpression>(node);
+        auto index_expression = dynamic_cast<IndexExpression*>(node);
         auto value_type = index_expression->value->get_type_node();
         if (amun::get_type_literal(value_type) == "*Int8") {
             auto index_position = index_expression->position.position;
@@ -2643,7 +2625,7 @@ auto amun::TypeChecker::check_valid_assignment_right_side(Shared<Expression> nod
 
     // Prefix unary expression is a valid left hand side but only if token is *
     if (left_node_type == AstNodeType::AST_PREFIX_UNARY) {
-        auto prefix_unary = std::static_pointer_cast<PrefixUnaryExpression>(node);
+        auto prefix_unary = static_cast<PrefixUnaryExpression*>(node);
         if (prefix_unary->operator_token.kind == TokenKind::TOKEN_STAR) {
             return;
         }
@@ -2690,6 +2672,25 @@ auto amun::TypeChecker::check_valid_assignment_right_side(Shared<Expression> nod
     }
 }
 
+auto amun::TypeChecker::check_loop_variable_assignment(Expression* node, TokenSpan position)
+    -> void
+{
+    if (node->get_ast_node_type() != AstNodeType::AST_LITERAL) {
+        return;
+    }
+
+    // Only the loop variable binding is readonly, not a variable that shadows it
+    auto name = std::string(static_cast<LiteralExpression*>(node)->name.literal);
+    auto level = types_table.lookup_with_level(name).second;
+    for (const auto& [loop_variable, loop_level] : loop_variables) {
+        if (loop_variable == name && loop_level == level) {
+            context->diagnostics.report_error(position, "Can't modify loop variable `" + name +
+                                                            "`, it's readonly in the loop body");
+            throw "Stop";
+        }
+    }
+}
+
 inline auto amun::TypeChecker::push_new_scope() -> void { types_table.push_new_scope(); }
 
 inline auto amun::TypeChecker::pop_current_scope() -> void { types_table.pop_current_scope(); }
\ No newline at end of file
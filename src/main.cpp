@@ -1,10 +1,14 @@
 #include "../include/amun_basic.hpp"
+#include "../include/amun_build_cache.hpp"
 #include "../include/amun_command.hpp"
 #include "../include/amun_compiler.hpp"
 #include "../include/amun_context.hpp"
 #include "../include/amun_files.hpp"
 
+#include <cstring>
 #include <memory>
+#include <string>
+#include <vector>
 
 #define unused [[maybe_unused]]
 
@@ -92,6 +96,44 @@ auto execute_object_command(int argc, char** argv) -> int
     return compiler.compile_to_object_file_from_source_code(source_file);
 }
 
+auto execute_run_command(int argc, char** argv) -> int
+{
+    if (argc < 3) {
+        printf("Invalid number of arguments for `run` command expect at last %i but got %i\n", 3,
+               argc);
+        printf("Usage : %s run <file> <options> -- <program arguments>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const char* source_file = argv[2];
+    if (!amun::is_file_exists(source_file)) {
+        printf("Path %s not exists\n", source_file);
+        return EXIT_FAILURE;
+    }
+
+    if (!is_ends_with(source_file, AMUN_LANGUAGE_EXTENSION)) {
+        printf("Invalid source file extension, file must end with `%s`\n", AMUN_LANGUAGE_EXTENSION);
+        return EXIT_FAILURE;
+    }
+
+    // Arguments after `--` are passed to the program and the arguments before it are options
+    int options_count = argc;
+    std::vector<std::string> program_arguments;
+    for (int i = 3; i < argc; i++) {
+        if (strcmp(argv[i], "--") == 0) {
+            options_count = i;
+            program_arguments.assign(argv + i + 1, argv + argc);
+            break;
+        }
+    }
+
+    auto context = std::make_shared<amun::Context>();
+    parse_compiler_options(&context->options, options_count, argv);
+
+    amun::Compiler compiler(context);
+    return compiler.run_source_code(source_file, program_arguments);
+}
+
 auto emit_llvm_ir_coomand(int argc, char** argv) -> int
 {
     if (argc < 3) {
@@ -143,6 +185,31 @@ auto execute_check_command(int argc, char** argv) -> int
     return compiler.check_source_code(source_file);
 }
 
+auto execute_cache_stats_command(int argc, char** argv) -> int
+{
+    if (argc < 3) {
+        printf("Invalid number of arguments for `cache-stats` command expect at last %i but got "
+               "%i\n",
+               3, argc);
+        printf("Usage : %s cache-stats <directory> <options>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const char* cache_directory = argv[2];
+    if (!amun::is_file_exists(cache_directory)) {
+        printf("Path %s not exists\n", cache_directory);
+        return EXIT_FAILURE;
+    }
+
+    amun::CompilerOptions options;
+    parse_compiler_options(&options, argc, argv);
+
+    auto max_size_in_bytes = static_cast<uint64>(options.build_cache_size) * 1024 * 1024;
+    amun::BuildCache build_cache(cache_directory, max_size_in_bytes);
+    build_cache.report_statistics();
+    return EXIT_SUCCESS;
+}
+
 auto execute_version_command(unused int argc, unused char** argv) -> int
 {
     printf("Language version is %s\n", AMUN_LANGUAGE_VERSION);
@@ -157,13 +224,28 @@ auto execute_help_command(unused int argc, char** argv) -> int
     printf("    - compile <file> <options> : Compile source files to executables with options.\n");
     printf("    - object  <file> <options> : Compile source files to object file with options.\n");
     printf("    - emit-ir <file> <options> : Compile source to llvm ir files with options.\n");
+    printf("    - run     <file> <options> : Compile source in memory and run it, arguments after\n");
+    printf("                                 `--` are passed to the program.\n");
     printf("    - check   <file>           : Check if the source code is valid.\n");
+    printf("    - cache-stats <directory>  : Print the build cache entries, hits and misses.\n");
     printf("    - version                  : Print the current compiler version.\n");
     printf("    - help                     : Print how to use and list of commands.\n");
     printf("Options:\n");
     printf("    -o  <name>                 : Set the output exeutable name.\n");
     printf("    -w                         : Enable reporting warns, disabled by default.\n");
     printf("    -werr                      : Convert warns to erros.\n");
+    printf("    -O0 -O1 -O2 -O3 -Os        : Set the optimization level, -O0 by default.\n");
+    printf("    -mcpu=<cpu>                : Set the target cpu, `native` by default.\n");
+    printf("    -march=<cpu>               : Alias for -mcpu.\n");
+    printf("    -mtune=<cpu>               : Tune the generated code for cpu.\n");
+    printf("    -mattr=<features>          : Enable or disable target features like +avx2.\n");
+    printf("    -flto                      : Optimize objects together at link time.\n");
+    printf("    -j<N>                      : Emit machine code on N threads, 1 by default.\n");
+    printf("    -ftime-report              : Report the time of each compilation phase.\n");
+    printf("    -ftime-trace=<file>        : Write compilation time trace in Chrome format.\n");
+    printf("    -fno-modules-cache         : Parse imports without precompiled modules.\n");
+    printf("    -fbuild-cache=<directory>  : Reuse cached objects of unchanged programs.\n");
+    printf("    -fbuild-cache-size=<MB>    : Set the build cache size, 1024 MB by default.\n");
     return EXIT_SUCCESS;
 }
 
@@ -174,7 +256,9 @@ auto main(int argc, char** argv) -> int
     command_map.registerCommand("compile", execute_compile_command);
     command_map.registerCommand("object", execute_object_command);
     command_map.registerCommand("emit-ir", emit_llvm_ir_coomand);
+    command_map.registerCommand("run", execute_run_command);
     command_map.registerCommand("check", execute_check_command);
+    command_map.registerCommand("cache-stats", execute_cache_stats_command);
     command_map.registerCommand("version", execute_version_command);
     command_map.registerCommand("help", execute_help_command);
     return command_map.executeCommand(argc, argv);